@@ -0,0 +1,445 @@
+/**
+ * A program for measuring the throughput of each phase of lci on a source
+ * file.  The lexer, tokenizer, and parser run as a single streaming pass, with
+ * each requesting its input from the one before it, so the phases are timed
+ * cumulatively: the lexer alone, the lexer and tokenizer together, and the
+ * whole front end, with the time of each phase being the difference from the
+ * one before.  The parser phase includes optimizing and resolving the parse
+ * tree; the interpreter phase is the time to execute it (including compiling
+ * it to bytecode for the \c vm engine).
+ *
+ * Each phase is run several times on a fresh copy of the source and its
+ * fastest time is reported.  Program output is discarded and program input is
+ * read from a file given with \c -i.  The results are printed to standard
+ * output as a single line of JSON, such as:
+ *
+ * \code
+ * {"file": "test.lol", "bytes": 1234, "engine": "tree", "runs": 5,
+ * "lexer": 0.000012, "tokenizer": 0.000034, "parser": 0.000056,
+ * "interpreter": 0.012345}
+ * \endcode
+ *
+ * \file   bench.c
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "lexer.h"
+#include "tokenizer.h"
+#include "parser.h"
+#include "optimizer.h"
+#include "resolver.h"
+#include "interpreter.h"
+#include "vm.h"
+#include "intern.h"
+#include "memory.h"
+#include "error.h"
+
+#define READSIZE 4096
+
+static char *program_name;
+
+static char *shortopt = "hn:i:";
+static struct option longopt[] = {
+	{ "help", no_argument, NULL, (int)'h' },
+	{ "runs", required_argument, NULL, (int)'n' },
+	{ "input", required_argument, NULL, (int)'i' },
+	{ "engine", required_argument, NULL, (int)'e' },
+	{ 0, 0, 0, 0 }
+};
+
+static void help(void) {
+	fprintf(stderr, "\
+Usage: %s [OPTION] ... FILE\n\
+Measure the time each phase of lci takes on FILE.\n\
+  -h, --help\t\toutput this help\n\
+  -n, --runs=N\t\trun each phase N times, keeping the fastest (5 by\n\
+\t\t\tdefault)\n\
+  -i, --input=FILE\tread program input from FILE\n\
+      --engine=ENGINE\texecute with ENGINE: tree (default) or vm\n", program_name);
+}
+
+/**
+ * Stores a buffer of characters.
+ */
+typedef struct {
+	char *data;    /**< The characters, followed by a null character. */
+	size_t length; /**< The number of characters in \a data. */
+	size_t pos;    /**< The position of the next character to read. */
+} Buffer;
+
+/**
+ * Reads the contents of a file.
+ *
+ * \param [in] path The path of the file to read.
+ *
+ * \param [out] buf The contents of the file.
+ *
+ * \retval 0 The file could not be read.
+ *
+ * \retval 1 \a buf holds the contents of the file.
+ */
+static int readBuffer(const char *path, Buffer *buf)
+{
+	size_t size = 0;
+	FILE *file = fopen(path, "rb");
+	buf->data = NULL;
+	buf->length = 0;
+	buf->pos = 0;
+	if (!file) {
+		perror(path);
+		return 0;
+	}
+	while (!feof(file)) {
+		void *mem = NULL;
+		if (buf->length + 1 >= size) {
+			size = size ? size * 2 : READSIZE;
+			mem = realloc(buf->data, sizeof(char) * size);
+			if (!mem) {
+				perror("realloc");
+				goto readBufferAbort;
+			}
+			buf->data = mem;
+		}
+		buf->length += fread(buf->data + buf->length,
+				1,
+				size - buf->length - 1,
+				file);
+		if (ferror(file)) {
+			perror(path);
+			goto readBufferAbort;
+		}
+	}
+	fclose(file);
+	buf->data[buf->length] = '\0';
+	return 1;
+
+readBufferAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	fclose(file);
+	free(buf->data);
+	buf->data = NULL;
+	return 0;
+}
+
+/**
+ * Copies a buffer into another of the same size, which a phase may modify.
+ *
+ * \param [in] src The buffer to copy.
+ *
+ * \param [out] dst The buffer to copy to, with space for the characters of
+ * \a src and a null character.
+ */
+static void copyBuffer(const Buffer *src, char *dst)
+{
+	memcpy(dst, src->data, src->length);
+	dst[src->length] = '\0';
+}
+
+/**
+ * Gets the current time.
+ *
+ * \return A time, in seconds, which only ever increases.
+ */
+static double getBenchTime(void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+#else
+	return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * Discards program output and writes errors to standard error.
+ */
+static size_t writeBench(void *data,
+                         int stream,
+                         const char *text,
+                         size_t length)
+{
+	(void)data;
+	if (stream) return fwrite(text, 1, length, stderr);
+	return length;
+}
+
+/**
+ * Reads program input from the buffer given with \c -i, if any.
+ */
+static int readBench(void *data)
+{
+	Buffer *input = data;
+	if (!input->data || input->pos >= input->length) return EOF;
+	return (unsigned char)input->data[input->pos++];
+}
+
+/**
+ * Scans every lexeme of a source.
+ *
+ * \param [in,out] buffer The source, which is modified as it is scanned.
+ *
+ * \param [in] length The number of characters in \a buffer.
+ *
+ * \param [in] fname The name of the source file.
+ *
+ * \retval 0 The source could not be scanned.
+ *
+ * \retval 1 The source was scanned.
+ */
+static int benchLexer(char *buffer,
+                      size_t length,
+                      const char *fname)
+{
+	Lexer lexer;
+	Lexeme lex;
+	initLexer(&lexer, buffer, (unsigned int)length, fname);
+	while (scanLexeme(&lexer, &lex))
+		;
+	return !getErrorCode();
+}
+
+/**
+ * Generates every token of a source, releasing each once it is generated as
+ * the parser would.
+ *
+ * \param [in,out] buffer The source, which is modified as it is scanned.
+ *
+ * \param [in] length The number of characters in \a buffer.
+ *
+ * \param [in] fname The name of the source file.
+ *
+ * \retval 0 The source could not be tokenized.
+ *
+ * \retval 1 The source was tokenized.
+ */
+static int benchTokenizer(char *buffer,
+                          size_t length,
+                          const char *fname)
+{
+	TokenStream *stream = NULL;
+	unsigned long n;
+	Token *token = NULL;
+	if (!(stream = createTokenStream(buffer, (unsigned int)length, fname)))
+		return 0;
+	for (n = 0; (token = getStreamToken(stream, n)); n++) {
+		if (token->type == TT_EOF) break;
+		releaseStreamTokens(stream, n + 1);
+	}
+	deleteTokenStream(stream);
+	return token != NULL;
+}
+
+/**
+ * Parses, optimizes, and resolves a source.
+ *
+ * \param [in,out] buffer The source, which is modified as it is scanned.
+ *
+ * \param [in] length The number of characters in \a buffer.
+ *
+ * \param [in] fname The name of the source file.
+ *
+ * \return The parse tree of the source.
+ *
+ * \retval NULL The source could not be parsed.
+ */
+static MainNode *benchParser(char *buffer,
+                             size_t length,
+                             const char *fname)
+{
+	TokenStream *stream = NULL;
+	MainNode *node = NULL;
+	if (!(stream = createTokenStream(buffer, (unsigned int)length, fname)))
+		return NULL;
+	node = parseMainNode(stream);
+	deleteTokenStream(stream);
+	if (node && (optimizeMainNode(node, OPTIMIZE_DEFAULT)
+			|| resolveMainNode(node))) {
+		deleteMainNode(node);
+		return NULL;
+	}
+	return node;
+}
+
+/**
+ * Executes a parse tree.
+ *
+ * \param [in] node The parse tree to execute.
+ *
+ * \param [in] vm Whether to execute \a node with the bytecode virtual machine.
+ *
+ * \retval 0 The parse tree could not be executed.
+ *
+ * \retval 1 The parse tree was executed.
+ */
+static int benchInterpreter(MainNode *node,
+                            int vm)
+{
+	Program *prog = NULL;
+	int status;
+	if (!vm) return !interpretMainNode(node);
+	if (!(prog = compileMainNode(node))) return 0;
+	status = executeProgram(prog);
+	deleteProgram(prog);
+	return !status;
+}
+
+/**
+ * Prints a string as a JSON string.
+ *
+ * \param [in] str The string to print.
+ */
+static void printJsonString(const char *str)
+{
+	putchar('"');
+	for (; *str; str++) {
+		if (*str == '"' || *str == '\\') printf("\\%c", *str);
+		else if ((unsigned char)*str < 0x20) printf("\\u%04x", *str);
+		else putchar(*str);
+	}
+	putchar('"');
+}
+
+int main(int argc, char **argv)
+{
+	Buffer src;
+	Buffer input;
+	IoHandler io;
+	char *buffer = NULL;
+	const char *fname = NULL;
+	const char *inpath = NULL;
+	int vm = 0;
+	int runs = 5;
+	int n;
+	int ch;
+	int status = 1;
+	/* The fastest cumulative time of each phase */
+	double best[4];
+
+	program_name = argv[0];
+	src.data = NULL;
+	input.data = NULL;
+	input.length = 0;
+	input.pos = 0;
+
+	while ((ch = getopt_long(argc, argv, shortopt, longopt, NULL)) != -1) {
+		switch (ch) {
+			default:
+				help();
+				return 1;
+			case 'h':
+				help();
+				return 0;
+			case 'n':
+				runs = atoi(optarg);
+				if (runs < 1) {
+					fprintf(stderr, "%s: invalid number of runs '%s'\n", program_name, optarg);
+					return 1;
+				}
+				break;
+			case 'i':
+				inpath = optarg;
+				break;
+			case 'e':
+				if (!strcmp(optarg, "tree")) vm = 0;
+				else if (!strcmp(optarg, "vm")) vm = 1;
+				else {
+					fprintf(stderr, "%s: invalid engine '%s'\n", program_name, optarg);
+					return 1;
+				}
+				break;
+		}
+	}
+	if (optind != argc - 1) {
+		help();
+		return 1;
+	}
+	fname = argv[optind];
+
+	if (!readBuffer(fname, &src)) return 1;
+	if (inpath && !readBuffer(inpath, &input)) goto mainAbort;
+	buffer = malloc(sizeof(char) * (src.length + 1));
+	if (!buffer) {
+		perror("malloc");
+		goto mainAbort;
+	}
+
+	io.data = &input;
+	io.write = writeBench;
+	io.read = readBench;
+	setIoHandler(&io);
+
+	for (n = 0; n < 4; n++) best[n] = -1.0;
+	for (n = 0; n < runs; n++) {
+		MainNode *node = NULL;
+		double times[4];
+		double start;
+		int k;
+
+		copyBuffer(&src, buffer);
+		start = getBenchTime();
+		if (!benchLexer(buffer, src.length, fname)) goto mainAbort;
+		times[0] = getBenchTime() - start;
+
+		copyBuffer(&src, buffer);
+		start = getBenchTime();
+		if (!benchTokenizer(buffer, src.length, fname)) goto mainAbort;
+		times[1] = getBenchTime() - start;
+
+		/* Tokens refer to the source, so each run parses its own copy */
+		copyBuffer(&src, buffer);
+		start = getBenchTime();
+		if (!(node = benchParser(buffer, src.length, fname)))
+			goto mainAbort;
+		times[2] = getBenchTime() - start;
+
+		input.pos = 0;
+		start = getBenchTime();
+		if (!benchInterpreter(node, vm)) {
+			deleteMainNode(node);
+			goto mainAbort;
+		}
+		times[3] = getBenchTime() - start;
+		deleteMainNode(node);
+
+		for (k = 0; k < 4; k++)
+			if (best[k] < 0.0 || times[k] < best[k])
+				best[k] = times[k];
+	}
+
+	/* Each front-end phase is the difference from the one it feeds */
+	for (n = 2; n > 0; n--) {
+		best[n] -= best[n - 1];
+		if (best[n] < 0.0) best[n] = 0.0;
+	}
+
+	printf("{\"file\": ");
+	printJsonString(fname);
+	printf(", \"bytes\": %lu, \"engine\": \"%s\", \"runs\": %d",
+			(unsigned long)src.length, vm ? "vm" : "tree", runs);
+	printf(", \"lexer\": %.6f, \"tokenizer\": %.6f", best[0], best[1]);
+	printf(", \"parser\": %.6f, \"interpreter\": %.6f}\n", best[2], best[3]);
+	status = 0;
+
+mainAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	setIoHandler(NULL);
+	if (status) fprintf(stderr, "%s: could not run %s\n", program_name, fname);
+	free(buffer);
+	free(input.data);
+	free(src.data);
+	deleteMemoryPools();
+	deleteInternTable();
+	return status;
+}
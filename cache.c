@@ -0,0 +1,1244 @@
+#include "cache.h"
+#include "intern.h"
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_MKDIR
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_GETPID
+#include <unistd.h>
+#endif
+
+/**
+ * The number of bytes a cache writer initially has space for.
+ */
+#define CACHE_WRITER_SIZE 4096
+
+/**
+ * Stores the bits of a decimal so they may be stored as an integer.
+ */
+typedef union {
+	float f;         /**< The decimal. */
+	unsigned int u;  /**< The bits of \a f (the same size as \a f). */
+} FloatBits;
+
+/**
+ * Hashes the characters of a source file.
+ *
+ * \param [in] data The characters to hash.
+ *
+ * \param [in] length The number of characters in \a data.
+ *
+ * \return The 64-bit FNV-1a hash of \a data.
+ */
+unsigned long long hashSource(const char *data,
+                              size_t length)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	size_t n;
+	for (n = 0; n < length; n++) {
+		hash ^= (unsigned char)data[n];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+ * Gets the path of the cache file for a source file.
+ *
+ * \param [in] fname The name of the source file.
+ *
+ * \param [in] dir The directory to store the cache file in (NULL for the
+ * \a CACHE_DIRECTORY next to \a fname).
+ *
+ * \note Every source file with the same name shares a cache file when \a dir
+ * is given.  The hash stored in the cache file keeps them from being confused.
+ *
+ * \return The path of the cache file, which must be freed by the caller.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+char *getCachePath(const char *fname,
+                   const char *dir)
+{
+	const char *base = strrchr(fname, '/');
+	size_t dirlen = 0;
+	size_t baselen = 0;
+	char *path = NULL;
+	char *p = NULL;
+	base = base ? base + 1 : fname;
+	baselen = strlen(base);
+	/* Replace a .lol extension */
+	if (baselen > 4 && !strcmp(base + baselen - 4, ".lol"))
+		baselen -= 4;
+	if (dir)
+		dirlen = strlen(dir);
+	else
+		dirlen = (size_t)(base - fname) + strlen(CACHE_DIRECTORY);
+	path = malloc(sizeof(char) * (dirlen + baselen + strlen(CACHE_EXTENSION) + 2));
+	if (!path) {
+		perror("malloc");
+		return NULL;
+	}
+	p = path;
+	if (dir) {
+		memcpy(p, dir, dirlen);
+		p += dirlen;
+	}
+	else {
+		memcpy(p, fname, (size_t)(base - fname));
+		p += base - fname;
+		strcpy(p, CACHE_DIRECTORY);
+		p += strlen(CACHE_DIRECTORY);
+	}
+	*p++ = '/';
+	memcpy(p, base, baselen);
+	p += baselen;
+	strcpy(p, CACHE_EXTENSION);
+	return path;
+}
+
+/**
+ * Writes a byte to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] byte The byte to write.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a byte was written.
+ */
+static int writeByte(CacheWriter *writer,
+                     unsigned char byte)
+{
+	if (writer->num == writer->size) {
+		size_t newsize = writer->size ? writer->size * 2 : CACHE_WRITER_SIZE;
+		void *mem = realloc(writer->data, newsize);
+		if (!mem) {
+			perror("realloc");
+			return 0;
+		}
+		writer->data = mem;
+		writer->size = newsize;
+	}
+	writer->data[writer->num++] = byte;
+	return 1;
+}
+
+/**
+ * Writes an unsigned number to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] num The number to write.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a num was written.
+ */
+static int writeNumber(CacheWriter *writer,
+                       unsigned long long num)
+{
+	do {
+		unsigned char byte = (unsigned char)(num & 0x7f);
+		num >>= 7;
+		if (num) byte |= 0x80;
+		if (!writeByte(writer, byte)) return 0;
+	} while (num);
+	return 1;
+}
+
+/**
+ * Writes a string to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] str The string to write.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a str was written.
+ */
+static int writeString(CacheWriter *writer,
+                       const char *str)
+{
+	size_t len = strlen(str);
+	size_t n;
+	if (!writeNumber(writer, len)) return 0;
+	for (n = 0; n < len; n++)
+		if (!writeByte(writer, (unsigned char)str[n])) return 0;
+	return 1;
+}
+
+static int writeExprNode(CacheWriter *, ExprNode *);
+static int writeBlockNode(CacheWriter *, BlockNode *);
+
+/**
+ * Writes an identifier to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The identifier to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a node is invalid.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeIdentifierNode(CacheWriter *writer,
+                               IdentifierNode *node)
+{
+	if (!node) return writeNumber(writer, 0);
+	if (!writeNumber(writer, 1)
+			|| !writeNumber(writer, node->type))
+		return 0;
+	switch (node->type) {
+		case IT_DIRECT:
+			if (!writeString(writer, node->id)) return 0;
+			break;
+		case IT_INDIRECT:
+			if (!writeExprNode(writer, node->id)) return 0;
+			break;
+		default:
+			return 0;
+	}
+	/* Every file name in a parse tree is that of its source file */
+	return writeNumber(writer, node->fname ? 1 : 0)
+			&& writeNumber(writer, node->line)
+			&& writeIdentifierNode(writer, node->slot);
+}
+
+/**
+ * Writes an identifier list to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] list The identifier list to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a list is invalid.
+ *
+ * \retval 1 \a list was written.
+ */
+static int writeIdentifierNodeList(CacheWriter *writer,
+                                   IdentifierNodeList *list)
+{
+	unsigned int n;
+	if (!list) return writeNumber(writer, 0);
+	if (!writeNumber(writer, (unsigned long long)list->num + 1)) return 0;
+	for (n = 0; n < list->num; n++)
+		if (!writeIdentifierNode(writer, list->ids[n])) return 0;
+	return 1;
+}
+
+/**
+ * Writes a type to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The type to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeTypeNode(CacheWriter *writer,
+                         TypeNode *node)
+{
+	if (!node) return writeNumber(writer, 0);
+	return writeNumber(writer, (unsigned long long)node->type + 1);
+}
+
+/**
+ * Writes a constant to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The constant to write.
+ *
+ * \retval 0 Memory allocation failed or \a node is invalid.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeConstantNode(CacheWriter *writer,
+                             ConstantNode *node)
+{
+	if (!writeNumber(writer, node->type)) return 0;
+	switch (node->type) {
+		case CT_INTEGER: {
+			/* Interleave negative and positive numbers */
+			unsigned long long i = (unsigned long long)node->data.i;
+			if (node->data.i < 0)
+				return writeNumber(writer, ((~i) << 1) | 1);
+			return writeNumber(writer, i << 1);
+		}
+		case CT_FLOAT: {
+			/* Store the bits of the decimal as an integer */
+			FloatBits bits;
+			bits.u = 0;
+			bits.f = node->data.f;
+			return writeNumber(writer, bits.u);
+		}
+		case CT_BOOLEAN:
+			return writeNumber(writer, node->data.i ? 1 : 0);
+		case CT_STRING:
+			return writeString(writer, node->data.s);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Writes an expression list to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] list The expression list to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a list is invalid.
+ *
+ * \retval 1 \a list was written.
+ */
+static int writeExprNodeList(CacheWriter *writer,
+                             ExprNodeList *list)
+{
+	unsigned int n;
+	if (!list) return writeNumber(writer, 0);
+	if (!writeNumber(writer, (unsigned long long)list->num + 1)) return 0;
+	for (n = 0; n < list->num; n++)
+		if (!writeExprNode(writer, list->exprs[n])) return 0;
+	return 1;
+}
+
+/**
+ * Writes an expression to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The expression to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a node is invalid.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeExprNode(CacheWriter *writer,
+                         ExprNode *node)
+{
+	if (!node) return writeNumber(writer, 0);
+	if (!writeNumber(writer, (unsigned long long)node->type + 1)) return 0;
+	switch (node->type) {
+		case ET_CAST: {
+			CastExprNode *expr = node->expr;
+			return writeExprNode(writer, expr->target)
+					&& writeTypeNode(writer, expr->newtype);
+		}
+		case ET_CONSTANT:
+			return writeConstantNode(writer, node->expr);
+		case ET_IDENTIFIER:
+			return writeIdentifierNode(writer, node->expr);
+		case ET_FUNCCALL: {
+			FuncCallExprNode *expr = node->expr;
+			return writeIdentifierNode(writer, expr->scope)
+					&& writeIdentifierNode(writer, expr->name)
+					&& writeExprNodeList(writer, expr->args);
+		}
+		case ET_OP: {
+			OpExprNode *expr = node->expr;
+			return writeNumber(writer, expr->type)
+					&& writeExprNodeList(writer, expr->args);
+		}
+		case ET_IMPVAR:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Writes a code block list to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] list The code block list to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a list is invalid.
+ *
+ * \retval 1 \a list was written.
+ */
+static int writeBlockNodeList(CacheWriter *writer,
+                              BlockNodeList *list)
+{
+	unsigned int n;
+	if (!list) return writeNumber(writer, 0);
+	if (!writeNumber(writer, (unsigned long long)list->num + 1)) return 0;
+	for (n = 0; n < list->num; n++)
+		if (!writeBlockNode(writer, list->blocks[n])) return 0;
+	return 1;
+}
+
+/**
+ * Writes a statement to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The statement to write.
+ *
+ * \retval 0 Memory allocation failed or \a node is invalid.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeStmtNode(CacheWriter *writer,
+                         StmtNode *node)
+{
+	if (!writeNumber(writer, node->type)
+			|| !writeNumber(writer, node->line))
+		return 0;
+	switch (node->type) {
+		case ST_CAST: {
+			CastStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->target)
+					&& writeTypeNode(writer, stmt->newtype);
+		}
+		case ST_PRINT: {
+			PrintStmtNode *stmt = node->stmt;
+			return writeExprNodeList(writer, stmt->args)
+					&& writeNumber(writer, stmt->file == stderr ? 1 : 0)
+					&& writeNumber(writer, stmt->nonl ? 1 : 0);
+		}
+		case ST_INPUT: {
+			InputStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->target);
+		}
+		case ST_ASSIGNMENT: {
+			AssignmentStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->target)
+					&& writeExprNode(writer, stmt->expr);
+		}
+		case ST_DECLARATION: {
+			DeclarationStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->scope)
+					&& writeIdentifierNode(writer, stmt->target)
+					&& writeExprNode(writer, stmt->expr)
+					&& writeTypeNode(writer, stmt->type)
+					&& writeIdentifierNode(writer, stmt->parent);
+		}
+		case ST_IFTHENELSE: {
+			IfThenElseStmtNode *stmt = node->stmt;
+			return writeBlockNode(writer, stmt->yes)
+					&& writeBlockNode(writer, stmt->no)
+					&& writeExprNodeList(writer, stmt->guards)
+					&& writeBlockNodeList(writer, stmt->blocks);
+		}
+		case ST_SWITCH: {
+			SwitchStmtNode *stmt = node->stmt;
+			return writeExprNodeList(writer, stmt->guards)
+					&& writeBlockNodeList(writer, stmt->blocks)
+					&& writeBlockNode(writer, stmt->def);
+		}
+		case ST_BREAK:
+			return 1;
+		case ST_RETURN: {
+			ReturnStmtNode *stmt = node->stmt;
+			return writeExprNode(writer, stmt->value);
+		}
+		case ST_LOOP: {
+			LoopStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->name)
+					&& writeIdentifierNode(writer, stmt->var)
+					&& writeExprNode(writer, stmt->guard)
+					&& writeExprNode(writer, stmt->update)
+					&& writeBlockNode(writer, stmt->body);
+		}
+		case ST_DEALLOCATION: {
+			DeallocationStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->target);
+		}
+		case ST_FUNCDEF: {
+			FuncDefStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->scope)
+					&& writeIdentifierNode(writer, stmt->name)
+					&& writeIdentifierNodeList(writer, stmt->args)
+					&& writeBlockNode(writer, stmt->body);
+		}
+		case ST_EXPR:
+			return writeExprNode(writer, node->stmt);
+		case ST_ALTARRAYDEF: {
+			AltArrayDefStmtNode *stmt = node->stmt;
+			return writeIdentifierNode(writer, stmt->name)
+					&& writeBlockNode(writer, stmt->body)
+					&& writeIdentifierNode(writer, stmt->parent);
+		}
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Writes a code block to a cache writer.
+ *
+ * \param [in,out] writer The writer to write to.
+ *
+ * \param [in] node The code block to write (may be NULL).
+ *
+ * \retval 0 Memory allocation failed or \a node is invalid.
+ *
+ * \retval 1 \a node was written.
+ */
+static int writeBlockNode(CacheWriter *writer,
+                          BlockNode *node)
+{
+	StmtNodeList *stmts = NULL;
+	unsigned int n;
+	if (!node) return writeNumber(writer, 0);
+	stmts = node->stmts;
+	if (!writeNumber(writer, (unsigned long long)stmts->num + 1)) return 0;
+	for (n = 0; n < stmts->num; n++)
+		if (!writeStmtNode(writer, stmts->stmts[n])) return 0;
+	return 1;
+}
+
+/**
+ * Saves a parse tree to a cache file.  The file is written under a temporary
+ * name and then renamed, so other processes never load a partially written
+ * file.
+ *
+ * \param [in] path The path of the cache file.
+ *
+ * \param [in] node The parse tree to save.
+ *
+ * \param [in] hash The hash of the source \a node was parsed from.
+ *
+ * \param [in] length The length of the source \a node was parsed from.
+ *
+ * \note The directory holding \a path is created if it does not exist and
+ * the system supports it.
+ *
+ * \retval 0 The cache file could not be written.
+ *
+ * \retval 1 \a node was saved to \a path.
+ */
+int saveMainNode(const char *path,
+                 MainNode *node,
+                 unsigned long long hash,
+                 size_t length)
+{
+	CacheWriter header;
+	CacheWriter body;
+	char *temp = NULL;
+	FILE *file = NULL;
+	long id = 0;
+	header.data = body.data = NULL;
+	header.num = body.num = 0;
+	header.size = body.size = 0;
+	/* Serialize the parse tree before its header, which records its hash */
+	if (!writeBlockNode(&body, node->block)) goto saveMainNodeAbort;
+	if (!writeByte(&header, CACHE_MAGIC[0])
+			|| !writeByte(&header, CACHE_MAGIC[1])
+			|| !writeByte(&header, CACHE_MAGIC[2])
+			|| !writeByte(&header, CACHE_MAGIC[3])
+			|| !writeNumber(&header, CACHE_VERSION)
+			|| !writeNumber(&header, hash)
+			|| !writeNumber(&header, length)
+			|| !writeNumber(&header, body.num)
+			|| !writeNumber(&header, hashSource((char *)body.data, body.num)))
+		goto saveMainNodeAbort;
+#ifdef HAVE_MKDIR
+	{
+		/* Make sure the directory exists */
+		const char *slash = strrchr(path, '/');
+		if (slash && slash != path) {
+			char *dir = malloc(sizeof(char) * (size_t)(slash - path + 1));
+			if (!dir) {
+				perror("malloc");
+				goto saveMainNodeAbort;
+			}
+			memcpy(dir, path, (size_t)(slash - path));
+			dir[slash - path] = '\0';
+			mkdir(dir, 0777);
+			free(dir);
+		}
+	}
+#endif
+#ifdef HAVE_GETPID
+	id = (long)getpid();
+#endif
+	temp = malloc(sizeof(char) * (strlen(path) + 32));
+	if (!temp) {
+		perror("malloc");
+		goto saveMainNodeAbort;
+	}
+	sprintf(temp, "%s.%ld.tmp", path, id);
+	file = fopen(temp, "wb");
+	if (!file) goto saveMainNodeAbort;
+	if (fwrite(header.data, 1, header.num, file) != header.num
+			|| fwrite(body.data, 1, body.num, file) != body.num) {
+		fclose(file);
+		remove(temp);
+		goto saveMainNodeAbort;
+	}
+	if (fclose(file) != 0 || rename(temp, path) != 0) {
+		remove(temp);
+		goto saveMainNodeAbort;
+	}
+	free(temp);
+	free(header.data);
+	free(body.data);
+	return 1;
+
+saveMainNodeAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	if (temp) free(temp);
+	if (header.data) free(header.data);
+	if (body.data) free(body.data);
+	return 0;
+}
+
+/**
+ * Reads an unsigned number from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] num The number read.
+ *
+ * \retval 0 The number is truncated or too large.
+ *
+ * \retval 1 \a num was read.
+ */
+static int readNumber(CacheReader *reader,
+                      unsigned long long *num)
+{
+	unsigned int shift = 0;
+	*num = 0;
+	while (reader->pos < reader->length && shift < 64) {
+		unsigned char byte = reader->data[reader->pos++];
+		*num |= (unsigned long long)(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) return 1;
+		shift += 7;
+	}
+	return 0;
+}
+
+/**
+ * Reads an unsigned number no greater than a maximum from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [in] max The largest valid number.
+ *
+ * \param [out] num The number read.
+ *
+ * \retval 0 The number is truncated or greater than \a max.
+ *
+ * \retval 1 \a num was read.
+ */
+static int readBoundedNumber(CacheReader *reader,
+                             unsigned long long max,
+                             unsigned int *num)
+{
+	unsigned long long n;
+	if (!readNumber(reader, &n) || n > max) return 0;
+	*num = (unsigned int)n;
+	return 1;
+}
+
+/**
+ * Reads a string from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] str The string read, which is interned.
+ *
+ * \retval 0 The string is truncated or memory allocation failed.
+ *
+ * \retval 1 \a str was read.
+ */
+static int readString(CacheReader *reader,
+                      char **str)
+{
+	unsigned long long len;
+	if (!readNumber(reader, &len)
+			|| len > reader->length - reader->pos)
+		return 0;
+	*str = internStringLength((const char *)reader->data + reader->pos, (size_t)len);
+	if (!*str) return 0;
+	reader->pos += (size_t)len;
+	return 1;
+}
+
+static int readExprNode(CacheReader *, ExprNode **);
+static int readBlockNode(CacheReader *, BlockNode **);
+
+/**
+ * Reads an identifier from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The identifier read (may be NULL).
+ *
+ * \retval 0 The identifier is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readIdentifierNode(CacheReader *reader,
+                              IdentifierNode **node)
+{
+	unsigned int present, type, named, line;
+	void *id = NULL;
+	IdentifierNode *slot = NULL;
+	*node = NULL;
+	if (!readBoundedNumber(reader, 1, &present)) return 0;
+	if (!present) return 1;
+	if (!readBoundedNumber(reader, IT_INDIRECT, &type)) return 0;
+	if (type == IT_DIRECT) {
+		char *name = NULL;
+		if (!readString(reader, &name)) return 0;
+		id = name;
+	}
+	else {
+		ExprNode *expr = NULL;
+		if (!readExprNode(reader, &expr) || !expr) return 0;
+		id = expr;
+	}
+	if (!readBoundedNumber(reader, 1, &named)
+			|| !readBoundedNumber(reader, (unsigned int)-1, &line)
+			|| !readIdentifierNode(reader, &slot))
+		return 0;
+	*node = createIdentifierNode(type, id, slot, named ? reader->fname : NULL, line);
+	return *node != NULL;
+}
+
+/**
+ * Reads an identifier list from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] list The identifier list read (may be NULL).
+ *
+ * \retval 0 The identifier list is invalid or memory allocation failed.
+ *
+ * \retval 1 \a list was read.
+ */
+static int readIdentifierNodeList(CacheReader *reader,
+                                  IdentifierNodeList **list)
+{
+	unsigned int num, n;
+	*list = NULL;
+	if (!readBoundedNumber(reader, reader->length, &num)) return 0;
+	if (!num) return 1;
+	if (!(*list = createIdentifierNodeList())) return 0;
+	for (n = 0; n < num - 1; n++) {
+		IdentifierNode *id = NULL;
+		if (!readIdentifierNode(reader, &id) || !id
+				|| !addIdentifierNode(*list, id))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Reads a type from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The type read (may be NULL).
+ *
+ * \retval 0 The type is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readTypeNode(CacheReader *reader,
+                        TypeNode **node)
+{
+	unsigned int type;
+	*node = NULL;
+	if (!readBoundedNumber(reader, CT_ARRAY + 1, &type)) return 0;
+	if (!type) return 1;
+	*node = createTypeNode(type - 1);
+	return *node != NULL;
+}
+
+/**
+ * Reads a constant from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The constant read.
+ *
+ * \retval 0 The constant is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readConstantNode(CacheReader *reader,
+                            ConstantNode **node)
+{
+	unsigned int type;
+	unsigned long long num;
+	*node = NULL;
+	if (!readBoundedNumber(reader, CT_STRING, &type)) return 0;
+	switch (type) {
+		case CT_INTEGER:
+			if (!readNumber(reader, &num)) return 0;
+			if (num & 1)
+				*node = createIntegerConstantNode((long long)~(num >> 1));
+			else
+				*node = createIntegerConstantNode((long long)(num >> 1));
+			break;
+		case CT_FLOAT: {
+			FloatBits bits;
+			if (!readNumber(reader, &num) || num > 0xffffffffULL) return 0;
+			bits.u = (unsigned int)num;
+			*node = createFloatConstantNode(bits.f);
+			break;
+		}
+		case CT_BOOLEAN:
+			if (!readNumber(reader, &num) || num > 1) return 0;
+			*node = createBooleanConstantNode((int)num);
+			break;
+		case CT_STRING: {
+			char *data = NULL;
+			if (!readString(reader, &data)) return 0;
+			*node = createStringConstantNode(data);
+			break;
+		}
+	}
+	return *node != NULL;
+}
+
+/**
+ * Reads an expression list from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] list The expression list read (may be NULL).
+ *
+ * \retval 0 The expression list is invalid or memory allocation failed.
+ *
+ * \retval 1 \a list was read.
+ */
+static int readExprNodeList(CacheReader *reader,
+                            ExprNodeList **list)
+{
+	unsigned int num, n;
+	*list = NULL;
+	if (!readBoundedNumber(reader, reader->length, &num)) return 0;
+	if (!num) return 1;
+	if (!(*list = createExprNodeList())) return 0;
+	for (n = 0; n < num - 1; n++) {
+		ExprNode *expr = NULL;
+		if (!readExprNode(reader, &expr) || !expr
+				|| !addExprNode(*list, expr))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Reads an expression from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The expression read (may be NULL).
+ *
+ * \retval 0 The expression is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readExprNode(CacheReader *reader,
+                        ExprNode **node)
+{
+	unsigned int type;
+	void *expr = NULL;
+	*node = NULL;
+	if (!readBoundedNumber(reader, ET_IMPVAR + 1, &type)) return 0;
+	if (!type) return 1;
+	switch (--type) {
+		case ET_CAST: {
+			ExprNode *target = NULL;
+			TypeNode *newtype = NULL;
+			if (!readExprNode(reader, &target)
+					|| !readTypeNode(reader, &newtype))
+				return 0;
+			expr = createCastExprNode(target, newtype);
+			break;
+		}
+		case ET_CONSTANT: {
+			ConstantNode *constant = NULL;
+			if (!readConstantNode(reader, &constant)) return 0;
+			expr = constant;
+			break;
+		}
+		case ET_IDENTIFIER: {
+			IdentifierNode *id = NULL;
+			if (!readIdentifierNode(reader, &id)) return 0;
+			expr = id;
+			break;
+		}
+		case ET_FUNCCALL: {
+			IdentifierNode *scope = NULL;
+			IdentifierNode *name = NULL;
+			ExprNodeList *args = NULL;
+			if (!readIdentifierNode(reader, &scope)
+					|| !readIdentifierNode(reader, &name)
+					|| !readExprNodeList(reader, &args))
+				return 0;
+			expr = createFuncCallExprNode(scope, name, args);
+			break;
+		}
+		case ET_OP: {
+			unsigned int op;
+			ExprNodeList *args = NULL;
+			if (!readBoundedNumber(reader, OP_CAT, &op)
+					|| !readExprNodeList(reader, &args))
+				return 0;
+			expr = createOpExprNode(op, args);
+			break;
+		}
+		case ET_IMPVAR:
+			*node = createExprNode(ET_IMPVAR, NULL);
+			return *node != NULL;
+	}
+	if (!expr) return 0;
+	*node = createExprNode(type, expr);
+	return *node != NULL;
+}
+
+/**
+ * Reads a code block list from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] list The code block list read (may be NULL).
+ *
+ * \retval 0 The code block list is invalid or memory allocation failed.
+ *
+ * \retval 1 \a list was read.
+ */
+static int readBlockNodeList(CacheReader *reader,
+                             BlockNodeList **list)
+{
+	unsigned int num, n;
+	*list = NULL;
+	if (!readBoundedNumber(reader, reader->length, &num)) return 0;
+	if (!num) return 1;
+	if (!(*list = createBlockNodeList())) return 0;
+	for (n = 0; n < num - 1; n++) {
+		BlockNode *block = NULL;
+		if (!readBlockNode(reader, &block) || !block
+				|| !addBlockNode(*list, block))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Reads a statement from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The statement read.
+ *
+ * \retval 0 The statement is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readStmtNode(CacheReader *reader,
+                        StmtNode **node)
+{
+	unsigned int type, line;
+	void *stmt = NULL;
+	*node = NULL;
+	if (!readBoundedNumber(reader, ST_ALTARRAYDEF, &type)
+			|| !readBoundedNumber(reader, (unsigned int)-1, &line))
+		return 0;
+	switch (type) {
+		case ST_CAST: {
+			IdentifierNode *target = NULL;
+			TypeNode *newtype = NULL;
+			if (!readIdentifierNode(reader, &target)
+					|| !readTypeNode(reader, &newtype))
+				return 0;
+			stmt = createCastStmtNode(target, newtype);
+			break;
+		}
+		case ST_PRINT: {
+			ExprNodeList *args = NULL;
+			unsigned int err, nonl;
+			if (!readExprNodeList(reader, &args)
+					|| !readBoundedNumber(reader, 1, &err)
+					|| !readBoundedNumber(reader, 1, &nonl))
+				return 0;
+			stmt = createPrintStmtNode(args, err ? stderr : stdout, nonl);
+			break;
+		}
+		case ST_INPUT: {
+			IdentifierNode *target = NULL;
+			if (!readIdentifierNode(reader, &target)) return 0;
+			stmt = createInputStmtNode(target);
+			break;
+		}
+		case ST_ASSIGNMENT: {
+			IdentifierNode *target = NULL;
+			ExprNode *expr = NULL;
+			if (!readIdentifierNode(reader, &target)
+					|| !readExprNode(reader, &expr))
+				return 0;
+			stmt = createAssignmentStmtNode(target, expr);
+			break;
+		}
+		case ST_DECLARATION: {
+			IdentifierNode *scope = NULL;
+			IdentifierNode *target = NULL;
+			ExprNode *expr = NULL;
+			TypeNode *newtype = NULL;
+			IdentifierNode *parent = NULL;
+			if (!readIdentifierNode(reader, &scope)
+					|| !readIdentifierNode(reader, &target)
+					|| !readExprNode(reader, &expr)
+					|| !readTypeNode(reader, &newtype)
+					|| !readIdentifierNode(reader, &parent))
+				return 0;
+			stmt = createDeclarationStmtNode(scope, target, expr, newtype, parent);
+			break;
+		}
+		case ST_IFTHENELSE: {
+			BlockNode *yes = NULL;
+			BlockNode *no = NULL;
+			ExprNodeList *guards = NULL;
+			BlockNodeList *blocks = NULL;
+			if (!readBlockNode(reader, &yes)
+					|| !readBlockNode(reader, &no)
+					|| !readExprNodeList(reader, &guards)
+					|| !readBlockNodeList(reader, &blocks))
+				return 0;
+			stmt = createIfThenElseStmtNode(yes, no, guards, blocks);
+			break;
+		}
+		case ST_SWITCH: {
+			ExprNodeList *guards = NULL;
+			BlockNodeList *blocks = NULL;
+			BlockNode *def = NULL;
+			if (!readExprNodeList(reader, &guards)
+					|| !readBlockNodeList(reader, &blocks)
+					|| !readBlockNode(reader, &def))
+				return 0;
+			stmt = createSwitchStmtNode(guards, blocks, def);
+			break;
+		}
+		case ST_BREAK:
+			if (!(*node = createStmtNode(ST_BREAK, NULL))) return 0;
+			(*node)->line = line;
+			return 1;
+		case ST_RETURN: {
+			ExprNode *value = NULL;
+			if (!readExprNode(reader, &value)) return 0;
+			stmt = createReturnStmtNode(value);
+			break;
+		}
+		case ST_LOOP: {
+			IdentifierNode *name = NULL;
+			IdentifierNode *var = NULL;
+			ExprNode *guard = NULL;
+			ExprNode *update = NULL;
+			BlockNode *body = NULL;
+			if (!readIdentifierNode(reader, &name)
+					|| !readIdentifierNode(reader, &var)
+					|| !readExprNode(reader, &guard)
+					|| !readExprNode(reader, &update)
+					|| !readBlockNode(reader, &body))
+				return 0;
+			stmt = createLoopStmtNode(name, var, guard, update, body);
+			break;
+		}
+		case ST_DEALLOCATION: {
+			IdentifierNode *target = NULL;
+			if (!readIdentifierNode(reader, &target)) return 0;
+			stmt = createDeallocationStmtNode(target);
+			break;
+		}
+		case ST_FUNCDEF: {
+			IdentifierNode *scope = NULL;
+			IdentifierNode *name = NULL;
+			IdentifierNodeList *args = NULL;
+			BlockNode *body = NULL;
+			if (!readIdentifierNode(reader, &scope)
+					|| !readIdentifierNode(reader, &name)
+					|| !readIdentifierNodeList(reader, &args)
+					|| !readBlockNode(reader, &body))
+				return 0;
+			stmt = createFuncDefStmtNode(scope, name, args, body);
+			break;
+		}
+		case ST_EXPR: {
+			ExprNode *expr = NULL;
+			if (!readExprNode(reader, &expr)) return 0;
+			stmt = expr;
+			break;
+		}
+		case ST_ALTARRAYDEF: {
+			IdentifierNode *name = NULL;
+			BlockNode *body = NULL;
+			IdentifierNode *parent = NULL;
+			if (!readIdentifierNode(reader, &name)
+					|| !readBlockNode(reader, &body)
+					|| !readIdentifierNode(reader, &parent))
+				return 0;
+			stmt = createAltArrayDefStmtNode(name, body, parent);
+			break;
+		}
+	}
+	if (!stmt) return 0;
+	if (!(*node = createStmtNode(type, stmt))) return 0;
+	(*node)->line = line;
+	return 1;
+}
+
+/**
+ * Reads a code block from a cache reader.
+ *
+ * \param [in,out] reader The reader to read from.
+ *
+ * \param [out] node The code block read (may be NULL).
+ *
+ * \retval 0 The code block is invalid or memory allocation failed.
+ *
+ * \retval 1 \a node was read.
+ */
+static int readBlockNode(CacheReader *reader,
+                         BlockNode **node)
+{
+	StmtNodeList *stmts = NULL;
+	unsigned int num, n;
+	*node = NULL;
+	if (!readBoundedNumber(reader, reader->length, &num)) return 0;
+	if (!num) return 1;
+	if (!(stmts = createStmtNodeList())) return 0;
+	for (n = 0; n < num - 1; n++) {
+		StmtNode *stmt = NULL;
+		if (!readStmtNode(reader, &stmt) || !addStmtNode(stmts, stmt))
+			return 0;
+	}
+	*node = createBlockNode(stmts);
+	return *node != NULL;
+}
+
+/**
+ * Loads a parse tree from a cache file.
+ *
+ * \param [in] path The path of the cache file.
+ *
+ * \param [in] hash The hash of the current source.
+ *
+ * \param [in] length The length of the current source.
+ *
+ * \param [in] fname The name of the source file, which the identifiers of the
+ * parse tree refer to.
+ *
+ * \return The parse tree stored in \a path, allocated from an arena as if it
+ * had been created by parseMainNode().
+ *
+ * \retval NULL The cache file does not exist, is invalid, or was created from
+ * a different source.
+ */
+MainNode *loadMainNode(const char *path,
+                       unsigned long long hash,
+                       size_t length,
+                       const char *fname)
+{
+	CacheReader reader;
+	unsigned long long version, srchash, srclen, bodylen, bodyhash;
+	unsigned char *data = NULL;
+	size_t size = 0;
+	size_t mapped = 0;
+	BlockNode *block = NULL;
+	MainNode *_main = NULL;
+	FILE *file = fopen(path, "rb");
+	if (!file) return NULL;
+#ifdef HAVE_MMAP
+	{
+		struct stat st;
+		if (!fstat(fileno(file), &st) && S_ISREG(st.st_mode)
+				&& st.st_size > 0) {
+			void *mem = mmap(NULL, (size_t)st.st_size, PROT_READ,
+					MAP_PRIVATE, fileno(file), 0);
+			if (mem != MAP_FAILED) {
+				data = mem;
+				size = mapped = (size_t)st.st_size;
+			}
+		}
+	}
+#endif
+	if (!data) {
+		/* Read the whole file instead */
+		size_t max = 0;
+		while (!feof(file) && !ferror(file)) {
+			if (size == max) {
+				void *mem = NULL;
+				max = max ? max * 2 : CACHE_WRITER_SIZE;
+				mem = realloc(data, max);
+				if (!mem) {
+					perror("realloc");
+					free(data);
+					fclose(file);
+					return NULL;
+				}
+				data = mem;
+			}
+			size += fread(data + size, 1, max - size, file);
+		}
+	}
+	fclose(file);
+	reader.data = data;
+	reader.pos = 4;
+	reader.length = size;
+	reader.fname = fname;
+	reader.arena = NULL;
+	/* Check that the cache file is valid and up to date */
+	if (size < 4 || memcmp(data, CACHE_MAGIC, 4)
+			|| !readNumber(&reader, &version)
+			|| version != CACHE_VERSION
+			|| !readNumber(&reader, &srchash)
+			|| srchash != hash
+			|| !readNumber(&reader, &srclen)
+			|| srclen != length
+			|| !readNumber(&reader, &bodylen)
+			|| !readNumber(&reader, &bodyhash)
+			|| bodylen != size - reader.pos
+			|| bodyhash != hashSource((char *)data + reader.pos, size - reader.pos))
+		goto loadMainNodeAbort;
+	/* Build the parse tree the same way the parser does */
+	reader.arena = createMemoryArena();
+	if (!reader.arena) goto loadMainNodeAbort;
+	setNodeArena(reader.arena);
+	if (!readBlockNode(&reader, &block) || !block
+			|| reader.pos != reader.length)
+		goto loadMainNodeAbort;
+	_main = createMainNode(block);
+	if (!_main) goto loadMainNodeAbort;
+	_main->arena = reader.arena;
+	setNodeArena(NULL);
+#ifdef HAVE_MMAP
+	if (mapped) munmap(data, mapped);
+	else
+#endif
+	free(data);
+	return _main;
+
+loadMainNodeAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	setNodeArena(NULL);
+	deleteMemoryArena(reader.arena);
+#ifdef HAVE_MMAP
+	if (mapped) munmap(data, mapped);
+	else
+#endif
+	free(data);
+	return NULL;
+}
@@ -0,0 +1,83 @@
+/**
+ * Structures and functions for saving parse trees to files and loading them
+ * back.  A cache file holds a compact serialization of the parse tree of a
+ * source file along with a hash of the source it was parsed from, so a program
+ * which is run repeatedly only needs to be lexed, tokenized, and parsed once.
+ * A cache file whose hash does not match the source is ignored.
+ *
+ * Numbers are stored as variable-length unsigned integers (seven bits per byte,
+ * least significant first) so cache files do not depend on the byte order or
+ * word size of the machine that wrote them.
+ *
+ * \file   cache.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __CACHE_H__
+#define __CACHE_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parser.h"
+#include "memory.h"
+
+/**
+ * The characters every cache file begins with.
+ */
+#define CACHE_MAGIC "LOLC"
+
+/**
+ * The version of the cache file format.  This must be incremented whenever the
+ * parse tree or its serialization changes.
+ */
+#define CACHE_VERSION 2
+
+/**
+ * The name of the directory cache files are stored in, next to the source
+ * files they are created from.
+ */
+#define CACHE_DIRECTORY "__lolcache__"
+
+/**
+ * The file name extension of cache files.
+ */
+#define CACHE_EXTENSION ".lolc"
+
+/**
+ * Stores a serialized parse tree as it is written.
+ */
+typedef struct {
+	unsigned char *data; /**< The serialized bytes. */
+	size_t num;          /**< The number of bytes written. */
+	size_t size;         /**< The number of bytes there is space for. */
+} CacheWriter;
+
+/**
+ * Stores a serialized parse tree as it is read.
+ */
+typedef struct {
+	const unsigned char *data; /**< The serialized bytes. */
+	size_t pos;                /**< The position of the next byte to read. */
+	size_t length;             /**< The number of bytes in \a data. */
+	const char *fname;         /**< The name of the source file. */
+	MemoryArena *arena;        /**< The arena the parse tree is allocated from. */
+} CacheReader;
+
+/**
+ * \name Cache files
+ *
+ * Functions for saving and loading parse trees.
+ */
+/**@{*/
+unsigned long long hashSource(const char *, size_t);
+char *getCachePath(const char *, const char *);
+int saveMainNode(const char *, MainNode *, unsigned long long, size_t);
+MainNode *loadMainNode(const char *, unsigned long long, size_t, const char *);
+/**@}*/
+
+#endif /* __CACHE_H__ */
@@ -1,7 +1,7 @@
 INCLUDE(ParseArguments)
 
 FUNCTION(ADD_LOL_TEST TEST_NAME)
-  PARSE_ARGUMENTS(ARG "LOLCODE;OUTPUT;INPUT" "ERROR" ${ARGN})
+  PARSE_ARGUMENTS(ARG "LOLCODE;OUTPUT;ERROR_OUTPUT;INPUT;ARGS" "ERROR" ${ARGN})
 
   IF(NOT ARG_LOLCODE)
     SET(ARG_LOLCODE ${CMAKE_CURRENT_SOURCE_DIR}/test.lol)
@@ -13,6 +13,10 @@ FUNCTION(ADD_LOL_TEST TEST_NAME)
     LIST(APPEND TEST_COMMAND -o=${CMAKE_CURRENT_SOURCE_DIR}/${ARG_OUTPUT})
   ENDIF(ARG_OUTPUT)
 
+  IF(ARG_ERROR_OUTPUT)
+    LIST(APPEND TEST_COMMAND -r=${CMAKE_CURRENT_SOURCE_DIR}/${ARG_ERROR_OUTPUT})
+  ENDIF(ARG_ERROR_OUTPUT)
+
   IF(ARG_INPUT)
     LIST(APPEND TEST_COMMAND -i=${CMAKE_CURRENT_SOURCE_DIR}/${ARG_INPUT})
   ENDIF(ARG_INPUT)
@@ -21,10 +25,17 @@ FUNCTION(ADD_LOL_TEST TEST_NAME)
     LIST(APPEND TEST_COMMAND -e)
   ENDIF(ARG_ERROR)
 
+  FOREACH(ARG_ARG ${ARG_ARGS})
+    LIST(APPEND TEST_COMMAND -a=${ARG_ARG})
+  ENDFOREACH(ARG_ARG)
+
   IF(PERFORM_MEM_TESTS)
     LIST(APPEND TEST_COMMAND -m)
   ENDIF(PERFORM_MEM_TESTS)
 
   ADD_TEST(NAME ${TEST_NAME} COMMAND ${TEST_COMMAND})
 
+  # Run the same test on the bytecode virtual machine
+  ADD_TEST(NAME ${TEST_NAME}-vm COMMAND ${TEST_COMMAND} -a=--engine=vm)
+
 ENDFUNCTION()
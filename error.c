@@ -5,6 +5,8 @@ static const char *err_msgs[] = {
 	"Error opening file '%s'.\n",
 	/* MN_ERROR_CLOSING_FILE */
 	"Error closing file '%s'.\n",
+	/* MN_ERROR_WRITING_CACHE */
+	"Error writing cache file '%s'.\n",
 
 	/* LX_LINE_CONTINUATION */
 	"%s:%d: a line with continuation may not be followed by an empty line\n",
@@ -147,12 +149,18 @@ static const char *err_msgs[] = {
 	"%s:%u: function name already used by existing variable at: %s\n",
 	/* IN_CANNOT_CAST_VALUE_TO_ARRAY */
 	"%s:%u: cannot cast value to array at: %s\n",
+
+	/* UN_INVALID_NORMATIVE_NAME */
+	"Invalid Unicode normative name.\n",
+	/* UN_INVALID_CODE_POINT */
+	"Invalid Unicode code point.\n",
 };
 
 static const int err_codes[] = {
 	/* The 100 block is for the main body */
 	100, /* MN_ERROR_OPENING_FILE */
 	101, /* MN_ERROR_CLOSING_FILE */
+	102, /* MN_ERROR_WRITING_CACHE */
 
 	/* The 200 block is for the lexer */
 	200, /* LX_LINE_CONTINUATION */
@@ -183,60 +191,194 @@ static const int err_codes[] = {
 	415, /* PR_CANNOT_USE_STR_AS_LITERAL */
 	416, /* PR_LITERAL_MUST_BE_UNIQUE */
 	417, /* PR_EXPECTED_LOOP_NAME */
-	418, /* PR_EXPECTED_ONE_OF */
+	418, /* PR_EXPECTED_EITHER_TOKEN */
 	419, /* PR_EXPECTED_UNARY_FUNCTION */
 	420, /* PR_EXPECTED_MATCHING_LOOP_NAME */
 	421, /* PR_EXPECTED_STATEMENT */
 
+	/*
+	 * PR_UNHANDLED_STRING was long missing from this table, which gave it
+	 * 500 and moved each interpreter error up by one.  Programs may rely
+	 * on the exit codes this produced, so they are kept.
+	 */
+	500, /* PR_UNHANDLED_STRING */
+
 	/* The 500 block is for the interpreter */
-	500, /* IN_INVALID_IDENTIFIER_TYPE */
-	501, /* IN_UNABLE_TO_STORE_VARIABLE */
-	502, /* IN_VARIABLE_DOES_NOT_EXIST */
-	503, /* IN_CANNOT_IMPLICITLY_CAST_NIL */
-	504, /* IN_CANNOT_CAST_FUNCTION_TO_BOOLEAN */
-	505, /* IN_CANNOT_CAST_ARRAY_TO_BOOLEAN */
-	506, /* IN_UNKNOWN_VALUE_DURING_BOOLEAN_CAST */
-	507, /* IN_UNABLE_TO_CAST_VALUE */
-	508, /* IN_EXPECTED_INTEGER_VALUE */
-	509, /* IN_CANNOT_CAST_FUNCTION_TO_INTEGER */
-	510, /* IN_CANNOT_CAST_ARRAY_TO_INTEGER */
-	511, /* IN_UNKNOWN_VALUE_DURING_INTEGER_CAST */
-	512, /* IN_EXPECTED_DECIMAL */
-	513, /* IN_CANNOT_CAST_FUNCTION_TO_DECIMAL */
-	514, /* IN_CANNOT_CAST_ARRAY_TO_DECIMAL */
-	515, /* IN_UNKNOWN_VALUE_DURING_DECIMAL_CAST */
-	516, /* IN_CANNOT_CAST_BOOLEAN_TO_STRING */
-	517, /* IN_EXPECTED_CLOSING_PAREN */
-	518, /* IN_INVALID_HEX_NUMBER */
-	519, /* IN_CODE_POINT_MUST_BE_POSITIVE */
-	520, /* IN_EXPECTED_CLOSING_SQUARE_BRACKET */
-	521, /* IN_EXPECTED_CLOSING_CURLY_BRACE */
-	522, /* IN_VARIABLE_NOT_AN_ARRAY */
-	523, /* IN_CANNOT_CAST_FUNCTION_TO_STRING */
-	524, /* IN_CANNOT_CAST_ARRAY_TO_STRING */
-	525, /* IN_UNKNOWN_VALUE_DURING_STRING_CAST */
-	526, /* IN_UNKNOWN_CAST_TYPE */
-	527, /* IN_UNDEFINED_FUNCTION */
-	528, /* IN_INCORRECT_NUMBER_OF_ARGUMENTS */
-	529, /* IN_INVALID_RETURN_TYPE */
-	530, /* IN_UNKNOWN_CONSTANT_TYPE */
-	531, /* IN_DIVISION_BY_ZERO */
-	532, /* IN_INVALID_OPERAND_TYPE */
-	533, /* IN_INVALID_BOOLEAN_OPERATION_TYPE */
-	534, /* IN_INVALID_EQUALITY_OPERATION_TYPE */
-	535, /* IN_REDEFINITION_OF_VARIABLE */
-	536, /* IN_INVALID_DECLARATION_TYPE */
-	537, /* IN_INVALID_TYPE */
-	538, /* IN_FUNCTION_NAME_USED_BY_VARIABLE */
-	539, /* IN_CANNOT_CAST_VALUE_TO_ARRAY */
+	501, /* IN_INVALID_IDENTIFIER_TYPE */
+	502, /* IN_UNABLE_TO_STORE_VARIABLE */
+	503, /* IN_VARIABLE_DOES_NOT_EXIST */
+	504, /* IN_CANNOT_IMPLICITLY_CAST_NIL */
+	505, /* IN_CANNOT_CAST_FUNCTION_TO_BOOLEAN */
+	506, /* IN_CANNOT_CAST_ARRAY_TO_BOOLEAN */
+	507, /* IN_UNKNOWN_VALUE_DURING_BOOLEAN_CAST */
+	508, /* IN_UNABLE_TO_CAST_VALUE */
+	509, /* IN_EXPECTED_INTEGER_VALUE */
+	510, /* IN_CANNOT_CAST_FUNCTION_TO_INTEGER */
+	511, /* IN_CANNOT_CAST_ARRAY_TO_INTEGER */
+	512, /* IN_UNKNOWN_VALUE_DURING_INTEGER_CAST */
+	513, /* IN_EXPECTED_DECIMAL */
+	514, /* IN_CANNOT_CAST_FUNCTION_TO_DECIMAL */
+	515, /* IN_CANNOT_CAST_ARRAY_TO_DECIMAL */
+	516, /* IN_UNKNOWN_VALUE_DURING_DECIMAL_CAST */
+	517, /* IN_CANNOT_CAST_BOOLEAN_TO_STRING */
+	518, /* IN_EXPECTED_CLOSING_PAREN */
+	519, /* IN_INVALID_HEX_NUMBER */
+	520, /* IN_CODE_POINT_MUST_BE_POSITIVE */
+	521, /* IN_EXPECTED_CLOSING_SQUARE_BRACKET */
+	522, /* IN_EXPECTED_CLOSING_CURLY_BRACE */
+	523, /* IN_VARIABLE_NOT_AN_ARRAY */
+	524, /* IN_CANNOT_CAST_FUNCTION_TO_STRING */
+	525, /* IN_CANNOT_CAST_ARRAY_TO_STRING */
+	526, /* IN_UNKNOWN_VALUE_DURING_STRING_CAST */
+	527, /* IN_UNKNOWN_CAST_TYPE */
+	528, /* IN_UNDEFINED_FUNCTION */
+	529, /* IN_INCORRECT_NUMBER_OF_ARGUMENTS */
+	530, /* IN_INVALID_RETURN_TYPE */
+	531, /* IN_UNKNOWN_CONSTANT_TYPE */
+	532, /* IN_DIVISION_BY_ZERO */
+	533, /* IN_INVALID_OPERAND_TYPE */
+	534, /* IN_INVALID_BOOLEAN_OPERATION_TYPE */
+	535, /* IN_INVALID_EQUALITY_OPERATION_TYPE */
+	536, /* IN_REDEFINITION_OF_VARIABLE */
+	537, /* IN_INVALID_DECLARATION_TYPE */
+	538, /* IN_INVALID_TYPE */
+	539, /* IN_FUNCTION_NAME_USED_BY_VARIABLE */
+	540, /* IN_CANNOT_CAST_VALUE_TO_ARRAY */
+
+	/*
+	 * Unicode conversion errors only explain the error of the caller,
+	 * whose code is the exit code, so they have none of their own
+	 */
+	0, /* UN_INVALID_NORMATIVE_NAME */
+	0, /* UN_INVALID_CODE_POINT */
 };
 
+/**
+ * The exit code of the first error reported by this thread since its errors
+ * were last cleared (0 if there has been none).
+ */
+static THREAD_LOCAL int ErrorCode = 0;
+
+/**
+ * The file this thread writes error messages to (NULL for standard error).
+ */
+static THREAD_LOCAL FILE *ErrorFile = NULL;
+
+/**
+ * The functions this thread performs input and output with (NULL for the
+ * standard streams).
+ */
+static THREAD_LOCAL const IoHandler *Io = NULL;
+
+/**
+ * Prints an error message and records its exit code.  Only the first error is
+ * recorded, since any that follow it are usually caused by it.
+ *
+ * \param [in] e The type of error to report.
+ *
+ * \param [in] ... The values to format the error message with.
+ *
+ * \post getErrorCode() will return the exit code of the first error reported.
+ */
 void error(ErrorType e, ...)
 {
 	va_list args;
-	va_start(args, e);
-	vfprintf(stderr, err_msgs[e], args);
-	va_end(args);
+	if (Io && Io->write) {
+		/* Format the message to pass it to the handler */
+		char buf[256];
+		char *msg = buf;
+		int len;
+		va_start(args, e);
+		len = vsnprintf(buf, sizeof(buf), err_msgs[e], args);
+		va_end(args);
+		if (len >= (int)sizeof(buf)) {
+			msg = malloc((size_t)len + 1);
+			if (msg) {
+				va_start(args, e);
+				vsnprintf(msg, (size_t)len + 1, err_msgs[e], args);
+				va_end(args);
+			}
+			else {
+				/* Pass on as much of the message as fits */
+				msg = buf;
+				len = (int)sizeof(buf) - 1;
+			}
+		}
+		if (len > 0) Io->write(Io->data, 1, msg, (size_t)len);
+		if (msg != buf) free(msg);
+	}
+	else {
+		va_start(args, e);
+		vfprintf(getErrorFile(), err_msgs[e], args);
+		va_end(args);
+	}
+
+	if (!ErrorCode) ErrorCode = err_codes[e];
+}
+
+/**
+ * Gets the exit code of the first error reported by this thread.
+ *
+ * \return The exit code of the first error reported since clearErrorCode()
+ * was last called (0 if none has been reported).
+ */
+int getErrorCode(void)
+{
+	return ErrorCode;
+}
+
+/**
+ * Forgets the errors reported by this thread, such as before running another
+ * program.
+ *
+ * \post getErrorCode() will return 0.
+ */
+void clearErrorCode(void)
+{
+	ErrorCode = 0;
+}
+
+/**
+ * Sets the file this thread writes error messages to.
+ *
+ * \param [in] file The file to write error messages to (NULL for standard
+ * error).
+ */
+void setErrorFile(FILE *file)
+{
+	ErrorFile = file;
+}
+
+/**
+ * Gets the file this thread writes error messages to.
+ *
+ * \return The file error messages are written to.
+ */
+FILE *getErrorFile(void)
+{
+	return ErrorFile ? ErrorFile : stderr;
+}
+
+/**
+ * Sets the functions this thread performs input and output with.  Output and
+ * errors which would be written to the standard streams, and input which would
+ * be read from standard input, are passed to \a io instead.
+ *
+ * \param [in] io The functions to use (NULL for the standard streams).
+ */
+void setIoHandler(const IoHandler *io)
+{
+	Io = io;
+}
 
-	exit(err_codes[e]);
+/**
+ * Gets the functions this thread performs input and output with.
+ *
+ * \return The functions set with setIoHandler().
+ *
+ * \retval NULL The standard streams are used.
+ */
+const IoHandler *getIoHandler(void)
+{
+	return Io;
 }
@@ -15,6 +15,23 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+/**
+ * Marks a static variable as having a separate instance in each thread.  Each
+ * stage of the interpreter keeps its state (memory pools, interned strings,
+ * the current error, and so on) in such variables, so separate threads may run
+ * separate programs at the same time.  \c NO_THREAD_LOCAL is defined when the
+ * compiler does not support thread-local storage, in which case only one
+ * thread may run at a time.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#define NO_THREAD_LOCAL
+#endif
+
 /**
  * Represents an error type.  The error types are organized based on which
  * module they occur in:
@@ -23,7 +40,8 @@
  *   - LX_* for the lexer,
  *   - TK_* for the tokenizer,
  *   - PR_* for the parser,
- *   - IN_* for the interpreter
+ *   - IN_* for the interpreter,
+ *   - UN_* for Unicode conversions
  *
  * \note Remember to update the error message and error code arrays (in the
  * error C file) with the appropriate error message and code.
@@ -31,6 +49,7 @@
 typedef enum {
 	MN_ERROR_OPENING_FILE,
 	MN_ERROR_CLOSING_FILE,
+	MN_ERROR_WRITING_CACHE,
 
 	LX_LINE_CONTINUATION,
 	LX_MULTIPLE_LINE_COMMENT,
@@ -104,8 +123,36 @@ typedef enum {
 	IN_INVALID_TYPE,
 	IN_FUNCTION_NAME_USED_BY_VARIABLE,
 	IN_CANNOT_CAST_VALUE_TO_ARRAY,
+
+	UN_INVALID_NORMATIVE_NAME,
+	UN_INVALID_CODE_POINT,
 } ErrorType;
 
+/**
+ * Stores functions which perform the input and output of a program in place of
+ * the standard streams, such as for a program embedded in another.
+ */
+typedef struct {
+	void *data;                                        /**< The data passed to each function. */
+	size_t (*write)(void *, int, const char *, size_t); /**< Writes characters to output (0) or errors (1). */
+	int (*read)(void *);                               /**< Reads the next character of input (EOF at the end). */
+} IoHandler;
+
+/**
+ * \name Error reporting
+ *
+ * Functions for reporting errors and retrieving them afterwards.  Errors do
+ * not end the process; the function reporting one returns a failure which is
+ * passed up to the caller of the stage it occurred in.
+ */
+/**@{*/
 void error(ErrorType, ...);
+int getErrorCode(void);
+void clearErrorCode(void);
+void setErrorFile(FILE *);
+FILE *getErrorFile(void);
+void setIoHandler(const IoHandler *);
+const IoHandler *getIoHandler(void);
+/**@}*/
 
 #endif /* __ERROR_H__ */
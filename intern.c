@@ -0,0 +1,234 @@
+#include "intern.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/**
+ * The set of interned strings.  It is shared by every thread, so a parse tree
+ * made by one thread may be executed by another.
+ */
+static InternTable Atoms = { NULL, 0, 0, NULL };
+
+#ifdef HAVE_PTHREAD
+/**
+ * Guards \a Atoms.
+ */
+static pthread_mutex_t AtomsLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Locks the intern table.
+ */
+static void lockInternTable(void)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&AtomsLock);
+#endif
+}
+
+/**
+ * Unlocks the intern table.
+ */
+static void unlockInternTable(void)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&AtomsLock);
+#endif
+}
+
+/**
+ * Hashes some characters.
+ *
+ * \param [in] data The characters to hash.
+ *
+ * \param [in] len The number of characters in \a data.
+ *
+ * \return The FNV-1a hash of \a data.
+ */
+unsigned int hashCharacters(const char *data,
+                            size_t len)
+{
+	unsigned int hash = 2166136261u;
+	size_t n;
+	for (n = 0; n < len; n++) {
+		hash ^= (unsigned char)data[n];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Finds the entry of the intern table which holds, or would hold, an atom.
+ *
+ * \param [in] data The characters of the atom.
+ *
+ * \param [in] len The number of characters in \a data.
+ *
+ * \param [in] hash The hash of \a data.
+ *
+ * \pre The intern table has at least one empty entry.
+ *
+ * \return The entry holding the atom equal to \a data, or the empty entry it
+ * would be stored in.
+ */
+static char **findAtomEntry(const char *data,
+                            size_t len,
+                            unsigned int hash)
+{
+	unsigned int mask = Atoms.size - 1;
+	unsigned int h = hash & mask;
+	while (Atoms.atoms[h]) {
+		char *atom = Atoms.atoms[h];
+		if (!strncmp(atom, data, len) && atom[len] == '\0') break;
+		h = (h + 1) & mask;
+	}
+	return &Atoms.atoms[h];
+}
+
+/**
+ * Doubles the number of entries in the intern table, or creates it.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The table was grown successfully.
+ */
+static int growInternTable(void)
+{
+	char **old = Atoms.atoms;
+	unsigned int size = Atoms.size;
+	unsigned int n;
+	if (!Atoms.arena) {
+		Atoms.arena = createMemoryArena();
+		if (!Atoms.arena) return 0;
+	}
+	Atoms.size = size ? size * 2 : INTERN_TABLE_SIZE;
+	Atoms.atoms = calloc(Atoms.size, sizeof(char *));
+	if (!Atoms.atoms) {
+		perror("calloc");
+		Atoms.atoms = old;
+		Atoms.size = size;
+		return 0;
+	}
+	for (n = 0; n < size; n++) {
+		if (old[n]) *findAtomEntry(old[n], strlen(old[n]), getNameHash(old[n])) = old[n];
+	}
+	free(old);
+	return 1;
+}
+
+/**
+ * Interns some characters.
+ *
+ * \param [in] data The characters to intern, which need not be terminated.
+ *
+ * \param [in] len The number of characters in \a data.
+ *
+ * \return The atom equal to the first \a len characters of \a data.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+char *internStringLength(const char *data,
+                         size_t len)
+{
+	unsigned int hash = hashCharacters(data, len);
+	NameHeader *header = NULL;
+	char **entry = NULL;
+	char *atom = NULL;
+	lockInternTable();
+	/* Keep the table at most half full */
+	if ((Atoms.num + 1) * 2 > Atoms.size && !growInternTable())
+		goto internStringLengthAbort;
+	entry = findAtomEntry(data, len, hash);
+	if (*entry) {
+		atom = *entry;
+		unlockInternTable();
+		return atom;
+	}
+	header = allocateArenaObject(Atoms.arena, sizeof(NameHeader) + len + 1);
+	if (!header) goto internStringLengthAbort;
+	header->hash = hash;
+	header->atom = 1;
+	atom = (char *)(header + 1);
+	memcpy(atom, data, len);
+	atom[len] = '\0';
+	*entry = atom;
+	Atoms.num++;
+	unlockInternTable();
+	return atom;
+
+internStringLengthAbort: /* Exception handling */
+
+	unlockInternTable();
+	return NULL;
+}
+
+/**
+ * Interns a string.
+ *
+ * \param [in] str The string to intern.
+ *
+ * \return The atom equal to \a str.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+char *internString(const char *str)
+{
+	return internStringLength(str, strlen(str));
+}
+
+/**
+ * Deletes the intern table.
+ *
+ * \pre No other thread is using the intern table.
+ *
+ * \post The memory of every atom will be freed.
+ */
+void deleteInternTable(void)
+{
+	lockInternTable();
+	free(Atoms.atoms);
+	deleteMemoryArena(Atoms.arena);
+	Atoms.atoms = NULL;
+	Atoms.num = 0;
+	Atoms.size = 0;
+	Atoms.arena = NULL;
+	unlockInternTable();
+}
+
+/**
+ * Copies a name without interning it, so that it may be freed once it is no
+ * longer used.
+ *
+ * \param [in] str The name to copy.
+ *
+ * \return A copy of \a str which is not an atom.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+char *copyName(const char *str)
+{
+	size_t len = strlen(str);
+	NameHeader *header = malloc(sizeof(NameHeader) + len + 1);
+	if (!header) {
+		perror("malloc");
+		return NULL;
+	}
+	header->hash = hashCharacters(str, len);
+	header->atom = 0;
+	memcpy(header + 1, str, len + 1);
+	return (char *)(header + 1);
+}
+
+/**
+ * Deletes a name if it is a copy.
+ *
+ * \param [in,out] name The name to delete.
+ *
+ * \post The memory at \a name will be freed unless it is an atom.
+ */
+void deleteName(char *name)
+{
+	if (!name || isAtom(name)) return;
+	free(getNameHeader(name));
+}
@@ -0,0 +1,90 @@
+/**
+ * Structures and functions for interning strings.  Every distinct string which
+ * is interned is stored exactly once, as an atom, so strings which are both
+ * atoms are equal exactly when they are the same pointer.  Identifier names and
+ * string constants are atoms, which lets variables be looked up by comparing
+ * pointers instead of characters.
+ *
+ * Atoms are never freed individually; they live until the intern table is
+ * deleted when the program exits.  Names computed during execution, such as
+ * with \c SRS, are therefore copied instead of interned.  Both atoms and copied
+ * names are stored after the hash of their characters, so any two names may be
+ * compared by their hashes before their characters.
+ *
+ * \file   intern.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __INTERN_H__
+#define __INTERN_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory.h"
+
+/**
+ * The number of entries the intern table starts with.
+ */
+#define INTERN_TABLE_SIZE 1024
+
+/**
+ * Stores the header in front of the characters of a name.
+ */
+typedef struct {
+	unsigned int hash; /**< The hash of the characters of the name. */
+	unsigned int atom; /**< Whether the name is an atom rather than a copy. */
+} NameHeader;
+
+/**
+ * Retrieves the header of a name.
+ */
+#define getNameHeader(name) ((NameHeader *)(name) - 1)
+
+/**
+ * Retrieves the hash of the characters of a name.
+ */
+#define getNameHash(name) (getNameHeader(name)->hash)
+
+/**
+ * Checks whether a name is an atom.
+ */
+#define isAtom(name) (getNameHeader(name)->atom)
+
+/**
+ * Stores the set of interned strings.
+ */
+typedef struct {
+	char **atoms;       /**< The atoms, by the hash of their characters (NULL if empty). */
+	unsigned int num;   /**< The number of atoms. */
+	unsigned int size;  /**< The number of entries in \a atoms, a power of two. */
+	MemoryArena *arena; /**< The arena the characters of the atoms are allocated from. */
+} InternTable;
+
+/**
+ * \name Intern table modifiers
+ *
+ * Functions for interning strings.
+ */
+/**@{*/
+char *internString(const char *);
+char *internStringLength(const char *, size_t);
+void deleteInternTable(void);
+/**@}*/
+
+/**
+ * \name Name modifiers
+ *
+ * Functions for hashing names and copying names which are not interned.
+ */
+/**@{*/
+unsigned int hashCharacters(const char *, size_t);
+char *copyName(const char *);
+void deleteName(char *);
+/**@}*/
+
+#endif /* __INTERN_H__ */
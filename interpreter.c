@@ -1,5 +1,174 @@
 #include "interpreter.h"
 
+#ifdef HAVE_READ
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/**
+ * The pools that values, scopes, and returned values are allocated from.  Each
+ * thread has its own pools, so values may not be shared between threads.
+ */
+static THREAD_LOCAL MemoryPool ValuePool = MEMORY_POOL("value", ValueObject);
+static THREAD_LOCAL MemoryPool ScopePool = MEMORY_POOL("scope", ScopeObject);
+static THREAD_LOCAL MemoryPool ReturnPool = MEMORY_POOL("return", ReturnObject);
+
+/**
+ * The shared default returned value.
+ */
+static ReturnObject DefaultReturn = { RT_DEFAULT, NULL, NULL, NULL };
+
+/**
+ * The policy for writing buffered output.
+ */
+static FlushPolicy OutputPolicy = FP_FULL;
+
+/**
+ * The file this thread writes output to (NULL for standard output).
+ */
+static THREAD_LOCAL FILE *OutputFile = NULL;
+
+/**
+ * Stores characters of input which have been read but not yet consumed.
+ */
+typedef struct {
+	char *data;   /**< The characters read. */
+	size_t size;  /**< The number of characters there is space for in \a data. */
+	size_t start; /**< The position of the first character not yet consumed. */
+	size_t end;   /**< The position after the last character read. */
+} InputBuffer;
+
+/**
+ * The characters read from standard input ahead of the lines consumed so far.
+ * Standard input is shared by every thread, so its buffer is too.
+ */
+static char StandardInputData[INPUT_BUFFER_SIZE];
+static InputBuffer StandardInput = { StandardInputData, INPUT_BUFFER_SIZE, 0, 0 };
+
+#ifdef HAVE_PTHREAD
+/**
+ * Guards \a StandardInput.
+ */
+static pthread_mutex_t StandardInputLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * The profile this thread counts the statements and calls it executes in
+ * (NULL when not profiling).
+ */
+static THREAD_LOCAL Profile *CurrentProfile = NULL;
+
+/**
+ * The results of the most recent casts this thread made which do not depend
+ * on the scope, indexed by the hash of the value cast and its new type.
+ */
+static THREAD_LOCAL CastCacheEntry CastCache[1 << CAST_CACHE_BITS];
+
+/**
+ * Finds the entry of the cast cache for a cast.
+ *
+ * \param [in] key The value being cast.
+ *
+ * \param [in] type The type \a key is being cast to.
+ *
+ * \return The entry a cast of \a key to \a type is stored in.
+ */
+static CastCacheEntry *getCastCacheEntry(ValueObject *key,
+                                         ValueType type)
+{
+	/* Multiplicative hashing mixes the aligned bits of pointers */
+	unsigned long long hash = ((unsigned long long)(uintptr_t)key + type)
+			* 0x9e3779b97f4a7c15ULL;
+	return &CastCache[hash >> (64 - CAST_CACHE_BITS)];
+}
+
+/**
+ * Looks up the result of a cast in the cast cache.
+ *
+ * \param [in] key The value being cast.
+ *
+ * \param [in] type The type \a key is being cast to.
+ *
+ * \return A copy of the result of casting \a key to \a type.
+ *
+ * \retval NULL The cast is not cached.
+ */
+static ValueObject *findCastCache(ValueObject *key,
+                                  ValueType type)
+{
+	CastCacheEntry *entry = getCastCacheEntry(key, type);
+	if (entry->key != key || entry->type != type) return NULL;
+	STAT_COUNT(casts);
+	return copyValueObject(entry->value);
+}
+
+/**
+ * Stores the result of a cast in the cast cache, replacing whichever cast was
+ * stored in its entry.
+ *
+ * \param [in] key The value that was cast.
+ *
+ * \param [in] type The type \a key was cast to.
+ *
+ * \param [in] value The result of casting \a key to \a type.
+ *
+ * \return \a value.
+ */
+static ValueObject *storeCastCache(ValueObject *key,
+                                   ValueType type,
+                                   ValueObject *value)
+{
+	CastCacheEntry *entry = getCastCacheEntry(key, type);
+	ValueObject *old = entry->value;
+	if (!value) return NULL;
+	entry->key = key;
+	entry->type = type;
+	entry->value = copyValueObject(value);
+	deleteValueObject(old);
+	return value;
+}
+
+/**
+ * Removes the casts of a string from the cast cache, which must be done
+ * before it is changed or freed.
+ *
+ * \param [in] key The string whose casts to remove.
+ */
+static void evictCastCache(ValueObject *key)
+{
+	static const ValueType types[] = { VT_INTEGER, VT_FLOAT };
+	unsigned int n;
+	for (n = 0; n < sizeof(types) / sizeof(ValueType); n++) {
+		CastCacheEntry *entry = getCastCacheEntry(key, types[n]);
+		if (entry->key == key && entry->type == types[n]) {
+			ValueObject *old = entry->value;
+			entry->key = NULL;
+			entry->value = NULL;
+			deleteValueObject(old);
+		}
+	}
+}
+
+/**
+ * Removes every cast from the cast cache of this thread, releasing the values
+ * it holds.  This is done once a program finishes, as the values it cast may
+ * be freed along with their memory pools.
+ */
+void clearCastCache(void)
+{
+	unsigned int n;
+	for (n = 0; n < sizeof(CastCache) / sizeof(CastCacheEntry); n++) {
+		ValueObject *old = CastCache[n].value;
+		CastCache[n].key = NULL;
+		CastCache[n].value = NULL;
+		deleteValueObject(old);
+	}
+}
+
 /**
  * Creates a new string by copying the contents of another string.
  *
@@ -118,22 +287,232 @@ resolveIdentifierNameAbort: /* Exception handline */
 }
 
 /**
- * Creates a nil-type value.
+ * Sets when output written to standard output is flushed.
  *
- * \return A new nil-type value.
+ * \param [in] policy The flush policy to use.
  *
- * \retval NULL Memory allocation failed.
+ * \pre No output has been written to standard output yet.
+ *
+ * \retval 0 The output buffer could not be set up.
+ *
+ * \retval 1 \a policy is in effect.
  */
-ValueObject *createNilValueObject(void)
+int setFlushPolicy(FlushPolicy policy)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
+	int status;
+	if (policy == FP_LINE)
+		status = setvbuf(stdout, NULL, _IOLBF, OUTPUT_BUFFER_SIZE);
+	else
+		status = setvbuf(stdout, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+	if (status) return 0;
+	OutputPolicy = policy;
+	return 1;
+}
+
+/**
+ * Sets the file this thread writes output to.
+ *
+ * \param [in] file The file to write output to (NULL for standard output).
+ */
+void setOutputFile(FILE *file)
+{
+	OutputFile = file;
+}
+
+/**
+ * Gets the file this thread writes output to.
+ *
+ * \return The file output is written to.
+ */
+FILE *getOutputFile(void)
+{
+	return OutputFile ? OutputFile : stdout;
+}
+
+/**
+ * Sets the profile this thread counts the statements and calls it executes
+ * in.
+ *
+ * \param [in] profile The profile to update (NULL to stop profiling).
+ */
+void setProfile(Profile *profile)
+{
+	CurrentProfile = profile;
+}
+
+/**
+ * Finds the file this thread writes to in place of a standard stream.  Print
+ * statements name standard output or standard error, which may be redirected
+ * separately for each thread.
+ *
+ * \param [in] file The file to redirect.
+ *
+ * \return The file to write to in place of \a file.
+ */
+FILE *redirectFile(FILE *file)
+{
+	if (file == stdout) return getOutputFile();
+	if (file == stderr) return getErrorFile();
+	return file;
+}
+
+/**
+ * Writes characters to a file.  Characters written to a standard stream are
+ * passed to the output function set for this thread with setIoHandler(), if
+ * any, and are otherwise written to the file the stream is redirected to.
+ *
+ * \param [in] file The file to write to.
+ *
+ * \param [in] text The characters to write.
+ *
+ * \param [in] length The number of characters in \a text.
+ */
+void writeFile(FILE *file,
+               const char *text,
+               size_t length)
+{
+	const IoHandler *io = getIoHandler();
+	if (io && io->write && (file == stdout || file == stderr))
+		io->write(io->data, file == stderr, text, length);
+	else
+		fwrite(text, 1, length, redirectFile(file));
+}
+
+/**
+ * Reads more input into a buffer whose characters have all been consumed.
+ * Standard input is read a block at a time, so later lines are taken from the
+ * buffer without waiting; input read with an input function set with
+ * setIoHandler() is read only up to the end of a line, as nothing is kept for
+ * later.  Buffered output is flushed first so any prompt is visible while
+ * waiting for input.
+ *
+ * \param [in,out] buf The buffer to read into.
+ *
+ * \param [in] io The functions to read with (NULL for standard input).
+ *
+ * \return The number of characters read.
+ *
+ * \retval 0 There is no more input.
+ */
+static size_t fillInputBuffer(InputBuffer *buf,
+                              const IoHandler *io)
+{
+	const IoHandler *out = getIoHandler();
+	size_t got = 0;
+	int c;
+	if (OutputPolicy != FP_EXIT && !(out && out->write))
+		fflush(getOutputFile());
+	buf->start = 0;
+#ifdef HAVE_READ
+	if (!io) {
+		ssize_t n;
+		do n = read(STDIN_FILENO, buf->data, buf->size);
+		while (n < 0 && errno == EINTR);
+		buf->end = n > 0 ? (size_t)n : 0;
+		return buf->end;
+	}
+#endif
+	while (got < buf->size) {
+		c = io ? io->read(io->data) : getchar();
+		if (c == EOF) break;
+		buf->data[got++] = (char)c;
+		if (c == '\0' || c == '\r' || c == '\n') break;
+	}
+	buf->end = got;
+	return got;
+}
+
+/**
+ * Reads a line of input.  Input is read with the input function set for this
+ * thread with setIoHandler(), if any, and from standard input otherwise.
+ *
+ * \note The specification is unclear as to the exact semantics of input.
+ * Here, we read up until the first carriage return, newline, null character,
+ * or EOF but do not store it.
+ *
+ * \return The characters of the line, allocated at exactly their length.
+ *
+ * \retval NULL Memory could not be allocated.
+ */
+char *readInputLine(void)
+{
+	const IoHandler *io = getIoHandler();
+	char chars[256];
+	InputBuffer handler = { chars, sizeof(chars), 0, 0 };
+	InputBuffer *buf = &StandardInput;
+	char *part = NULL;
+	size_t length = 0;
+	size_t size = 0;
+	size_t start = 0;
+	size_t stop = 0;
+	char *line = NULL;
+	if (io && io->read) buf = &handler;
+	else io = NULL;
+#ifdef HAVE_PTHREAD
+	if (!io) pthread_mutex_lock(&StandardInputLock);
+#endif
+	while (buf->start < buf->end || fillInputBuffer(buf, io)) {
+		char c;
+		start = stop = buf->start;
+		while (stop < buf->end
+				&& (c = buf->data[stop]) != '\n'
+				&& c != '\r'
+				&& c != '\0')
+			stop++;
+		if (stop < buf->end) {
+			buf->start = stop + 1;
+			break;
+		}
+		/* Keep the start of a line which continues past the buffer */
+		buf->start = buf->end;
+		if (length + (stop - start) > size) {
+			void *mem = NULL;
+			size = 2 * (length + (stop - start));
+			mem = realloc(part, size);
+			if (!mem) {
+				perror("realloc");
+				goto readInputLineAbort;
+			}
+			part = mem;
+		}
+		memcpy(part + length, buf->data + start, stop - start);
+		length += stop - start;
+		start = stop = 0;
+	}
+	line = malloc(length + (stop - start) + 1);
+	if (!line) {
 		perror("malloc");
-		return NULL;
+		goto readInputLineAbort;
 	}
-	p->type = VT_NIL;
-	p->semaphore = 1;
-	return p;
+	if (length) memcpy(line, part, length);
+	memcpy(line + length, buf->data + start, stop - start);
+	line[length + (stop - start)] = '\0';
+	free(part);
+#ifdef HAVE_PTHREAD
+	if (!io) pthread_mutex_unlock(&StandardInputLock);
+#endif
+	return line;
+
+readInputLineAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	if (part) free(part);
+#ifdef HAVE_PTHREAD
+	if (!io) pthread_mutex_unlock(&StandardInputLock);
+#endif
+
+	return NULL;
+}
+
+/**
+ * Creates a nil-type value.
+ *
+ * \return The immediate nil-type value.
+ */
+ValueObject *createNilValueObject(void)
+{
+	STAT_COUNT_TYPE(immediate, VT_NIL);
+	return IMMEDIATE_NIL;
 }
 
 /**
@@ -141,21 +520,13 @@ ValueObject *createNilValueObject(void)
  *
  * \param [in] data The boolean data to store.
  *
- * \return A boolean-type value equalling 0 if \a data equals 0 and 1 otherwise.
- *
- * \retval NULL Memory allocation failed.
+ * \return An immediate boolean-type value equalling 0 if \a data equals 0 and 1
+ * otherwise.
  */
 ValueObject *createBooleanValueObject(int data)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->type = VT_BOOLEAN;
-	p->data.i = (data != 0);
-	p->semaphore = 1;
-	return p;
+	STAT_COUNT_TYPE(immediate, VT_BOOLEAN);
+	return IMMEDIATE_BOOLEAN(data);
 }
 
 /**
@@ -163,241 +534,985 @@ ValueObject *createBooleanValueObject(int data)
  *
  * \param [in] data The integer data to store.
  *
- * \return An integer-type value equalling \a data.
+ * \return An integer-type value equalling \a data, which is immediate if \a
+ * data fits in a pointer alongside its tag.
  *
  * \retval NULL Memory allocation failed.
  */
 ValueObject *createIntegerValueObject(long long data)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
+	ValueObject *p = NULL;
+	if (data >= IMMEDIATE_INTEGER_MIN && data <= IMMEDIATE_INTEGER_MAX) {
+		STAT_COUNT_TYPE(immediate, VT_INTEGER);
+		return (ValueObject *)(((uintptr_t)(intptr_t)data << 2) | IMMEDIATE_INTEGER);
 	}
+	p = allocatePoolObject(&ValuePool);
+	if (!p) return NULL;
 	p->type = VT_INTEGER;
 	p->data.i = data;
 	p->semaphore = 1;
+	STAT_COUNT_TYPE(created, VT_INTEGER);
+	return p;
+}
+
+/**
+ * Creates a floating-point-type value.
+ *
+ * \param [in] data The floating-point data to store.
+ *
+ * \return A floating-point-type value equalling \a data, which is immediate if
+ * pointers are large enough to hold it.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *createFloatValueObject(float data)
+{
+#ifdef IMMEDIATE_FLOATS
+	union {
+		float f;
+		uint32_t u;
+	} bits;
+	bits.f = data;
+	STAT_COUNT_TYPE(immediate, VT_FLOAT);
+	return (ValueObject *)(((uintptr_t)bits.u << 32) | IMMEDIATE_FLOAT);
+#else
+	ValueObject *p = allocatePoolObject(&ValuePool);
+	if (!p) return NULL;
+	p->type = VT_FLOAT;
+	p->data.f = data;
+	p->semaphore = 1;
+	STAT_COUNT_TYPE(created, VT_FLOAT);
+	return p;
+#endif
+}
+
+/**
+ * Retrieves the data of an immediate floating-point-type value.
+ *
+ * \param [in] value The immediate value to retrieve the data of.
+ *
+ * \pre \a value was created by createFloatValueObject() with
+ * \c IMMEDIATE_FLOATS defined.
+ *
+ * \return The floating-point data stored in \a value.
+ */
+float getImmediateFloat(ValueObject *value)
+{
+	union {
+		float f;
+		uint32_t u;
+	} bits;
+#ifdef IMMEDIATE_FLOATS
+	bits.u = (uint32_t)((uintptr_t)value >> 32);
+#else
+	bits.u = 0;
+	(void)value;
+#endif
+	return bits.f;
+}
+
+/**
+ * Creates a string-type value.
+ *
+ * \param [in] data The string data to store.
+ *
+ * \note \a data is stored as-is; no copy of it is made.
+ *
+ * \return A string-type value equalling \a data.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *createStringValueObject(char *data)
+{
+	ValueObject *p = allocatePoolObject(&ValuePool);
+	if (!p) return NULL;
+	p->type = VT_STRING;
+	p->data.s = data;
+	p->semaphore = 1;
+	p->borrowed = 0;
+	p->length = strlen(data);
+	p->capacity = p->length + 1;
+	p->plain = !memchr(data, ':', p->length);
+	p->tmpl = NULL;
+	STAT_COUNT_TYPE(created, VT_STRING);
+	STAT_ALLOCATE(p->capacity);
+	return p;
+}
+
+/**
+ * Creates a string-type value whose data is owned by something else, such as
+ * a string constant in the parse tree.
+ *
+ * \param [in] data The string data to refer to.
+ *
+ * \param [in] tmpl The optional template to interpolate \a data with.
+ *
+ * \note \a data and \a tmpl must outlive the value and are not freed with it.
+ *
+ * \return A string-type value equalling \a data.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *createBorrowedStringValueObject(char *data,
+                                             StringTemplate *tmpl)
+{
+	ValueObject *p = createStringValueObject(data);
+	if (!p) return NULL;
+	p->borrowed = 1;
+	STAT_FREE(p->capacity);
+	p->capacity = 0;
+	p->tmpl = tmpl;
+	return p;
+}
+
+/**
+ * Creates a function-type value.
+ *
+ * \param [in] def The function definition to store.
+ *
+ * \return A function-type value containing \a data.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *createFunctionValueObject(FuncDefStmtNode *def)
+{
+	ValueObject *p = allocatePoolObject(&ValuePool);
+	if (!p) return NULL;
+	p->type = VT_FUNC;
+	p->data.fn = def;
+	p->semaphore = 1;
+	STAT_COUNT_TYPE(created, VT_FUNC);
 	return p;
 }
 
 /**
- * Creates a floating-point-type value.
+ * Creates an array-type value.
+ *
+ * \param [in] parent The optional parent scope to use.
+ *
+ * \note \a parent may be NULL, in which case this array is treated as the root.
+ *
+ * \return An empty array-type value with parent \a parent.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *createArrayValueObject(ScopeObject *parent)
+{
+	ValueObject *p = allocatePoolObject(&ValuePool);
+	if (!p) return NULL;
+	p->type = VT_ARRAY;
+	p->data.a = createScopeObject(parent);
+	if (!p->data.a) {
+		freePoolObject(&ValuePool, p);
+		return NULL;
+	}
+	p->semaphore = 1;
+	STAT_COUNT_TYPE(created, VT_ARRAY);
+	return p;
+}
+
+/**
+ * Copies a value.
+ *
+ * Instead of actually performing a copy of memory, this function increments a
+ * semaphore in \a value and returns \a value again.  The semaphore gets
+ * decremented when \a value gets deleted.  This way, an immutable copy of a
+ * value may be made without actually copying its blocks of memory; this reduces
+ * the overhead associated with copying a value--a fairly common
+ * operation--while still preserving its usability.
+ *
+ * \param [in,out] value The value to copy.
+ *
+ * \note Immediate values are returned as-is.
+ *
+ * \return A value with the same type and contents as \a value.
+ *
+ * \retval NULL The type of \a value is unrecognized.
+ */
+ValueObject *copyValueObject(ValueObject *value)
+{
+	if (isImmediate(value)) return value;
+	V(value);
+	return value;
+}
+
+/**
+ * Deletes a value.
+ *
+ * This function decrements a semaphore in \a value and deletes \a value if the
+ * semaphore reaches 0 (no copies of this value are need anymore).  The
+ * semaphore gets incremented when either the value is created or it gets
+ * copied.  This way, an immutable copy of the value may be made without
+ * actually copying its memory.
+ *
+ * \param [in,out] value The value to delete.
+ *
+ * \note Immediate values are never freed.
+ *
+ * \post The memory at \a value and any of its members will be freed (although
+ * see note for full details).
+ */
+void deleteValueObject(ValueObject *value)
+{
+	if (!value || isImmediate(value)) return;
+	P(value);
+	if (!value->semaphore) {
+		STAT_COUNT_TYPE(freed, value->type);
+		if (value->type == VT_STRING) {
+			evictCastCache(value);
+			STAT_FREE(value->capacity);
+			if (!value->borrowed) free(value->data.s);
+		}
+		/* FuncDefStmtNode structures get freed with the parse tree */
+		else if (value->type == VT_ARRAY)
+			deleteScopeObject(value->data.a);
+		freePoolObject(&ValuePool, value);
+	}
+}
+
+/**
+ * Creates a scope.
+ *
+ * Scopes are used to map identifiers to values.  Scopes are organized
+ * hierarchically.
+ *
+ * \param [in] parent The optional parent scope to use.
+ *
+ * \return An empty scope with parent \a parent.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ScopeObject *createScopeObject(ScopeObject *parent)
+{
+	ScopeObject *p = allocatePoolObject(&ScopePool);
+	if (!p) return NULL;
+	p->impvar = createNilValueObject();
+	if (!p->impvar) {
+		freePoolObject(&ScopePool, p);
+		return NULL;
+	}
+	p->numvals = 0;
+	p->size = 0;
+	p->names = NULL;
+	p->numcopies = 0;
+	p->values = NULL;
+	p->numelems = 0;
+	p->elemsize = 0;
+	p->numsparse = 0;
+	p->elems = NULL;
+	p->tablesize = 0;
+	p->table = NULL;
+	p->parent = parent;
+	if (parent) {
+		p->caller = parent->caller;
+		p->global = parent->global;
+	}
+	else {
+		p->caller = NULL;
+		p->global = p;
+	}
+	STAT_COUNT(scopes);
+	return p;
+}
+
+/**
+ * Creates a scope with a specific caller.
+ *
+ * \param [in] parent The optional parent scope to use.
+ *
+ * \param [in] caller The caller scope to use.
+ *
+ * \return An empty scope with parent \a parent and caller \a caller.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ScopeObject *createScopeObjectCaller(ScopeObject *parent,
+                                     ScopeObject *caller)
+{
+	ScopeObject *p = createScopeObject(parent);
+	if (!p) return NULL;
+	if (caller) p->caller = caller;
+	return p;
+}
+
+/**
+ * Deletes a scope.
+ *
+ * \param [in,out] scope The scope to delete.
+ *
+ * \post The memory at \a scope and any of its members will be freed.
+ */
+void deleteScopeObject(ScopeObject *scope)
+{
+	unsigned int n;
+	if (!scope) return;
+	for (n = 0; n < scope->numvals; n++)
+		deleteValueObject(scope->values[n]);
+	/* Most names are atoms, which are never deleted */
+	for (n = 0; scope->numcopies && n < scope->numvals; n++)
+		deleteName(scope->names[n]);
+	/* The names are stored in the same block as the values */
+	free(scope->values);
+	for (n = 0; n < scope->numelems; n++)
+		deleteValueObject(scope->elems[n]);
+	free(scope->elems);
+	free(scope->table);
+	STAT_FREE((sizeof(ValueObject *) + sizeof(char *)) * scope->size
+			+ sizeof(ValueObject *) * scope->elemsize
+			+ sizeof(unsigned int) * scope->tablesize);
+	deleteValueObject(scope->impvar);
+	freePoolObject(&ScopePool, scope);
+}
+
+/**
+ * Removes every value from a scope, keeping the space it has made for them so
+ * the scope may be reused.
+ *
+ * \param [in,out] scope The scope to clear.
+ *
+ * \post \a scope will contain no values and its implicit variable will be nil.
+ */
+void clearScopeObject(ScopeObject *scope)
+{
+	unsigned int n;
+	for (n = 0; n < scope->numvals; n++)
+		deleteValueObject(scope->values[n]);
+	for (n = 0; scope->numcopies && n < scope->numvals; n++)
+		deleteName(scope->names[n]);
+	scope->numvals = 0;
+	scope->numcopies = 0;
+	for (n = 0; n < scope->numelems; n++)
+		deleteValueObject(scope->elems[n]);
+	scope->numelems = 0;
+	scope->numsparse = 0;
+	/* The hash table is rebuilt once enough values are added again */
+	STAT_FREE(sizeof(unsigned int) * scope->tablesize);
+	free(scope->table);
+	scope->table = NULL;
+	scope->tablesize = 0;
+	deleteValueObject(scope->impvar);
+	scope->impvar = createNilValueObject();
+}
+
+/**
+ * Makes space for values in a scope.  The values and their names are stored
+ * in a single block so that a scope whose size is known in advance, such as
+ * the scope of a function call, needs only one allocation.
+ *
+ * \param [in,out] scope The scope to make space in.
+ *
+ * \param [in] size The number of values to make space for.
+ *
+ * \post \a scope will have space for at least \a size values.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 Space was made successfully.
+ */
+int reserveScopeValues(ScopeObject *scope,
+                       unsigned int size)
+{
+	ValueObject **values = NULL;
+	char **names = NULL;
+	if (size <= scope->size) return 1;
+	values = malloc((sizeof(ValueObject *) + sizeof(char *)) * size);
+	if (!values) {
+		perror("malloc");
+		return 0;
+	}
+	names = (char **)(values + size);
+	if (scope->numvals) {
+		memcpy(values, scope->values, sizeof(ValueObject *) * scope->numvals);
+		memcpy(names, scope->names, sizeof(char *) * scope->numvals);
+	}
+	free(scope->values);
+	STAT_FREE((sizeof(ValueObject *) + sizeof(char *)) * scope->size);
+	STAT_ALLOCATE((sizeof(ValueObject *) + sizeof(char *)) * size);
+	scope->values = values;
+	scope->names = names;
+	scope->size = size;
+	return 1;
+}
+
+/**
+ * Replaces the values of a scope with those of another, leaving its parent and
+ * caller unchanged.  This lets a function called in tail position reuse the
+ * scope of the function returning it.
+ *
+ * \param [in,out] dest The scope whose values are replaced.
+ *
+ * \param [in,out] src The scope whose values are moved.
+ *
+ * \post The previous values of \a dest will be deleted, its implicit variable
+ * will be nil, and \a src will be deleted.
+ */
+void replaceScopeValues(ScopeObject *dest,
+                        ScopeObject *src)
+{
+	unsigned int n;
+	ValueObject **values = dest->values;
+	char **names = dest->names;
+	unsigned int size = dest->size;
+	for (n = 0; n < dest->numvals; n++)
+		deleteValueObject(dest->values[n]);
+	for (n = 0; dest->numcopies && n < dest->numvals; n++)
+		deleteName(dest->names[n]);
+	dest->values = src->values;
+	dest->names = src->names;
+	dest->numvals = src->numvals;
+	dest->numcopies = src->numcopies;
+	dest->size = src->size;
+	for (n = 0; n < dest->numelems; n++)
+		deleteValueObject(dest->elems[n]);
+	free(dest->elems);
+	free(dest->table);
+	STAT_FREE(sizeof(ValueObject *) * dest->elemsize
+			+ sizeof(unsigned int) * dest->tablesize);
+	dest->elems = src->elems;
+	dest->numelems = src->numelems;
+	dest->elemsize = src->elemsize;
+	dest->numsparse = src->numsparse;
+	dest->table = src->table;
+	dest->tablesize = src->tablesize;
+	deleteValueObject(dest->impvar);
+	dest->impvar = createNilValueObject();
+	/* Give the old space to src so it is freed along with it */
+	src->values = values;
+	src->names = names;
+	src->numvals = 0;
+	src->numcopies = 0;
+	src->size = size;
+	src->elems = NULL;
+	src->numelems = 0;
+	src->elemsize = 0;
+	src->table = NULL;
+	src->tablesize = 0;
+	deleteScopeObject(src);
+}
+
+/**
+ * Gets the location of a value in a scope using the position its identifier
+ * was resolved to before execution.  The name stored at that position is
+ * checked against the identifier, so a resolution which does not hold in a
+ * particular scope falls back to a look-up by name.
+ *
+ * \param [in] scope The scope the look-up of \a target starts from.
+ *
+ * \param [in] target The resolved identifier.
+ *
+ * \return A pointer to the location storing the value named by \a target.
+ *
+ * \retval NULL \a target was not resolved or its resolution does not hold in
+ * \a scope.
+ */
+ValueObject **getResolvedScopeSlot(ScopeObject *scope,
+                                   IdentifierNode *target)
+{
+	int n;
+	if (target->depth < 0) return NULL;
+	for (n = target->depth; n > 0 && scope; n--)
+		scope = scope->parent;
+	if (!scope || target->index >= scope->numvals) return NULL;
+	if (scope->names[target->index] != target->id) return NULL;
+	STAT_COUNT(resolved);
+	return &scope->values[target->index];
+}
+
+/**
+ * Gets the function a call refers to using the position in the outermost scope
+ * its name was resolved to before execution.  As with getResolvedScopeSlot(),
+ * the name stored at that position is checked against the name of the
+ * function.
+ *
+ * \param [in] scope The scope the call is made from.
+ *
+ * \param [in] expr The function call.
+ *
+ * \return The definition of the function called by \a expr.
+ *
+ * \retval NULL The name of \a expr was not resolved, its resolution does not
+ * hold, or it does not name a function, so the function must be looked up by
+ * name.
+ */
+FuncDefStmtNode *getResolvedFunction(ScopeObject *scope,
+                                     FuncCallExprNode *expr)
+{
+	ScopeObject *global = scope->global;
+	ValueObject *val = NULL;
+	if (expr->index < 0 || (unsigned int)expr->index >= global->numvals)
+		return NULL;
+	if (global->names[expr->index] != expr->name->id) return NULL;
+	val = global->values[expr->index];
+	if (getType(val) != VT_FUNC) return NULL;
+	return getFunction(val);
+}
+
+/**
+ * The number of characters of a name computed during execution which a key
+ * holds without allocating a copy of it.
+ */
+#define SCOPE_KEY_TEXT 64
+
+/**
+ * Stores the name of a variable being looked up.  Names which are non-negative
+ * integers written in the usual way, such as those computed from a \c NUMBR
+ * with \c SRS, are kept as numbers so they may index the elements of a scope.
+ * Other names computed during execution are not interned, since doing so would
+ * keep every such name for as long as the program runs; short ones are written
+ * into the key itself.
+ */
+typedef struct {
+	char *name;      /**< The name, an atom or a copy (NULL if it is an index). */
+	char *copy;      /**< The copy of a name too long for \a text (or NULL). */
+	int atom;        /**< Whether \a name is an atom. */
+	long long index; /**< The index, if \a name is NULL. */
+	union {
+		NameHeader header;                              /**< The header of the name. */
+		char data[sizeof(NameHeader) + SCOPE_KEY_TEXT]; /**< The header followed by the characters. */
+	} text;          /**< Space to write a short name or an index as a name. */
+} ScopeKey;
+
+/**
+ * Checks whether a name is a non-negative integer written without a sign or
+ * leading zeros, which is how a \c NUMBR is cast to a \c YARN.
+ *
+ * \param [in] name The name to check.
+ *
+ * \param [out] index The integer \a name is written as.
+ *
+ * \retval 0 \a name is not an index.
+ *
+ * \retval 1 \a name is an index.
+ */
+static int isIndexName(const char *name,
+                       long long *index)
+{
+	const char *c = name;
+	long long n = 0;
+	if (*c == '0') {
+		*index = 0;
+		return c[1] == '\0';
+	}
+	for (; *c >= '0' && *c <= '9'; c++) {
+		/* Names too long to be a NUMBR stay names */
+		if (c - name >= 18) return 0;
+		n = n * 10 + (*c - '0');
+	}
+	if (c == name || *c) return 0;
+	*index = n;
+	return 1;
+}
+
+/**
+ * Writes a name computed during execution into a key, copying it if it is too
+ * long to fit.
+ *
+ * \param [in,out] key The key to write the name into.
+ *
+ * \param [in] str The name to write.
+ *
+ * \return The name written, which is valid until \a key is released.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static char *writeScopeKeyName(ScopeKey *key,
+                               const char *str)
+{
+	size_t len = strlen(str);
+	if (len >= SCOPE_KEY_TEXT) return key->copy = copyName(str);
+	key->text.header.hash = hashCharacters(str, len);
+	key->text.header.atom = 0;
+	memcpy(key->text.data + sizeof(NameHeader), str, len + 1);
+	return key->text.data + sizeof(NameHeader);
+}
+
+/**
+ * Resolves the name of an identifier for looking it up.
+ *
+ * \param [in] id The identifier to resolve.
+ *
+ * \param [in] scope The scope to evaluate \a id under.
+ *
+ * \param [out] key The name of the variable \a id refers to.
+ *
+ * \note An indirect identifier is evaluated exactly once.
+ *
+ * \retval 0 \a id could not be resolved.
+ *
+ * \retval 1 \a key was set successfully.
+ */
+static int resolveScopeKey(IdentifierNode *id,
+                           ScopeObject *scope,
+                           ScopeKey *key)
+{
+	key->name = NULL;
+	key->copy = NULL;
+	key->atom = 0;
+	key->index = -1;
+	if (id->type == IT_INDIRECT) {
+		ValueObject *val = interpretExprNode(id->id, scope);
+		ValueObject *str = NULL;
+		if (!val) return 0;
+		/* Indexing with a NUMBR need not build a name */
+		if (getType(val) == VT_INTEGER && getInteger(val) >= 0) {
+			key->index = getInteger(val);
+			deleteValueObject(val);
+			return 1;
+		}
+		str = castStringExplicit(val, scope);
+		deleteValueObject(val);
+		if (!str) return 0;
+		if (isIndexName(getString(str), &key->index)) {
+			deleteValueObject(str);
+			return 1;
+		}
+		key->name = writeScopeKeyName(key, getString(str));
+		deleteValueObject(str);
+		return key->name != NULL;
+	}
+	/* Direct identifier names are interned, except those interpolated into strings */
+	key->name = id->id;
+	key->atom = isAtom(id->id);
+	return 1;
+}
+
+/**
+ * Releases the name of a key.
+ *
+ * \param [in,out] key The key to release.
+ *
+ * \post Any copy of a name made for \a key will be freed.
+ */
+static void releaseScopeKey(ScopeKey *key)
+{
+	deleteName(key->copy);
+	key->copy = NULL;
+}
+
+/**
+ * Evaluates the name of an identifier so that it may be used more than once
+ * without evaluating it again.
+ *
+ * \param [in] id The identifier to evaluate.
+ *
+ * \param [in] scope The scope to evaluate \a id under.
+ *
+ * \return An identifier naming what \a id does, which is \a id itself if it
+ * is direct or accesses a slot.
+ *
+ * \retval NULL \a id could not be evaluated.
+ *
+ * \see deleteEvaluatedIdentifierNode(IdentifierNode *, IdentifierNode *)
+ */
+IdentifierNode *evaluateIdentifierNode(IdentifierNode *id,
+                                       ScopeObject *scope)
+{
+	ValueObject *val = NULL;
+	ValueObject *str = NULL;
+	IdentifierNode *ret = NULL;
+	long long index = -1;
+	char *name = NULL;
+
+	if (id->type == IT_DIRECT || id->slot) return id;
+
+	val = interpretExprNode(id->id, scope);
+	if (!val) return NULL;
+	if (getType(val) == VT_INTEGER && getInteger(val) >= 0)
+		index = getInteger(val);
+	else {
+		str = castStringExplicit(val, scope);
+		if (!str) goto evaluateIdentifierNodeAbort;
+		if (!isIndexName(getString(str), &index)) {
+			/* Names computed during execution are kept as copies */
+			name = copyName(getString(str));
+			if (!name) goto evaluateIdentifierNodeAbort;
+			ret = createIdentifierNode(IT_DIRECT, name, NULL, id->fname, id->line);
+			if (!ret) goto evaluateIdentifierNodeAbort;
+			deleteValueObject(str);
+			deleteValueObject(val);
+			return ret;
+		}
+	}
+
+	/* Indices are kept as constants so they still refer to elements */
+	{
+		ConstantNode *c = createIntegerConstantNode(index);
+		ExprNode *expr = c ? createExprNode(ET_CONSTANT, c) : NULL;
+		if (!expr) {
+			deleteConstantNode(c);
+			goto evaluateIdentifierNodeAbort;
+		}
+		ret = createIdentifierNode(IT_INDIRECT, expr, NULL, id->fname, id->line);
+		if (!ret) {
+			deleteExprNode(expr);
+			goto evaluateIdentifierNodeAbort;
+		}
+	}
+	if (str) deleteValueObject(str);
+	deleteValueObject(val);
+	return ret;
+
+evaluateIdentifierNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	deleteName(name);
+	if (str) deleteValueObject(str);
+	if (val) deleteValueObject(val);
+
+	return NULL;
+}
+
+/**
+ * Deletes an identifier created by evaluateIdentifierNode().
  *
- * \param [in] data The floating-point data to store.
+ * \param [in,out] evaluated The evaluated identifier to delete.
  *
- * \return A floating-point-type value equalling \a data.
+ * \param [in] id The identifier \a evaluated was evaluated from.
  *
- * \retval NULL Memory allocation failed.
+ * \post The memory at \a evaluated and all of its members will be freed,
+ * unless it is \a id itself.
  */
-ValueObject *createFloatValueObject(float data)
+void deleteEvaluatedIdentifierNode(IdentifierNode *evaluated,
+                                   IdentifierNode *id)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->type = VT_FLOAT;
-	p->data.f = data;
-	p->semaphore = 1;
-	return p;
+	char *name = NULL;
+	if (!evaluated || evaluated == id) return;
+	if (evaluated->type == IT_DIRECT) name = evaluated->id;
+	deleteIdentifierNode(evaluated);
+	deleteName(name);
 }
 
 /**
- * Creates a string-type value.
+ * Gets the name a key refers to.
  *
- * \param [in] data The string data to store.
- *
- * \note \a data is stored as-is; no copy of it is made.
- *
- * \return A string-type value equalling \a data.
+ * \param [in,out] key The key to get the name of.
  *
- * \retval NULL Memory allocation failed.
+ * \return The name \a key refers to, which is valid as long as \a key is.
  */
-ValueObject *createStringValueObject(char *data)
+static char *getScopeKeyName(ScopeKey *key)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->type = VT_STRING;
-	p->data.s = data;
-	p->semaphore = 1;
-	return p;
+	char *text = key->text.data + sizeof(NameHeader);
+	if (key->name) return key->name;
+	sprintf(text, "%lld", key->index);
+	key->text.header.hash = hashCharacters(text, strlen(text));
+	key->text.header.atom = 0;
+	return text;
 }
 
 /**
- * Creates a function-type value.
+ * Checks whether two names are equal.  Atoms are equal only to themselves, but
+ * a copied name may equal an atom or another copy.
  *
- * \param [in] def The function definition to store.
+ * \param [in] a The first name.
  *
- * \return A function-type value containing \a data.
+ * \param [in] b The second name.
  *
- * \retval NULL Memory allocation failed.
+ * \retval 0 \a a and \a b are different names.
+ *
+ * \retval 1 \a a and \a b are the same name.
  */
-ValueObject *createFunctionValueObject(FuncDefStmtNode *def)
+static int isSameName(const char *a,
+                      const char *b)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->type = VT_FUNC;
-	p->data.fn = def;
-	p->semaphore = 1;
-	return p;
+	if (a == b) return 1;
+	if (isAtom(a) && isAtom(b)) return 0;
+	return getNameHash(a) == getNameHash(b) && !strcmp(a, b);
 }
 
 /**
- * Creates an array-type value.
+ * Hashes the name of a value in a scope.  The hash of the characters of every
+ * name is stored along with it, so atoms and copies of them hash the same.
  *
- * \param [in] parent The optional parent scope to use.
+ * \param [in] name The name to hash.
  *
- * \note \a parent may be NULL, in which case this array is treated as the root.
+ * \return The hash of \a name.
+ */
+static unsigned int hashScopeName(const char *name)
+{
+	return getNameHash(name);
+}
+
+/**
+ * Adds the value at a position in a scope to the hash table of the scope.  If
+ * the name of the value is already in the table, the earlier value is kept so
+ * look-ups find the same value as a search from the start of the scope would.
  *
- * \return An empty array-type value with parent \a parent.
+ * \param [in,out] scope The scope to add to.
  *
- * \retval NULL Memory allocation failed.
+ * \param [in] n The position of the value to add.
+ *
+ * \pre The hash table of \a scope has at least one free entry.
  */
-ValueObject *createArrayValueObject(ScopeObject *parent)
+static void insertScopeName(ScopeObject *scope,
+                            unsigned int n)
 {
-	ValueObject *p = malloc(sizeof(ValueObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->type = VT_ARRAY;
-	p->data.a = createScopeObject(parent);
-	if (!p->data.a) {
-		free(p);
-		return NULL;
+	unsigned int mask = scope->tablesize - 1;
+	unsigned int h = hashScopeName(scope->names[n]) & mask;
+	while (scope->table[h]) {
+		if (isSameName(scope->names[scope->table[h] - 1], scope->names[n]))
+			return;
+		h = (h + 1) & mask;
 	}
-	p->semaphore = 1;
-	return p;
+	scope->table[h] = n + 1;
 }
 
 /**
- * Copies a value.
+ * Rebuilds the hash table of a scope.
  *
- * Instead of actually performing a copy of memory, this function increments a
- * semaphore in \a value and returns \a value again.  The semaphore gets
- * decremented when \a value gets deleted.  This way, an immutable copy of a
- * value may be made without actually copying its blocks of memory; this reduces
- * the overhead associated with copying a value--a fairly common
- * operation--while still preserving its usability.
+ * \param [in,out] scope The scope to rebuild the table of.
  *
- * \param [in,out] value The value to copy.
+ * \param [in] size The number of entries in the new table, a power of two.
  *
- * \return A value with the same type and contents as \a value.
+ * \post The hash table of \a scope will have \a size entries.
  *
- * \retval NULL The type of \a value is unrecognized.
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The table was rebuilt successfully.
  */
-ValueObject *copyValueObject(ValueObject *value)
+static int rehashScopeValues(ScopeObject *scope,
+                             unsigned int size)
 {
-	V(value);
-	return value;
+	unsigned int n;
+	if (size != scope->tablesize) {
+		unsigned int *table = malloc(sizeof(unsigned int) * size);
+		if (!table) {
+			perror("malloc");
+			return 0;
+		}
+		free(scope->table);
+		STAT_FREE(sizeof(unsigned int) * scope->tablesize);
+		STAT_ALLOCATE(sizeof(unsigned int) * size);
+		scope->table = table;
+		scope->tablesize = size;
+	}
+	memset(scope->table, 0, sizeof(unsigned int) * size);
+	for (n = 0; n < scope->numvals; n++)
+		insertScopeName(scope, n);
+	return 1;
 }
 
 /**
- * Deletes a value.
+ * Adds the most recently created value in a scope to the hash table of the
+ * scope, building or growing the table as needed.  Small scopes have no table,
+ * since searching a few names is faster than hashing.
  *
- * This function decrements a semaphore in \a value and deletes \a value if the
- * semaphore reaches 0 (no copies of this value are need anymore).  The
- * semaphore gets incremented when either the value is created or it gets
- * copied.  This way, an immutable copy of the value may be made without
- * actually copying its memory.
+ * \param [in,out] scope The scope a value was created in.
  *
- * \param [in,out] value The value to delete.
+ * \retval 0 Memory allocation failed.
  *
- * \post The memory at \a value and any of its members will be freed (although
- * see note for full details).
+ * \retval 1 The value was indexed successfully.
  */
-void deleteValueObject(ValueObject *value)
+static int indexScopeValue(ScopeObject *scope)
 {
-	if (!value) return;
-	P(value);
-	if (!value->semaphore) {
-		if (value->type == VT_STRING)
-			free(value->data.s);
-		/* FuncDefStmtNode structures get freed with the parse tree */
-		else if (value->type == VT_ARRAY)
-			deleteScopeObject(value->data.a);
-		free(value);
-	}
+	if (scope->numvals <= SCOPE_HASH_THRESHOLD) return 1;
+	/* Keep the table at most half full */
+	if (scope->numvals * 2 > scope->tablesize)
+		return rehashScopeValues(scope, scope->tablesize
+				? scope->tablesize * 2 : SCOPE_HASH_THRESHOLD * 4);
+	insertScopeName(scope, scope->numvals - 1);
+	return 1;
 }
 
 /**
- * Creates a scope.
+ * Finds the position of a named value in a single scope.
  *
- * Scopes are used to map identifiers to values.  Scopes are organized
- * hierarchically.
+ * \param [in] scope The scope to look in.
  *
- * \param [in] parent The optional parent scope to use.
+ * \param [in] name The name of the value.
  *
- * \return An empty scope with parent \a parent.
+ * \param [in] atom Whether \a name is an atom.
  *
- * \retval NULL Memory allocation failed.
+ * \return The position of the first value named \a name in \a scope.
+ *
+ * \retval -1 \a scope does not contain a value named \a name.
  */
-ScopeObject *createScopeObject(ScopeObject *parent)
+static int findScopeName(ScopeObject *scope,
+                         const char *name,
+                         int atom)
 {
-	ScopeObject *p = malloc(sizeof(ScopeObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
+	/* An atom is only compared by address to the atoms of a scope */
+	int atoms = atom && !scope->numcopies;
+	unsigned int n;
+	STAT_COUNT(lookups);
+	if (scope->table) {
+		unsigned int mask = scope->tablesize - 1;
+		unsigned int h = hashScopeName(name) & mask;
+		while (scope->table[h]) {
+			n = scope->table[h] - 1;
+			STAT_COMPARE(1);
+			if (scope->names[n] == name
+					|| (!atoms && isSameName(scope->names[n], name)))
+				return (int)n;
+			h = (h + 1) & mask;
+		}
+		return -1;
 	}
-	p->impvar = createNilValueObject();
-	if (!p->impvar) {
-		free(p);
-		return NULL;
+	for (n = 0; n < scope->numvals; n++) {
+		if (scope->names[n] == name
+				|| (!atoms && isSameName(scope->names[n], name))) {
+			STAT_COMPARE(n + 1);
+			return (int)n;
+		}
 	}
-	p->numvals = 0;
-	p->names = NULL;
-	p->values = NULL;
-	p->parent = parent;
-	if (parent) p->caller = parent->caller;
-	else p->caller = NULL;
-	return p;
+	STAT_COMPARE(scope->numvals);
+	return -1;
 }
 
 /**
- * Creates a scope with a specific caller.
+ * Finds a named value in a single scope.
  *
- * \param [in] parent The optional parent scope to use.
+ * \param [in] scope The scope to look in.
  *
- * \param [in] caller The caller scope to use.
+ * \param [in,out] key The name of the value.
  *
- * \return An empty scope with parent \a parent and caller \a caller.
+ * \return A pointer to the location storing the value named by \a key.
  *
- * \retval NULL Memory allocation failed.
+ * \retval NULL \a scope does not contain a value named by \a key.
  */
-ScopeObject *createScopeObjectCaller(ScopeObject *parent,
-                                     ScopeObject *caller)
+static ValueObject **findScopeKey(ScopeObject *scope,
+                                  ScopeKey *key)
 {
-	ScopeObject *p = createScopeObject(parent);
-	if (!p) return NULL;
-	if (caller) p->caller = caller;
-	return p;
+	int n;
+	const char *name = key->name;
+	int atom = key->atom;
+	if (!name) {
+		if (key->index < scope->numelems) {
+			if (!scope->elems[key->index]) return NULL;
+			return &scope->elems[key->index];
+		}
+		/* Indices past the elements are stored by name */
+		if (!scope->numsparse) return NULL;
+		name = getScopeKeyName(key);
+	}
+	n = findScopeName(scope, name, atom);
+	return n < 0 ? NULL : &scope->values[n];
 }
 
 /**
- * Deletes a scope.
+ * Adds an element to the end of the elements of a scope.
  *
- * \param [in,out] scope The scope to delete.
+ * \param [in,out] scope The scope to add an element to.
  *
- * \post The memory at \a scope and any of its members will be freed.
+ * \return A pointer to the location storing the new element.
+ *
+ * \retval NULL Memory allocation failed.
  */
-void deleteScopeObject(ScopeObject *scope)
+static ValueObject **appendScopeElement(ScopeObject *scope)
 {
-	unsigned int n;
-	if (!scope) return;
-	for (n = 0; n < scope->numvals; n++) {
-		free(scope->names[n]);
-		deleteValueObject(scope->values[n]);
+	if (scope->numelems == scope->elemsize) {
+		unsigned int size = scope->elemsize ? scope->elemsize * 2 : 8;
+		void *mem = realloc(scope->elems, sizeof(ValueObject *) * size);
+		if (!mem) {
+			perror("realloc");
+			return NULL;
+		}
+		STAT_COUNT(elemgrowths);
+		STAT_ALLOCATE(sizeof(ValueObject *) * (size - scope->elemsize));
+		scope->elems = mem;
+		scope->elemsize = size;
 	}
-	free(scope->names);
-	free(scope->values);
-	deleteValueObject(scope->impvar);
-	free(scope);
+	scope->elems[scope->numelems] = createNilValueObject();
+	return &scope->elems[scope->numelems++];
 }
 
 /**
@@ -419,50 +1534,67 @@ ValueObject *createScopeValue(ScopeObject *src,
 {
 	ScopeObject *parent = dest;
 	IdentifierNode *child = target;
-	int status;
-	unsigned int newnumvals;
-	void *mem1 = NULL;
-	void *mem2 = NULL;
 	char *name = NULL;
+	int status;
+	ScopeKey key;
 
 	/* Traverse the target to the terminal child and parent */
 	status = resolveTerminalSlot(src, dest, target, &parent, &child);
-	if (!status) goto createScopeValueAbort;
-
-	/* Store the new number of values */
-	newnumvals = dest->numvals + 1;
+	if (!status) return NULL;
 
 	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto createScopeValueAbort;
+	if (!resolveScopeKey(target, src, &key)) goto createScopeValueAbort;
+
+	if (!key.name) {
+		ValueObject **slot = NULL;
+		/* Fill a deleted element */
+		if (key.index < dest->numelems) {
+			deleteValueObject(dest->elems[key.index]);
+			dest->elems[key.index] = createNilValueObject();
+			return dest->elems[key.index];
+		}
+		/* Extend the elements, unless the index is already stored by name */
+		if (key.index == dest->numelems && !findScopeKey(dest, &key)) {
+			slot = appendScopeElement(dest);
+			if (!slot) goto createScopeValueAbort;
+			return *slot;
+		}
+		key.name = getScopeKeyName(&key);
+		dest->numsparse++;
+	}
 
-	/* Add value to local scope */
-	mem1 = realloc(dest->names, sizeof(IdentifierNode *) * newnumvals);
-	if (!mem1) {
-		perror("realloc");
-		goto createScopeValueAbort;
+	/* Names computed during execution are kept as copies */
+	if (key.atom) name = key.name;
+	else {
+		name = key.copy ? key.copy : copyName(key.name);
+		if (!name) goto createScopeValueAbort;
+		key.copy = NULL;
 	}
-	mem2 = realloc(dest->values, sizeof(ValueObject *) * newnumvals);
-	if (!mem2) {
-		perror("realloc");
-		goto createScopeValueAbort;
+
+	/* Add value to local scope, doubling its space when it is full */
+	if (dest->numvals == dest->size) {
+		STAT_COUNT(valuegrowths);
+		if (!reserveScopeValues(dest, dest->size ? dest->size * 2 : 4))
+			goto createScopeValueAbort;
 	}
 
-	dest->names = mem1;
-	dest->values = mem2;
 	dest->names[dest->numvals] = name;
 	dest->values[dest->numvals] = createNilValueObject();
-	if (!dest->values[dest->numvals]) goto createScopeValueAbort;
-	dest->numvals = newnumvals;
+	dest->numvals++;
+	if (!indexScopeValue(dest)) {
+		dest->numvals--;
+		deleteValueObject(dest->values[dest->numvals]);
+		goto createScopeValueAbort;
+	}
+	if (!key.atom) dest->numcopies++;
 
 	return dest->values[dest->numvals - 1];
 
 createScopeValueAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
-	if (name) free(name);
-	if (mem1) free(mem1);
-	if (mem2) free(mem2);
+	deleteName(name);
+	releaseScopeKey(&key);
 
 	return NULL;
 }
@@ -490,49 +1622,42 @@ ValueObject *updateScopeValue(ScopeObject *src,
 {
 	ScopeObject *parent = dest;
 	IdentifierNode *child = target;
+	ValueObject **slot = NULL;
 	int status;
-	char *name = NULL;
+	ScopeKey key;
 
 	/* Traverse the target to the terminal child and parent */
 	status = resolveTerminalSlot(src, dest, target, &parent, &child);
 	if (!status) goto updateScopeValueAbort;
 
+	/* Use the resolved position of the identifier, if any */
+	if ((slot = getResolvedScopeSlot(parent, child))) {
+		deleteValueObject(*slot);
+		*slot = value ? value : createNilValueObject();
+		return *slot;
+	}
+
 	/* Look up the identifier name */
-	name = resolveIdentifierName(child, src);
-	if (!name) goto updateScopeValueAbort;
+	if (!resolveScopeKey(child, src, &key)) goto updateScopeValueAbort;
 
 	/* Traverse upwards through scopes */
 	do {
-		unsigned int n;
 		/* Check for existing value in current scope */
-		for (n = 0; n < parent->numvals; n++) {
-			if (!strcmp(parent->names[n], name)) {
-				free(name);
-				/* Wipe out the old value */
-				deleteValueObject(parent->values[n]);
-				/* Assign the new value */
-				if (value) {
-					parent->values[n] = value;
-				}
-				else {
-					parent->values[n] = createNilValueObject();
-				}
-				return parent->values[n];
-			}
+		if ((slot = findScopeKey(parent, &key))) {
+			releaseScopeKey(&key);
+			/* Wipe out the old value */
+			deleteValueObject(*slot);
+			/* Assign the new value */
+			*slot = value ? value : createNilValueObject();
+			return *slot;
 		}
 	} while ((parent = parent->parent));
 
-	{
-		char *name = resolveIdentifierName(target, src);
-		error(IN_UNABLE_TO_STORE_VARIABLE, target->fname, target->line, name);
-		free(name);
-	}
+	error(IN_UNABLE_TO_STORE_VARIABLE, target->fname, target->line, getScopeKeyName(&key));
+	releaseScopeKey(&key);
 
 updateScopeValueAbort: /* In case something goes wrong... */
 
-	/* Clean up any allocated structures */
-	if (name) free(name);
-
 	return NULL;
 }
 
@@ -556,40 +1681,34 @@ ValueObject *getScopeValue(ScopeObject *src,
 {
 	ScopeObject *parent = dest;
 	IdentifierNode *child = target;
-	char *name = NULL;
+	ValueObject **slot = NULL;
+	ScopeKey key;
 	int status;
 
 	/* Traverse the target to the terminal child and parent */
 	status = resolveTerminalSlot(src, dest, target, &parent, &child);
 	if (!status) goto getScopeValueAbort;
 
+	/* Use the resolved position of the identifier, if any */
+	if ((slot = getResolvedScopeSlot(parent, child))) return *slot;
+
 	/* Look up the identifier name */
-	name = resolveIdentifierName(child, src);
-	if (!name) goto getScopeValueAbort;
+	if (!resolveScopeKey(child, src, &key)) goto getScopeValueAbort;
 
 	/* Traverse upwards through scopes */
 	do {
-		unsigned int n;
 		/* Check for value in current scope */
-		for (n = 0; n < parent->numvals; n++) {
-			if (!strcmp(parent->names[n], name)) {
-				free(name);
-				return parent->values[n];
-			}
+		if ((slot = findScopeKey(parent, &key))) {
+			releaseScopeKey(&key);
+			return *slot;
 		}
 	} while ((parent = parent->parent));
 
-	{
-		char *name = resolveIdentifierName(child, src);
-		error(IN_VARIABLE_DOES_NOT_EXIST, child->fname, child->line, name);
-		free(name);
-	}
+	error(IN_VARIABLE_DOES_NOT_EXIST, child->fname, child->line, getScopeKeyName(&key));
+	releaseScopeKey(&key);
 
 getScopeValueAbort: /* In case something goes wrong... */
 
-	/* Clean up any allocated structures */
-	if (name) free(name);
-
 	return NULL;
 }
 
@@ -614,48 +1733,45 @@ ScopeObject *getScopeObjectLocal(ScopeObject *src,
                                  IdentifierNode *target)
 {
 	ScopeObject *current = dest;
-	char *name = NULL;
+	ValueObject **slot = NULL;
+	ScopeKey key;
+
+	/* Use the resolved position of the identifier, if any */
+	slot = getResolvedScopeSlot(dest, target);
+	if (slot && getType((*slot)) == VT_ARRAY) return getArray((*slot));
 
 	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto getScopeObjectLocalAbort;
+	if (!resolveScopeKey(target, src, &key)) return NULL;
 
 	/* Check for calling object reference variable */
-	if (!strcmp(name, "ME")) {
+	if (key.name && !strcmp(key.name, "ME")) {
+		releaseScopeKey(&key);
 		/* Traverse upwards through callers */
 		for (current = dest;
 				current->caller;
 				current = current->caller);
-		free(name);
 		return current;
 	}
 
 	/* Traverse upwards through scopes */
 	do {
-		unsigned int n;
 		/* Check for value in current scope */
-		for (n = 0; n < current->numvals; n++) {
-			if (!strcmp(current->names[n], name)) {
-				if (current->values[n]->type != VT_ARRAY) {
-					error(IN_VARIABLE_NOT_AN_ARRAY, target->fname, target->line, name);
-					goto getScopeObjectLocalAbort;
-				}
-				free(name);
-				return getArray(current->values[n]);
+		if ((slot = findScopeKey(current, &key))) {
+			if (getType((*slot)) != VT_ARRAY) {
+				error(IN_VARIABLE_NOT_AN_ARRAY, target->fname, target->line, getScopeKeyName(&key));
+				goto getScopeObjectLocalAbort;
 			}
+			releaseScopeKey(&key);
+			return getArray((*slot));
 		}
 	} while ((current = current->parent));
 
-	{
-		char *name = resolveIdentifierName(target, src);
-		error(IN_VARIABLE_DOES_NOT_EXIST, target->fname, target->line, name);
-		free(name);
-	}
+	error(IN_VARIABLE_DOES_NOT_EXIST, target->fname, target->line, getScopeKeyName(&key));
 
 getScopeObjectLocalAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
-	if (name) free(name);
+	releaseScopeKey(&key);
 
 	return NULL;
 }
@@ -675,62 +1791,59 @@ getScopeObjectLocalAbort: /* In case something goes wrong... */
  * \retval NULL Either \a target could not be evaluated in \a src or \a target
  * could not be found in \a dest.
  */
-/** \todo Add this definition to interpreter.h */
 ScopeObject *getScopeObjectLocalCaller(ScopeObject *src,
                                  ScopeObject *dest,
                                  IdentifierNode *target)
 {
 	ScopeObject *current = dest;
-	char *name = NULL;
+	ValueObject **slot = NULL;
+	ScopeKey key;
+
+	/* Use the resolved position of the identifier, if any */
+	slot = getResolvedScopeSlot(dest, target);
+	if (slot && getType((*slot)) == VT_ARRAY) return getArray((*slot));
+	if (slot && getType((*slot)) == VT_FUNC) return dest;
 
 	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto getScopeObjectLocalCallerAbort;
+	if (!resolveScopeKey(target, src, &key)) return NULL;
 
 	/* Check for calling object reference variable */
-	if (!strcmp(name, "ME")) {
+	if (key.name && !strcmp(key.name, "ME")) {
+		releaseScopeKey(&key);
 		/* Traverse upwards through callers */
 		for (current = dest;
 				current->caller;
 				current = current->caller);
-		free(name);
 		return current;
 	}
 
 	/* Traverse upwards through scopes */
 	do {
-		unsigned int n;
 		/* Check for value in current scope */
-		for (n = 0; n < current->numvals; n++) {
-			if (!strcmp(current->names[n], name)) {
-				if (current->values[n]->type != VT_ARRAY
-						&& current->values[n]->type != VT_FUNC) {
-					error(IN_VARIABLE_NOT_AN_ARRAY, target->fname, target->line, name);
-					goto getScopeObjectLocalCallerAbort;
-				}
-				free(name);
-				if (current->values[n]->type == VT_ARRAY)
-				{
-					return getArray(current->values[n]);
-				}
-				else
-				{
-					return dest;
-				}
+		if ((slot = findScopeKey(current, &key))) {
+			if (getType((*slot)) != VT_ARRAY
+					&& getType((*slot)) != VT_FUNC) {
+				error(IN_VARIABLE_NOT_AN_ARRAY, target->fname, target->line, getScopeKeyName(&key));
+				goto getScopeObjectLocalCallerAbort;
+			}
+			releaseScopeKey(&key);
+			if (getType((*slot)) == VT_ARRAY)
+			{
+				return getArray((*slot));
+			}
+			else
+			{
+				return dest;
 			}
 		}
 	} while ((current = current->parent));
 
-	{
-		char *name = resolveIdentifierName(target, src);
-		error(IN_VARIABLE_DOES_NOT_EXIST, target->fname, target->line, name);
-		free(name);
-	}
+	error(IN_VARIABLE_DOES_NOT_EXIST, target->fname, target->line, getScopeKeyName(&key));
 
 getScopeObjectLocalCallerAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
-	if (name) free(name);
+	releaseScopeKey(&key);
 
 	return NULL;
 }
@@ -754,8 +1867,8 @@ ValueObject *getScopeValueLocal(ScopeObject *src,
                                 ScopeObject *dest,
                                 IdentifierNode *target)
 {
-	unsigned int n;
-	char *name = NULL;
+	ValueObject **slot = NULL;
+	ScopeKey key;
 	ScopeObject *scope = NULL;
 
 	/* Access any slots */
@@ -771,24 +1884,19 @@ ValueObject *getScopeValueLocal(ScopeObject *src,
 		target = target->slot;
 	}
 
-	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto getScopeValueLocalAbort;
-
-	/* Check for value in current scope */
-	for (n = 0; n < dest->numvals; n++) {
-		if (!strcmp(dest->names[n], name)) {
-			free(name);
-			return dest->values[n];
-		}
+	/* Use the resolved position of the identifier, if it is local */
+	if (target->depth == 0) {
+		slot = getResolvedScopeSlot(dest, target);
+		if (slot) return *slot;
 	}
 
-getScopeValueLocalAbort: /* In case something goes wrong... */
-
-	/* Clean up any allocated structures */
-	if (name) free(name);
+	/* Look up the identifier name */
+	if (!resolveScopeKey(target, src, &key)) return NULL;
 
-	return NULL;
+	/* Check for value in current scope */
+	slot = findScopeKey(dest, &key);
+	releaseScopeKey(&key);
+	return slot ? *slot : NULL;
 }
 
 /**
@@ -811,61 +1919,75 @@ ScopeObject *getScopeObject(ScopeObject *src,
                             IdentifierNode *target)
 {
 	ValueObject *val = NULL;
+	IdentifierNode *evaluated = NULL;
+	IdentifierNode *id = NULL;
 	char *name = NULL;
-	int status;
 	int isI;
 	int isME;
-	ScopeObject *scope;
-	
-	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto getScopeObjectAbort;
+	ScopeObject *scope = NULL;
+
+	/* Evaluate the name of the scope only once */
+	evaluated = id = evaluateIdentifierNode(target, src);
+	if (!id) return NULL;
 
 	/* Check for targets with special meanings */
-	isI = strcmp(name, "I");
-	isME = strcmp(name, "ME");
-	free(name);
-	name = NULL;
+	if (id->type == IT_DIRECT) {
+		isI = strcmp(id->id, "I");
+		isME = strcmp(id->id, "ME");
+	}
+	else if (id->slot) {
+		/* Look up the identifier name */
+		name = resolveIdentifierName(id, src);
+		if (!name) goto getScopeObjectAbort;
+		isI = strcmp(name, "I");
+		isME = strcmp(name, "ME");
+		free(name);
+		name = NULL;
+	}
+	else {
+		/* Indices have no special meaning */
+		isI = isME = 1;
+	}
 
 	if (!isI) {
 		/* The function scope variable */
-		return src;
+		scope = src;
 	}
 	else if (!isME) {
 		/* The calling object scope variable */
-		scope = getScopeObjectLocal(src, dest, target);
-		if (!scope) goto getScopeObjectAbort;
-		return scope;
+		scope = getScopeObjectLocal(src, dest, id);
 	}
+	else {
+		/* Access any slots */
+		while (id->slot) {
+			/*
+			 * Look up the target in the dest scope, using the src
+			 * scope for resolving variables in indirect identifiers
+			 */
+			dest = getScopeObjectLocal(src, dest, id);
+			if (!dest) goto getScopeObjectAbort;
 
-	/* Access any slots */
-	while (target->slot) {
-		/*
-		 * Look up the target in the dest scope, using the src scope
-		 * for resolving variables in indirect identifiers
-		 */
-		scope = getScopeObjectLocal(src, dest, target);
-		if (!scope) goto getScopeObjectAbort;
-		dest = scope;
-
-		target = target->slot;
-	}
+			id = id->slot;
+		}
 
-	val = getScopeValue(src, dest, target);
-	if (!val) goto getScopeObjectAbort;
-	if (val->type != VT_ARRAY) {
-		char *name = resolveIdentifierName(target, src);
-		error(IN_VARIABLE_NOT_AN_ARRAY, target->fname, target->line, name);
-		free(name);
-		goto getScopeObjectAbort;
+		val = getScopeValue(src, dest, id);
+		if (!val) goto getScopeObjectAbort;
+		if (getType(val) != VT_ARRAY) {
+			name = resolveIdentifierName(id, src);
+			error(IN_VARIABLE_NOT_AN_ARRAY, id->fname, id->line, name);
+			goto getScopeObjectAbort;
+		}
+		scope = getArray(val);
 	}
 
-	return getArray(val);
+	deleteEvaluatedIdentifierNode(evaluated, target);
+	return scope;
 
 getScopeObjectAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
 	if (name) free(name);
+	deleteEvaluatedIdentifierNode(evaluated, target);
 
 	return NULL;
 }
@@ -884,9 +2006,8 @@ void deleteScopeValue(ScopeObject *src,
                       IdentifierNode *target)
 {
 	ScopeObject *current = NULL;
+	ScopeKey key;
 	char *name = NULL;
-	void *mem1 = NULL;
-	void *mem2 = NULL;
 	ScopeObject *scope = NULL;
 
 	/* Access any slots */
@@ -903,55 +2024,53 @@ void deleteScopeValue(ScopeObject *src,
 	current = dest;
 
 	/* Look up the identifier name */
-	name = resolveIdentifierName(target, src);
-	if (!name) goto deleteScopeValueAbort;
+	if (!resolveScopeKey(target, src, &key)) goto deleteScopeValueAbort;
+	name = getScopeKeyName(&key);
 
 	/* Traverse upwards through scopes */
 	do {
-		unsigned int n;
+		int n;
+		/* Leave a gap in the elements, dropping any at the end */
+		if (!key.name && key.index < current->numelems) {
+			if (!current->elems[key.index]) continue;
+			deleteValueObject(current->elems[key.index]);
+			current->elems[key.index] = NULL;
+			while (current->numelems > 0
+					&& !current->elems[current->numelems - 1])
+				current->numelems--;
+			return;
+		}
 		/* Check for existing value in current scope */
-		for (n = 0; n < current->numvals; n++) {
-			if (!strcmp(current->names[n], name)) {
-				unsigned int i;
-				unsigned int newnumvals = dest->numvals - 1;
-				free(name);
-				/* Wipe out the name and value */
-				free(current->names[n]);
-				deleteValueObject(current->values[n]);
-				/* Reorder the tables */
-				for (i = n; i < current->numvals - 1; i++) {
-					current->names[i] = current->names[i + 1];
-					current->values[i] = current->values[i + 1];
-				}
-				/* Resize the tables */
-				mem1 = realloc(dest->names, sizeof(IdentifierNode *) * newnumvals);
-				if (!mem1) {
-					perror("realloc");
-					goto deleteScopeValueAbort;
-				}
-				mem2 = realloc(dest->values, sizeof(ValueObject *) * newnumvals);
-				if (!mem2) {
-					perror("realloc");
-					goto deleteScopeValueAbort;
-				}
-				dest->names = mem1;
-				dest->values = mem2;
-				dest->numvals = newnumvals;
-				return;
+		n = findScopeName(current, name, key.atom);
+		if (n >= 0) {
+			unsigned int i;
+			releaseScopeKey(&key);
+			if (!key.name) current->numsparse--;
+			/* Wipe out the value */
+			deleteValueObject(current->values[n]);
+			if (!isAtom(current->names[n])) {
+				deleteName(current->names[n]);
+				current->numcopies--;
+			}
+			/* Reorder the tables */
+			for (i = n; i < current->numvals - 1; i++) {
+				current->names[i] = current->names[i + 1];
+				current->values[i] = current->values[i + 1];
 			}
+			/* The space at the end is kept for new values */
+			current->numvals--;
+			/* Positions changed, so the hash table is rebuilt in place */
+			if (current->table) rehashScopeValues(current, current->tablesize);
+			return;
 		}
 	} while ((current = current->parent));
-
-	free(name);
+	releaseScopeKey(&key);
 
 	return;
 
 deleteScopeValueAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
-	if (name) free(name);
-	if (mem1) free(mem1);
-	if (mem2) free(mem2);
 	if (scope) free(scope);
 
 	return;
@@ -964,6 +2083,9 @@ deleteScopeValueAbort: /* In case something goes wrong... */
  *
  * \param [in] value An optional value to return.
  *
+ * \note Default returns without a value, returned by nearly every statement,
+ * share a single static object.
+ *
  * \return A pointer to a returned value with the desired properties.
  *
  * \retval NULL Memory allocation failed.
@@ -971,13 +2093,17 @@ deleteScopeValueAbort: /* In case something goes wrong... */
 ReturnObject *createReturnObject(ReturnType type,
                                  ValueObject *value)
 {
-	ReturnObject *p = malloc(sizeof(ReturnObject));
-	if (!p) {
-		perror("malloc");
-		return NULL;
+	ReturnObject *p = NULL;
+	if (type == RT_DEFAULT && !value) {
+		countAvoidedAllocation(&ReturnPool);
+		return &DefaultReturn;
 	}
+	p = allocatePoolObject(&ReturnPool);
+	if (!p) return NULL;
 	p->type = type;
 	p->value = value;
+	p->func = NULL;
+	p->scope = NULL;
 	return p;
 }
 
@@ -990,10 +2116,12 @@ ReturnObject *createReturnObject(ReturnType type,
  */
 void deleteReturnObject(ReturnObject *object)
 {
-	if (!object) return;
-	if (object->type == RT_RETURN)
+	if (!object || object == &DefaultReturn) return;
+	if (object->type == RT_RETURN) {
 		deleteValueObject(object->value);
-	free(object);
+		deleteScopeObject(object->scope);
+	}
+	freePoolObject(&ReturnPool, object);
 }
 
 /**
@@ -1100,7 +2228,7 @@ ValueObject *castIntegerImplicit(ValueObject *node,
                                  ScopeObject *scope)
 {
 	if (!node) return NULL;
-	if (node->type == VT_NIL) {
+	if (getType(node) == VT_NIL) {
 		error(IN_CANNOT_IMPLICITLY_CAST_NIL);
 		return NULL;
 	}
@@ -1125,7 +2253,7 @@ ValueObject *castFloatImplicit(ValueObject *node,
                                ScopeObject *scope)
 {
 	if (!node) return NULL;
-	if (node->type == VT_NIL) {
+	if (getType(node) == VT_NIL) {
 		error(IN_CANNOT_IMPLICITLY_CAST_NIL);
 		return NULL;
 	}
@@ -1154,7 +2282,7 @@ ValueObject *castStringImplicit(ValueObject *node,
                                 ScopeObject *scope)
 {
 	if (!node) return NULL;
-	if (node->type == VT_NIL) {
+	if (getType(node) == VT_NIL) {
 		error(IN_CANNOT_IMPLICITLY_CAST_NIL);
 		return NULL;
 	}
@@ -1179,7 +2307,7 @@ ValueObject *castBooleanExplicit(ValueObject *node,
                                  ScopeObject *scope)
 {
 	if (!node) return NULL;
-	switch (node->type) {
+	switch (getType(node)) {
 		case VT_NIL:
 			return createBooleanValueObject(0);
 		case VT_BOOLEAN:
@@ -1230,7 +2358,7 @@ ValueObject *castIntegerExplicit(ValueObject *node,
                                  ScopeObject *scope)
 {
 	if (!node) return NULL;
-	switch (node->type) {
+	switch (getType(node)) {
 		case VT_NIL:
 			return createIntegerValueObject(0);
 		case VT_BOOLEAN:
@@ -1250,8 +2378,15 @@ ValueObject *castIntegerExplicit(ValueObject *node,
 				return ret;
 			}
 			else {
-				long long value = strtoll(getString(node), NULL, 0);
-				return createIntegerValueObject(value);
+				ValueObject *ret = NULL;
+				long long value;
+				/* Casts without interpolation only depend on the string */
+				if (scope && (ret = findCastCache(node, VT_INTEGER)))
+					return ret;
+				value = strtoll(getString(node), NULL, 0);
+				ret = createIntegerValueObject(value);
+				if (scope) storeCastCache(node, VT_INTEGER, ret);
+				return ret;
 			}
 		case VT_FUNC:
 			error(IN_CANNOT_CAST_FUNCTION_TO_INTEGER);
@@ -1283,7 +2418,7 @@ ValueObject *castFloatExplicit(ValueObject *node,
                                ScopeObject *scope)
 {
 	if (!node) return NULL;
-	switch (node->type) {
+	switch (getType(node)) {
 		case VT_NIL:
 			return createFloatValueObject(0.0);
 		case VT_BOOLEAN:
@@ -1303,8 +2438,15 @@ ValueObject *castFloatExplicit(ValueObject *node,
 				return ret;
 			}
 			else {
-				float value = strtof(getString(node), NULL);
-				return createFloatValueObject(value);
+				ValueObject *ret = NULL;
+				float value;
+				/* Casts without interpolation only depend on the string */
+				if (scope && (ret = findCastCache(node, VT_FLOAT)))
+					return ret;
+				value = strtof(getString(node), NULL);
+				ret = createFloatValueObject(value);
+				if (scope) storeCastCache(node, VT_FLOAT, ret);
+				return ret;
 			}
 		case VT_FUNC:
 			error(IN_CANNOT_CAST_FUNCTION_TO_DECIMAL);
@@ -1318,6 +2460,95 @@ ValueObject *castFloatExplicit(ValueObject *node,
 	}
 }
 
+/**
+ * Interpolates a string using the template built when it was parsed.  Only
+ * the variables within the string are looked up and cast; the rest of the
+ * string was decoded when the template was built and is copied as-is.
+ *
+ * \param [in] tmpl The template of \a node.
+ *
+ * \param [in] node The string value to interpolate.
+ *
+ * \param [in] scope The scope to use for variable interpolation.
+ *
+ * \return A pointer to a string-type value with the interpolated contents of
+ * \a node.
+ *
+ * \retval NULL An error occurred while interpolating.
+ */
+ValueObject *interpolateStringTemplate(StringTemplate *tmpl,
+                                       ValueObject *node,
+                                       ScopeObject *scope)
+{
+	ValueObject *local[8];
+	ValueObject **vals = local;
+	ValueObject *ret = NULL;
+	char *data = NULL;
+	size_t size = tmpl->length;
+	size_t a = 0;
+	unsigned int n;
+	/* Strings without escape sequences are already interpolated */
+	if (tmpl->plain) return copyValueObject(node);
+	/* Strings without variables always interpolate to the same text */
+	if (tmpl->num == 0)
+		return createBorrowedStringValueObject((char *)"", NULL);
+	if (tmpl->num == 1 && tmpl->segs[0].type == SG_TEXT)
+		return createBorrowedStringValueObject(tmpl->segs[0].text, NULL);
+	if (tmpl->num > sizeof(local) / sizeof(ValueObject *)) {
+		vals = malloc(sizeof(ValueObject *) * tmpl->num);
+		if (!vals) {
+			perror("malloc");
+			return NULL;
+		}
+	}
+	for (n = 0; n < tmpl->num; n++) vals[n] = NULL;
+	/* Cast each variable to a string */
+	for (n = 0; n < tmpl->num; n++) {
+		TemplateSegment *seg = &tmpl->segs[n];
+		ValueObject *val = NULL;
+		if (seg->type == SG_TEXT) continue;
+		if (seg->type == SG_IMPVAR)
+			/* Lookup implicit variable */
+			val = scope->impvar;
+		else {
+			val = getScopeValue(scope, scope, seg->id);
+			if (!val) goto interpolateStringTemplateAbort;
+		}
+		if (!(vals[n] = castStringImplicit(val, scope)))
+			goto interpolateStringTemplateAbort;
+		size += strlen(getString(vals[n]));
+	}
+	/* Join the segments into a single allocation */
+	data = malloc(sizeof(char) * (size + 1));
+	if (!data) {
+		perror("malloc");
+		goto interpolateStringTemplateAbort;
+	}
+	for (n = 0; n < tmpl->num; n++) {
+		if (tmpl->segs[n].type == SG_TEXT) {
+			memcpy(data + a, tmpl->segs[n].text, tmpl->segs[n].length);
+			a += tmpl->segs[n].length;
+		}
+		else {
+			size_t len = strlen(getString(vals[n]));
+			memcpy(data + a, getString(vals[n]), len);
+			a += len;
+		}
+	}
+	data[a] = '\0';
+	ret = createStringValueObject(data);
+	if (!ret) free(data);
+
+interpolateStringTemplateAbort: /* Exception handling */
+
+	/* Clean up the cast variables */
+	for (n = 0; n < tmpl->num; n++)
+		if (vals[n]) deleteValueObject(vals[n]);
+	if (vals != local) free(vals);
+
+	return ret;
+}
+
 /**
  * Casts the contents of a value to string type in an explicit way.  Casting is
  * not done directly to \a node, instead, it is performed on a copy which is
@@ -1340,7 +2571,7 @@ ValueObject *castStringExplicit(ValueObject *node,
                                 ScopeObject *scope)
 {
 	if (!node) return NULL;
-	switch (node->type) {
+	switch (getType(node)) {
 		case VT_NIL: {
 			char *str = copyString("");
 			if (!str) return NULL;
@@ -1356,30 +2587,53 @@ ValueObject *castStringExplicit(ValueObject *node,
 		}
 		case VT_INTEGER: {
 			char *data = NULL;
+			ValueObject *ret = NULL;
 			/*
 			 * One character per integer bit plus one more for the
 			 * null character
 			 */
 			size_t size = sizeof(long long) * 8 + 1;
+			/* Immediate values are identified by their contents */
+			if (scope && isImmediate(node)
+					&& (ret = findCastCache(node, VT_STRING)))
+				return ret;
 			data = malloc(sizeof(char) * size);
 			if (!data) return NULL;
 			sprintf(data, "%lli", getInteger(node));
-			return createStringValueObject(data);
+			ret = createStringValueObject(data);
+			if (!ret) {
+				free(data);
+				return NULL;
+			}
+			if (scope && isImmediate(node))
+				storeCastCache(node, VT_STRING, ret);
+			return ret;
 		}
 		case VT_FLOAT: {
 			char *data = NULL;
+			ValueObject *ret = NULL;
 			unsigned int precision = 2;
 			/*
 			 * One character per float bit plus one more for the
 			 * null character
 			 */
 			size_t size = sizeof(float) * 8 + 1;
+			if (scope && isImmediate(node)
+					&& (ret = findCastCache(node, VT_STRING)))
+				return ret;
 			data = malloc(sizeof(char) * size);
 			if (!data) return NULL;
 			sprintf(data, "%f", getFloat(node));
 			/* Truncate to a certain number of decimal places */
 			strchr(data, '.')[precision + 1] = '\0';
-			return createStringValueObject(data);
+			ret = createStringValueObject(data);
+			if (!ret) {
+				free(data);
+				return NULL;
+			}
+			if (scope && isImmediate(node))
+				storeCastCache(node, VT_STRING, ret);
+			return ret;
 		}
 		case VT_STRING: {
 			char *temp = NULL;
@@ -1387,7 +2641,15 @@ ValueObject *castStringExplicit(ValueObject *node,
 			char *str = getString(node);
 			unsigned int a, b;
 			size_t size;
+			/* Use a template built when the string was parsed */
+			if (node->tmpl) {
+				STAT_COUNT(templates);
+				return interpolateStringTemplate(node->tmpl, node, scope);
+			}
+			/* Strings without escape sequences are already interpolated */
+			if (node->plain) return copyValueObject(node);
 			/* Perform interpolation */
+			STAT_COUNT(scans);
 			size = strlen(getString(node)) + 1;
 			temp = malloc(sizeof(char) * size);
 			for (a = 0, b = 0; str[b] != '\0'; ) {
@@ -1417,7 +2679,7 @@ ValueObject *castStringExplicit(ValueObject *node,
 					size_t len;
 					char *image = NULL;
 					long codepoint;
-					char out[3];
+					char out[4];
 					size_t num;
 					void *mem = NULL;
 					if (end < start) {
@@ -1464,7 +2726,7 @@ ValueObject *castStringExplicit(ValueObject *node,
 					size_t len;
 					char *image = NULL;
 					long codepoint;
-					char out[3];
+					char out[4];
 					size_t num;
 					void *mem = NULL;
 					if (end < start) {
@@ -1523,20 +2785,24 @@ ValueObject *castStringExplicit(ValueObject *node,
 						 * structure and look up its
 						 * value
 						 */
-						target = createIdentifierNode(IT_DIRECT, image, NULL, NULL, 0);
+						char *name = copyName(image);
+						target = name ? createIdentifierNode(IT_DIRECT, name, NULL, NULL, 0) : NULL;
 						if (!target) {
+							deleteName(name);
+							free(image);
 							free(temp);
 							return NULL;
 						}
 						val = getScopeValue(scope, scope, target);
+						deleteIdentifierNode(target);
+						deleteName(name);
 						if (!val) {
-							error(IN_VARIABLE_DOES_NOT_EXIST, target->fname, target->line, image);
-							deleteIdentifierNode(target);
+							free(image);
 							free(temp);
 							return NULL;
 						}
-						deleteIdentifierNode(target);
 					}
+					free(image);
 					/* Cast the variable value to a string */
 					if (!(use = castStringImplicit(val, scope))) {
 						free(temp);
@@ -1547,7 +2813,9 @@ ValueObject *castStringExplicit(ValueObject *node,
 					mem = realloc(temp, size);
 					if (!mem) {
 						perror("realloc");
+						deleteValueObject(use);
 						free(temp);
+						return NULL;
 					}
 					temp = mem;
 					/* Copy the variable string into the new string */
@@ -1579,6 +2847,37 @@ ValueObject *castStringExplicit(ValueObject *node,
 	}
 }
 
+/**
+ * Gets the truth value of a value, the way conditions and boolean operations
+ * use it.  Booleans and integers are used directly and all other values are
+ * implicitly cast to booleans.
+ *
+ * \param [in] val The value to get the truth value of.
+ *
+ * \param [in] scope The scope to perform any string interpolation under.
+ *
+ * \param [out] truth The truth value of \a val.
+ *
+ * \retval 0 An error occurred while casting \a val.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+int getBooleanValue(ValueObject *val,
+                    ScopeObject *scope,
+                    int *truth)
+{
+	ValueObject *use = NULL;
+	if (getType(val) == VT_BOOLEAN || getType(val) == VT_INTEGER) {
+		*truth = getInteger(val);
+		return 1;
+	}
+	use = castBooleanImplicit(val, scope);
+	if (!use) return 0;
+	*truth = getInteger(use);
+	deleteValueObject(use);
+	return 1;
+}
+
 /**
  * Interprets an implicit variable.
  *
@@ -1596,7 +2895,7 @@ ValueObject *interpretImpVarExprNode(ExprNode *node,
                                      ScopeObject *scope)
 {
 	node = NULL;
-	return scope->impvar;
+	return copyValueObject(scope->impvar);
 }
 
 /**
@@ -1647,64 +2946,113 @@ ValueObject *interpretCastExprNode(ExprNode *node,
 }
 
 /**
- * Interprets a function call.
+ * Finds the function a call refers to and checks that it is supplied the
+ * correct number of arguments.
  *
- * \param [in] node A pointer to the expression to interpret.
+ * \param [in] expr The function call.
  *
- * \param [in,out] scope A pointer to a scope to evaluate \a node under.
+ * \param [in] scope The scope the call is made from.
  *
- * \pre \a node contains an expression created by createFuncCallExprNode().
+ * \param [out] target The scope the function is called on.
  *
- * \return A pointer to the returned value.
+ * \return The definition of the function called by \a expr.
  *
- * \retval NULL An error occurred during interpretation.
+ * \retval NULL The function could not be found or was supplied the wrong
+ * number of arguments.
  */
-ValueObject *interpretFuncCallExprNode(ExprNode *node,
-                                       ScopeObject *scope)
+FuncDefStmtNode *getFuncCallTarget(FuncCallExprNode *expr,
+                                   ScopeObject *scope,
+                                   ScopeObject **target)
 {
-	FuncCallExprNode *expr = (FuncCallExprNode *)node->expr;
-	unsigned int n;
-	ScopeObject *outer = NULL;
-	ValueObject *def = NULL;
-	ReturnObject *retval = NULL;
-	ValueObject *ret = NULL;
-	ScopeObject *dest = NULL;
-	ScopeObject *target = NULL;
+	FuncDefStmtNode *func = NULL;
+	IdentifierNode *name = expr->name;
 
-	dest = getScopeObject(scope, scope, expr->scope);
+	/* Functions resolved to the outermost scope are called from here */
+	func = getResolvedFunction(scope, expr);
+	if (func) *target = scope;
+	else {
+		ScopeObject *dest = NULL;
+		ValueObject *def = NULL;
 
-	target = getScopeObjectLocalCaller(scope, dest, expr->name);
-	if (!target) return NULL;
+		dest = getScopeObject(scope, scope, expr->scope);
+		if (!dest) return NULL;
 
-	outer = createScopeObjectCaller(scope, target);
-	if (!outer) return NULL;
+		/* Evaluate the name of the function only once */
+		name = evaluateIdentifierNode(expr->name, scope);
+		if (!name) return NULL;
 
-	def = getScopeValue(scope, dest, expr->name);
+		*target = getScopeObjectLocalCaller(scope, dest, name);
+		if (!*target) goto getFuncCallTargetAbort;
 
-	if (!def || def->type != VT_FUNC) {
-		IdentifierNode *id = (IdentifierNode *)(expr->name);
-		char *name = resolveIdentifierName(id, scope);
-		if (name) {
-			error(IN_UNDEFINED_FUNCTION, id->fname, id->line, name);
-			free(name);
+		def = getScopeValue(scope, dest, name);
+		if (!def) goto getFuncCallTargetAbort;
+
+		if (getType(def) != VT_FUNC) {
+			char *str = resolveIdentifierName(name, scope);
+			if (str) {
+				error(IN_UNDEFINED_FUNCTION, name->fname, name->line, str);
+				free(str);
+			}
+			goto getFuncCallTargetAbort;
 		}
-		deleteScopeObject(outer);
-		return NULL;
+		func = getFunction(def);
 	}
 	/* Check for correct supplied arity */
-	if (getFunction(def)->args->num != expr->args->num) {
-		IdentifierNode *id = (IdentifierNode *)(expr->name);
-		char *name = resolveIdentifierName(id, scope);
-		if (name) {
-			error(IN_INCORRECT_NUMBER_OF_ARGUMENTS, id->fname, id->line, name);
-			free(name);
+	if (func->args->num != expr->args->num) {
+		char *str = resolveIdentifierName(name, scope);
+		if (str) {
+			error(IN_INCORRECT_NUMBER_OF_ARGUMENTS, name->fname, name->line, str);
+			free(str);
 		}
+		goto getFuncCallTargetAbort;
+	}
+	deleteEvaluatedIdentifierNode(name, expr->name);
+	return func;
+
+getFuncCallTargetAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	deleteEvaluatedIdentifierNode(name, expr->name);
+
+	return NULL;
+}
+
+/**
+ * Creates the scope of a function call and binds its arguments.
+ *
+ * \param [in] expr The function call.
+ *
+ * \param [in] scope The scope the call is made from.
+ *
+ * \param [out] func The definition of the function called.
+ *
+ * \return The scope to execute the body of \a func under.
+ *
+ * \retval NULL An error occurred while finding the function or evaluating
+ * its arguments.
+ */
+static ScopeObject *createFuncCallScope(FuncCallExprNode *expr,
+                                        ScopeObject *scope,
+                                        FuncDefStmtNode **func)
+{
+	ScopeObject *outer = NULL;
+	ScopeObject *target = NULL;
+	unsigned int n;
+
+	*func = getFuncCallTarget(expr, scope, &target);
+	if (!*func) return NULL;
+
+	/* Make space for the arguments and local variables up front */
+	outer = createScopeObjectCaller(scope, target);
+	if (!outer) return NULL;
+	if (!reserveScopeValues(outer, (*func)->locals)) {
 		deleteScopeObject(outer);
 		return NULL;
 	}
-	for (n = 0; n < getFunction(def)->args->num; n++) {
+
+	for (n = 0; n < (*func)->args->num; n++) {
 		ValueObject *val = NULL;
-		if (!createScopeValue(scope, outer, getFunction(def)->args->ids[n])) {
+		if (!createScopeValue(scope, outer, (*func)->args->ids[n])) {
 			deleteScopeObject(outer);
 			return NULL;
 		}
@@ -1712,20 +3060,109 @@ ValueObject *interpretFuncCallExprNode(ExprNode *node,
 			deleteScopeObject(outer);
 			return NULL;
 		}
-		if (!updateScopeValue(scope, outer, getFunction(def)->args->ids[n], val)) {
+		if (!updateScopeValue(scope, outer, (*func)->args->ids[n], val)) {
 			deleteScopeObject(outer);
 			deleteValueObject(val);
 			return NULL;
 		}
 	}
-	/**
-	 * \note We use interpretStmtNodeList here because we want to have
-	 * access to the function's scope as we may need to retrieve the
-	 * implicit variable in the case of a default return.
-	 */
-	if (!(retval = interpretStmtNodeList(getFunction(def)->body->stmts, outer))) {
-		deleteScopeObject(outer);
-		return NULL;
+	return outer;
+}
+
+/**
+ * Checks whether a function returning a call to another function may reuse
+ * its scope for the call.  Every variable the returning function may have
+ * created in its scope (see ReturnStmtNode) must be created by the called
+ * function before it looks up any variable it has not created, so that no
+ * look-up made during the call could have found a variable in the reused
+ * scope.
+ *
+ * \param [in] caller The returning function.
+ *
+ * \param [in] callee The called function.
+ *
+ * \param [in] scope The scope of the call, with its arguments bound.
+ *
+ * \note Casting a string containing a colon may look up any variable, so if
+ * \a callee must declare variables from its arguments to cover those of
+ * \a caller, no argument may be such a string.
+ *
+ * \retval 0 \a callee must be called in a new scope.
+ *
+ * \retval 1 \a callee may reuse the scope of \a caller.
+ */
+int canReuseFuncScope(FuncDefStmtNode *caller,
+                      FuncDefStmtNode *callee,
+                      ScopeObject *scope)
+{
+	unsigned int n, m;
+	int declared = 0;
+	if (caller->computed) return 0;
+	if (caller == callee) {
+		if (callee->created < callee->numnames) return 0;
+		declared = callee->numnames > callee->args->num;
+	}
+	else {
+		for (n = 0; n < caller->numnames; n++) {
+			for (m = 0; m < callee->created; m++) {
+				if (callee->names[m] == caller->names[n]) break;
+			}
+			if (m == callee->created) return 0;
+			if (m >= callee->args->num) declared = 1;
+		}
+	}
+	if (!declared) return 1;
+	for (n = 0; n < scope->numvals; n++) {
+		ValueObject *val = scope->values[n];
+		if (val && getType(val) == VT_STRING && strchr(getString(val), ':'))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Executes the body of a function.  A call returned in tail position replaces
+ * the values of \a outer and is executed in the same loop, so a chain of tail
+ * calls grows neither the C stack nor the number of scopes.
+ *
+ * \param [in] func The function to execute.
+ *
+ * \param [in,out] outer The scope of the call, with its arguments bound.
+ *
+ * \post \a outer will be deleted.
+ *
+ * \return A pointer to the returned value.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+static ValueObject *executeFunction(FuncDefStmtNode *func,
+                                    ScopeObject *outer)
+{
+	ReturnObject *retval = NULL;
+	ValueObject *ret = NULL;
+	while (1) {
+		if (CurrentProfile && !enterProfileFunction(CurrentProfile, func)) {
+			deleteScopeObject(outer);
+			return NULL;
+		}
+		/**
+		 * \note We use interpretStmtNodeList here because we want to
+		 * have access to the function's scope as we may need to
+		 * retrieve the implicit variable in the case of a default
+		 * return.
+		 */
+		retval = interpretStmtNodeList(func->body->stmts, outer);
+		if (CurrentProfile) leaveProfileFunction(CurrentProfile);
+		if (!retval) {
+			deleteScopeObject(outer);
+			return NULL;
+		}
+		if (retval->type != RT_RETURN || !retval->scope) break;
+		/* Continue with the tail call in the same scope */
+		func = retval->func;
+		replaceScopeValues(outer, retval->scope);
+		retval->scope = NULL;
+		deleteReturnObject(retval);
 	}
 	switch (retval->type) {
 		case RT_DEFAULT:
@@ -1750,6 +3187,29 @@ ValueObject *interpretFuncCallExprNode(ExprNode *node,
 	return ret;
 }
 
+/**
+ * Interprets a function call.
+ *
+ * \param [in] node A pointer to the expression to interpret.
+ *
+ * \param [in,out] scope A pointer to a scope to evaluate \a node under.
+ *
+ * \pre \a node contains an expression created by createFuncCallExprNode().
+ *
+ * \return A pointer to the returned value.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretFuncCallExprNode(ExprNode *node,
+                                       ScopeObject *scope)
+{
+	FuncCallExprNode *expr = (FuncCallExprNode *)node->expr;
+	FuncDefStmtNode *func = NULL;
+	ScopeObject *outer = createFuncCallScope(expr, scope, &func);
+	if (!outer) return NULL;
+	return executeFunction(func, outer);
+}
+
 /**
  * Interprets an identifier.
  *
@@ -1803,22 +3263,72 @@ ValueObject *interpretConstantExprNode(ExprNode *node,
 			return createIntegerValueObject(expr->data.i);
 		case CT_FLOAT:
 			return createFloatValueObject(expr->data.f);
-		case CT_STRING: {
+		case CT_STRING:
 			/*
 			 * \note For efficiency, string interpolation should be
 			 * performed by caller because it only needs to be
-			 * performed when necessary.
+			 * performed when necessary.  The value refers to the
+			 * constant's data and template instead of copying them.
 			 */
-			char *str = copyString(expr->data.s);
-			if (!str) return NULL;
-			return createStringValueObject(str);
-		}
+			return createBorrowedStringValueObject(expr->data.s, expr->tmpl);
 		default:
 			error(IN_UNKNOWN_CONSTANT_TYPE);
 			return NULL;
 	}
 }
 
+/**
+ * Checks whether an expression is a variable which can be looked up without
+ * evaluating anything, that is, one whose name and slots are all direct.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 \a node is not a variable or names it indirectly.
+ *
+ * \retval 1 \a node is a variable named directly.
+ */
+static int isDirectVariable(ExprNode *node)
+{
+	IdentifierNode *id = NULL;
+	if (node->type != ET_IDENTIFIER) return 0;
+	for (id = node->expr; id; id = id->slot)
+		if (id->type != IT_DIRECT) return 0;
+	return 1;
+}
+
+/**
+ * Gets the value of an operand which does not outlive the operation using it.
+ * A variable may be borrowed, that is, used in place without taking a
+ * reference to it, which is only safe if nothing evaluated before the value is
+ * done with can change the variable.  This avoids the reference counting of
+ * copying and deleting the values of variables read by operations.
+ *
+ * \param [in] node The operand to evaluate.
+ *
+ * \param [in] scope The scope to evaluate \a node under.
+ *
+ * \param [in] borrow Whether the value of a variable may be used in place.
+ *
+ * \param [out] owned Whether the returned value must be deleted by the caller.
+ *
+ * \return The value of \a node.
+ *
+ * \retval NULL An error occurred during evaluation.
+ */
+static ValueObject *getOperandValue(ExprNode *node,
+                                    ScopeObject *scope,
+                                    int borrow,
+                                    int *owned)
+{
+	if (borrow && isDirectVariable(node)) {
+		*owned = 0;
+		STAT_COUNT(borrows);
+		return getScopeValue(scope, scope, node->expr);
+	}
+	*owned = 1;
+	return interpretExprNode(node, scope);
+}
+
 /**
  * Interprets a logical NOT operation.
  *
@@ -1836,22 +3346,9 @@ ValueObject *interpretConstantExprNode(ExprNode *node,
 ValueObject *interpretNotOpExprNode(OpExprNode *expr,
                                     ScopeObject *scope)
 {
-	ValueObject *val = interpretExprNode(expr->args->exprs[0], scope);
-	ValueObject *use = val;
 	int retval;
-	unsigned short cast = 0;
-	if (!val) return NULL;
-	if (val->type != VT_BOOLEAN && val->type != VT_INTEGER) {
-		use = castBooleanImplicit(val, scope);
-		if (!use) {
-			deleteValueObject(val);
-			return NULL;
-		}
-		cast = 1;
-	}
-	retval = getInteger(use);
-	if (cast) deleteValueObject(use);
-	deleteValueObject(val);
+	if (!getConditionValue(expr->args->exprs[0], scope, &retval))
+		return NULL;
 	return createBooleanValueObject(!retval);
 }
 
@@ -2332,43 +3829,74 @@ static ValueObject *(*ArithOpJumpTable[7][2][2])(ValueObject *, ValueObject *) =
 };
 
 /**
- * Interprets an arithmetic operation.
+ * Interprets an arithmetic operation.
+ *
+ * \param [in] expr The operation to interpret.
+ *
+ * \param [in] scope The scope to evaluate \a expr under.
+ *
+ * \note Only supports binary arithmetic operations.
+ *
+ * \return A pointer to the value of the arithmetic operation.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretArithOpExprNode(OpExprNode *expr,
+                                      ScopeObject *scope)
+{
+	ExprNode *arg2 = expr->args->exprs[1];
+	ValueObject *val1 = NULL;
+	ValueObject *val2 = NULL;
+	ValueObject *ret = NULL;
+	int own1;
+	int own2;
+	/* The first operand stays valid if the second has no side effects */
+	val1 = getOperandValue(expr->args->exprs[0],
+			scope,
+			arg2->type == ET_CONSTANT || isDirectVariable(arg2),
+			&own1);
+	if (!val1) return NULL;
+	val2 = getOperandValue(arg2, scope, 1, &own2);
+	if (val2) ret = interpretArithOpValues(expr->type, val1, val2, scope);
+	if (own1) deleteValueObject(val1);
+	if (own2) deleteValueObject(val2);
+	return ret;
+}
+
+/**
+ * Performs an arithmetic operation on values which have already been
+ * evaluated.
  *
- * \param [in] expr The operation to interpret.
+ * \param [in] type The arithmetic operation to perform.
  *
- * \param [in] scope The scope to evaluate \a expr under.
+ * \param [in] val1 The first operand.
  *
- * \note Only supports binary arithmetic operations.
+ * \param [in] val2 The second operand.
+ *
+ * \param [in] scope The scope to perform any string interpolation under.
+ *
+ * \note Neither \a val1 nor \a val2 are deleted by this function.
  *
  * \return A pointer to the value of the arithmetic operation.
  *
  * \retval NULL An error occurred during interpretation.
  */
-ValueObject *interpretArithOpExprNode(OpExprNode *expr,
-                                      ScopeObject *scope)
+ValueObject *interpretArithOpValues(OpType type,
+                                    ValueObject *val1,
+                                    ValueObject *val2,
+                                    ScopeObject *scope)
 {
-	ValueObject *val1 = interpretExprNode(expr->args->exprs[0], scope);
-	ValueObject *val2 = interpretExprNode(expr->args->exprs[1], scope);
 	ValueObject *use1 = val1;
 	ValueObject *use2 = val2;
 	unsigned int cast1 = 0;
 	unsigned int cast2 = 0;
 	ValueObject *ret = NULL;
-	if (!val1 || !val2) {
-		deleteValueObject(val1);
-		deleteValueObject(val2);
-		return NULL;
-	}
 	/* Check if a floating point decimal string and cast */
-	switch (val1->type) {
+	switch (getType(val1)) {
 		case VT_NIL:
 		case VT_BOOLEAN:
 			use1 = castIntegerImplicit(val1, scope);
-			if (!use1) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
-				return NULL;
-			}
+			if (!use1) return NULL;
 			cast1 = 1;
 			break;
 		case VT_INTEGER:
@@ -2377,34 +3905,25 @@ ValueObject *interpretArithOpExprNode(OpExprNode *expr,
 		case VT_STRING: {
 			/* Perform interpolation */
 			ValueObject *interp = castStringExplicit(val1, scope);
-			if (!interp) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
-				return NULL;
-			}
+			if (!interp) return NULL;
 			if (strchr(getString(interp), '.'))
 				use1 = castFloatImplicit(interp, scope);
 			else
 				use1 = castIntegerImplicit(interp, scope);
 			deleteValueObject(interp);
-			if (!use1) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
-				return NULL;
-			}
+			if (!use1) return NULL;
 			cast1 = 1;
 			break;
 		}
 		default:
 			error(IN_INVALID_OPERAND_TYPE);
+			return NULL;
 	}
-	switch (val2->type) {
+	switch (getType(val2)) {
 		case VT_NIL:
 		case VT_BOOLEAN:
 			use2 = castIntegerImplicit(val2, scope);
 			if (!use2) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
 				if (cast1) deleteValueObject(use1);
 				return NULL;
 			}
@@ -2417,8 +3936,6 @@ ValueObject *interpretArithOpExprNode(OpExprNode *expr,
 			/* Perform interpolation */
 			ValueObject *interp = castStringExplicit(val2, scope);
 			if (!interp) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
 				if (cast1) deleteValueObject(use1);
 				return NULL;
 			}
@@ -2428,8 +3945,6 @@ ValueObject *interpretArithOpExprNode(OpExprNode *expr,
 				use2 = castIntegerImplicit(interp, scope);
 			deleteValueObject(interp);
 			if (!use2) {
-				deleteValueObject(val1);
-				deleteValueObject(val2);
 				if (cast1) deleteValueObject(use1);
 				return NULL;
 			}
@@ -2438,30 +3953,34 @@ ValueObject *interpretArithOpExprNode(OpExprNode *expr,
 		}
 		default:
 			error(IN_INVALID_OPERAND_TYPE);
+			if (cast1) deleteValueObject(use1);
+			return NULL;
 	}
 	/* Do math depending on value types */
-	ret = ArithOpJumpTable[expr->type][use1->type][use2->type](use1, use2);
+	ret = ArithOpJumpTable[type][getType(use1)][getType(use2)](use1, use2);
 	/* Clean up after floating point decimal casts */
 	if (cast1) deleteValueObject(use1);
 	if (cast2) deleteValueObject(use2);
-	deleteValueObject(val1);
-	deleteValueObject(val2);
 	return ret;
 }
 
 /**
- * Interprets a boolean operation.
+ * Gets the truth value of a boolean operation without creating a value for
+ * it.  Each operand is evaluated as a condition.
  *
- * \param [in] expr The operation to interpret.
+ * \param [in] expr The operation to evaluate.
  *
  * \param [in] scope The scope to evaluate \a expr under.
  *
- * \return A pointer to the value of the boolean operation.
+ * \param [out] truth The truth value of \a expr.
  *
- * \retval NULL An error occurred during interpretation.
+ * \retval 0 An error occurred during evaluation.
+ *
+ * \retval 1 \a truth was set successfully.
  */
-ValueObject *interpretBoolOpExprNode(OpExprNode *expr,
-                                     ScopeObject *scope)
+static int getBoolOpValue(OpExprNode *expr,
+                          ScopeObject *scope,
+                          int *truth)
 {
 	unsigned int n;
 	int acc = 0;
@@ -2470,22 +3989,9 @@ ValueObject *interpretBoolOpExprNode(OpExprNode *expr,
 	 * remaining arguments.
 	 */
 	for (n = 0; n < expr->args->num; n++) {
-		ValueObject *val = interpretExprNode(expr->args->exprs[n], scope);
-		ValueObject *use = val;
 		int temp;
-		unsigned int cast = 0;
-		if (!val) return NULL;
-		if (val->type != VT_BOOLEAN && val->type != VT_INTEGER) {
-			use = castBooleanImplicit(val, scope);
-			if (!use) {
-				deleteValueObject(val);
-				return NULL;
-			}
-			cast = 1;
-		}
-		temp = getInteger(use);
-		if (cast) deleteValueObject(use);
-		deleteValueObject(val);
+		if (!getConditionValue(expr->args->exprs[n], scope, &temp))
+			return 0;
 		if (n == 0) acc = temp;
 		else {
 			switch (expr->type) {
@@ -2500,7 +4006,7 @@ ValueObject *interpretBoolOpExprNode(OpExprNode *expr,
 					break;
 				default:
 					error(IN_INVALID_BOOLEAN_OPERATION_TYPE);
-					return NULL;
+					return 0;
 			}
 		}
 		/**
@@ -2510,6 +4016,26 @@ ValueObject *interpretBoolOpExprNode(OpExprNode *expr,
 		if (expr->type == OP_AND && acc == 0) break;
 		else if (expr->type == OP_OR && acc == 1) break;
 	}
+	*truth = acc;
+	return 1;
+}
+
+/**
+ * Interprets a boolean operation.
+ *
+ * \param [in] expr The operation to interpret.
+ *
+ * \param [in] scope The scope to evaluate \a expr under.
+ *
+ * \return A pointer to the value of the boolean operation.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretBoolOpExprNode(OpExprNode *expr,
+                                     ScopeObject *scope)
+{
+	int acc;
+	if (!getBoolOpValue(expr, scope, &acc)) return NULL;
 	return createBooleanValueObject(acc);
 }
 
@@ -2663,6 +4189,27 @@ ValueObject *opNeqBooleanBoolean(ValueObject *a,
 	return createBooleanValueObject(getInteger(a) != getInteger(b));
 }
 
+/**
+ * Checks if two string values contain the same characters.  Strings which
+ * refer to the same data, such as two uses of one interned string constant,
+ * are equal without comparing their characters.
+ *
+ * \param [in] a The first value to check.
+ *
+ * \param [in] b The second value to check.
+ *
+ * \retval 0 \a a and \a b are not equal.
+ *
+ * \retval 1 \a a and \a b are equal.
+ */
+int isStringEqual(ValueObject *a,
+                  ValueObject *b)
+{
+	if (getString(a) == getString(b)) return 1;
+	if (getStringLength(a) != getStringLength(b)) return 0;
+	return !memcmp(getString(a), getString(b), getStringLength(a));
+}
+
 /**
  * Checks if a string value is equal to another string value.
  *
@@ -2675,7 +4222,7 @@ ValueObject *opNeqBooleanBoolean(ValueObject *a,
 ValueObject *opEqStringString(ValueObject *a,
                               ValueObject *b)
 {
-	return createBooleanValueObject(strcmp(getString(a), getString(b)) == 0);
+	return createBooleanValueObject(isStringEqual(a, b));
 }
 
 /**
@@ -2690,7 +4237,7 @@ ValueObject *opEqStringString(ValueObject *a,
 ValueObject *opNeqStringString(ValueObject *a,
                                ValueObject *b)
 {
-	return createBooleanValueObject(strcmp(getString(a), getString(b)) != 0);
+	return createBooleanValueObject(!isStringEqual(a, b));
 }
 
 /**
@@ -2767,105 +4314,231 @@ ValueObject *interpretEqualityOpExprNode(OpExprNode *expr,
                                          ScopeObject *scope)
 {
 	ValueObject *val1 = interpretExprNode(expr->args->exprs[0], scope);
-	ValueObject *val2 = interpretExprNode(expr->args->exprs[1], scope);
+	ValueObject *val2 = NULL;
 	ValueObject *ret = NULL;
-	if (!val1 || !val2) {
+	if (!val1) return NULL;
+	val2 = interpretExprNode(expr->args->exprs[1], scope);
+	if (!val2) {
 		deleteValueObject(val1);
-		deleteValueObject(val2);
 		return NULL;
 	}
+	ret = interpretEqualityOpValues(expr->type, val1, val2);
+	deleteValueObject(val1);
+	deleteValueObject(val2);
+	return ret;
+}
+
+/**
+ * Performs an equality operation on values which have already been evaluated.
+ *
+ * \param [in] type The equality operation to perform.
+ *
+ * \param [in] val1 The first operand.
+ *
+ * \param [in] val2 The second operand.
+ *
+ * \note Neither \a val1 nor \a val2 are deleted by this function.
+ *
+ * \return A pointer to the resulting value of the equality operation.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretEqualityOpValues(OpType type,
+                                       ValueObject *val1,
+                                       ValueObject *val2)
+{
 	/*
 	 * Since there is no automatic casting, an equality (inequality) test
 	 * against a non-number type will always fail (succeed).
 	 */
-	if ((val1->type != val2->type)
-			&& ((val1->type != VT_INTEGER && val1->type != VT_FLOAT)
-			|| (val2->type != VT_INTEGER && val2->type != VT_FLOAT))) {
-		switch (expr->type) {
+	if ((getType(val1) != getType(val2))
+			&& ((getType(val1) != VT_INTEGER && getType(val1) != VT_FLOAT)
+			|| (getType(val2) != VT_INTEGER && getType(val2) != VT_FLOAT))) {
+		switch (type) {
 			case OP_EQ:
-				ret = createBooleanValueObject(0);
-				break;
+				return createBooleanValueObject(0);
 			case OP_NEQ:
-				ret = createBooleanValueObject(1);
-				break;
+				return createBooleanValueObject(1);
 			default:
 				error(IN_INVALID_EQUALITY_OPERATION_TYPE);
-				deleteValueObject(val1);
-				deleteValueObject(val2);
 				return NULL;
 		}
 	}
-	else
-		ret = BoolOpJumpTable[expr->type - OP_EQ][val1->type][val2->type](val1, val2);
-	deleteValueObject(val1);
-	deleteValueObject(val2);
+	return BoolOpJumpTable[type - OP_EQ][getType(val1)][getType(val2)](val1, val2);
+}
+
+/**
+ * Checks whether an assignment appends to the variable it assigns to, as in
+ * <tt>x R SMOOSH x AN ... MKAY</tt>.
+ *
+ * \param [in] stmt The assignment to check.
+ *
+ * \retval 0 \a stmt does not append to its target.
+ *
+ * \retval 1 \a stmt concatenates its target with other values.
+ */
+int isAppendAssignment(AssignmentStmtNode *stmt)
+{
+	OpExprNode *op = NULL;
+	IdentifierNode *id = NULL;
+	if (stmt->expr->type != ET_OP) return 0;
+	op = (OpExprNode *)stmt->expr->expr;
+	if (op->type != OP_CAT || op->args->exprs[0]->type != ET_IDENTIFIER)
+		return 0;
+	id = (IdentifierNode *)op->args->exprs[0]->expr;
+	return id->type == IT_DIRECT && !id->slot
+			&& stmt->target->type == IT_DIRECT && !stmt->target->slot
+			&& !strcmp(id->id, stmt->target->id);
+}
+
+/**
+ * Concatenates string values.
+ *
+ * If \a target is given and the first value is the value of \a target, being
+ * used nowhere else, the other values are appended to it in place, growing its
+ * string data geometrically so that repeatedly appending to a variable takes
+ * linear time overall.
+ *
+ * \param [in,out] vals The string values to concatenate.
+ *
+ * \param [in] num The number of values in \a vals.
+ *
+ * \param [in] scope The scope to look up \a target in.
+ *
+ * \param [in] target The optional variable being assigned the result.
+ *
+ * \note The caller retains its references to \a vals.
+ *
+ * \return A string value holding the concatenation of \a vals.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+ValueObject *concatStringValues(ValueObject **vals,
+                                unsigned int num,
+                                ScopeObject *scope,
+                                IdentifierNode *target)
+{
+	ValueObject *acc = vals[0];
+	ValueObject *ret = NULL;
+	size_t size = 0;
+	size_t len = 0;
+	char *data = NULL;
+	unsigned int n;
+	for (n = 0; n < num; n++)
+		size += getStringLength(vals[n]);
+	/*
+	 * The first value may be modified when it is referenced only by the
+	 * caller and the variable which is about to be replaced by the result.
+	 */
+	if (target && !acc->borrowed && acc->semaphore == 2
+			&& getScopeValue(scope, scope, target) == acc) {
+		if (size + 1 > acc->capacity) {
+			size_t capacity = acc->capacity * 2;
+			void *mem = NULL;
+			if (capacity < size + 1) capacity = size + 1;
+			mem = realloc(getString(acc), sizeof(char) * capacity);
+			if (!mem) {
+				perror("realloc");
+				return NULL;
+			}
+			STAT_ALLOCATE(capacity - acc->capacity);
+			acc->data.s = mem;
+			acc->capacity = capacity;
+		}
+		/* Casts of the old contents no longer apply */
+		evictCastCache(acc);
+		data = getString(acc);
+		len = getStringLength(acc);
+		for (n = 1; n < num; n++) {
+			memcpy(data + len, getString(vals[n]), getStringLength(vals[n]));
+			len += getStringLength(vals[n]);
+			acc->plain = acc->plain && vals[n]->plain;
+		}
+		data[len] = '\0';
+		acc->length = len;
+		return copyValueObject(acc);
+	}
+	data = malloc(sizeof(char) * (size + 1));
+	if (!data) {
+		perror("malloc");
+		return NULL;
+	}
+	for (n = 0; n < num; n++) {
+		memcpy(data + len, getString(vals[n]), getStringLength(vals[n]));
+		len += getStringLength(vals[n]);
+	}
+	data[len] = '\0';
+	ret = createStringValueObject(data);
+	if (!ret) free(data);
 	return ret;
 }
 
 /**
- * Interprets a concatenation operation.
+ * Interprets a concatenation operation, possibly appending to the variable
+ * the result is assigned to.
  *
  * \param [in] expr The operation to interpret.
  *
  * \param [in] scope The scope to evaluate \a expr under.
  *
+ * \param [in] target The optional variable being assigned the result.
+ *
  * \return A pointer to the resulting value of the concatenation operation.
  *
  * \retval NULL An error occurred during interpretation.
  */
-ValueObject *interpretConcatOpExprNode(OpExprNode *expr,
-                                       ScopeObject *scope)
+static ValueObject *interpretConcatOpExprNodeTarget(OpExprNode *expr,
+                                                    ScopeObject *scope,
+                                                    IdentifierNode *target)
 {
+	ValueObject *local[8];
+	ValueObject **vals = local;
+	ValueObject *ret = NULL;
+	unsigned int num = expr->args->num;
 	unsigned int n;
-	/* Start out with the first string to concatenate. */
-	ValueObject *val = interpretExprNode(expr->args->exprs[0], scope);
-	ValueObject *use = castStringImplicit(val, scope);
-	char *acc = NULL;
-	void *mem = NULL;
-	if (!val || !use) {
-		deleteValueObject(val);
-		deleteValueObject(use);
-		return NULL;
-	}
-	/* Start out an accumulator with the first string. */
-	mem = realloc(acc, sizeof(char) * (strlen(getString(use)) + 1));
-	if (!mem) {
-		perror("realloc");
-		deleteValueObject(val);
-		deleteValueObject(use);
-		free(acc);
-		return NULL;
-	}
-	acc = mem;
-	acc[0] = '\0';
-	strcat(acc, getString(use));
-	deleteValueObject(val);
-	deleteValueObject(use);
-	for (n = 1; n < expr->args->num; n++) {
-		/* Grab the next string to concatenate. */
-		val = interpretExprNode(expr->args->exprs[n], scope);
-		use = castStringImplicit(val, scope);
-		if (!val || !use) {
-			deleteValueObject(val);
-			deleteValueObject(use);
-			free(acc);
-			return NULL;
-		}
-		/* Add the next string to the accumulator. */
-		mem = realloc(acc, sizeof(char) * (strlen(acc) + strlen(getString(use)) + 1));
-		if (!mem) {
-			perror("realloc");
-			deleteValueObject(val);
-			deleteValueObject(use);
-			free(acc);
+	if (num > sizeof(local) / sizeof(ValueObject *)) {
+		vals = malloc(sizeof(ValueObject *) * num);
+		if (!vals) {
+			perror("malloc");
 			return NULL;
 		}
-		acc = mem;
-		strcat(acc, getString(use));
+	}
+	for (n = 0; n < num; n++) vals[n] = NULL;
+	/* Each string is cast before the next is evaluated */
+	for (n = 0; n < num; n++) {
+		ValueObject *val = interpretExprNode(expr->args->exprs[n], scope);
+		if (!val) goto interpretConcatOpExprNodeTargetAbort;
+		vals[n] = castStringImplicit(val, scope);
 		deleteValueObject(val);
-		deleteValueObject(use);
+		if (!vals[n]) goto interpretConcatOpExprNodeTargetAbort;
 	}
-	return createStringValueObject(acc);
+	ret = concatStringValues(vals, num, scope, target);
+
+interpretConcatOpExprNodeTargetAbort: /* Exception handling */
+
+	/* Clean up the cast strings */
+	for (n = 0; n < num; n++)
+		if (vals[n]) deleteValueObject(vals[n]);
+	if (vals != local) free(vals);
+
+	return ret;
+}
+
+/**
+ * Interprets a concatenation operation.
+ *
+ * \param [in] expr The operation to interpret.
+ *
+ * \param [in] scope The scope to evaluate \a expr under.
+ *
+ * \return A pointer to the resulting value of the concatenation operation.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretConcatOpExprNode(OpExprNode *expr,
+                                       ScopeObject *scope)
+{
+	return interpretConcatOpExprNodeTarget(expr, scope, NULL);
 }
 
 /*
@@ -2906,17 +4579,137 @@ ValueObject *interpretOpExprNode(ExprNode *node,
 	return OpExprJumpTable[expr->type](expr, scope);
 }
 
+/**
+ * Checks whether a variable holds a value which is cast the same way wherever
+ * it is cast.  Strings containing colons are interpolated each time they are
+ * cast, so their casts may depend on any other variable.
+ *
+ * \param [in] scope The scope to look up \a id in.
+ *
+ * \param [in] id The direct identifier of the variable to check.
+ *
+ * \note Unlike getScopeValue(), no error is reported if the variable does not
+ * exist.
+ *
+ * \retval 0 The variable does not exist or holds a string containing a colon.
+ *
+ * \retval 1 The variable holds a value which is cast the same way wherever it
+ * is cast.
+ */
+static int isStableVariable(ScopeObject *scope,
+                            IdentifierNode *id)
+{
+	ValueObject **slot = getResolvedScopeSlot(scope, id);
+	ValueObject *val = NULL;
+	ScopeKey key;
+	if (!slot) {
+		if (!resolveScopeKey(id, scope, &key)) return 0;
+		do {
+			if ((slot = findScopeKey(scope, &key))) break;
+		} while ((scope = scope->parent));
+		releaseScopeKey(&key);
+		if (!slot) return 0;
+	}
+	val = *slot;
+	return getType(val) != VT_STRING
+			|| !memchr(getString(val), ':', getStringLength(val));
+}
+
+/**
+ * Checks whether every variable an invariant expression refers to holds a
+ * value which is cast the same way wherever it is cast, so that the value of
+ * the expression depends only on those variables.
+ *
+ * \param [in] node The invariant expression to check.
+ *
+ * \param [in] scope The scope \a node was evaluated under.
+ *
+ * \retval 0 The value of \a node may depend on other variables.
+ *
+ * \retval 1 The value of \a node depends only on the variables it refers to.
+ */
+static int isStableExprNode(ExprNode *node,
+                            ScopeObject *scope)
+{
+	ConstantNode *c = NULL;
+	OpExprNode *op = NULL;
+	unsigned int n;
+	switch (node->type) {
+		case ET_CAST:
+			return isStableExprNode(((CastExprNode *)node->expr)->target, scope);
+		case ET_CONSTANT:
+			c = (ConstantNode *)node->expr;
+			if (c->type != CT_STRING || !c->tmpl) return 1;
+			for (n = 0; n < c->tmpl->num; n++) {
+				TemplateSegment *seg = &c->tmpl->segs[n];
+				if (seg->type == SG_VARIABLE && !isStableVariable(scope, seg->id))
+					return 0;
+			}
+			return 1;
+		case ET_IDENTIFIER:
+			return isStableVariable(scope, node->expr);
+		case ET_OP:
+			op = (OpExprNode *)node->expr;
+			for (n = 0; n < op->args->num; n++) {
+				if (!isStableExprNode(op->args->exprs[n], scope)) return 0;
+			}
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Interprets a loop invariant.  The invariant is evaluated the first time it
+ * is needed during each execution of its loop, and its value is kept in a
+ * hidden variable of the loop for the rest of the execution, unless it depends
+ * on strings which are interpolated each time they are cast.
+ *
+ * \param [in] node The loop invariant to interpret.
+ *
+ * \param [in] scope The scope to evaluate \a node under.
+ *
+ * \pre \a node contains an expression created by createInvariantExprNode().
+ *
+ * \return A pointer to the value of the invariant.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ValueObject *interpretInvariantExprNode(ExprNode *node,
+                                        ScopeObject *scope)
+{
+	InvariantExprNode *expr = (InvariantExprNode *)node->expr;
+	ValueObject *val = getScopeValue(scope, scope, expr->id);
+	ValueObject *copy = NULL;
+	if (!val) return NULL;
+	/* The hidden variable holds nil until the invariant is evaluated */
+	if (getType(val) != VT_NIL) {
+		STAT_COUNT(invariants);
+		return copyValueObject(val);
+	}
+	val = interpretExprNode(expr->expr, scope);
+	if (!val || !isStableExprNode(expr->expr, scope)) return val;
+	copy = copyValueObject(val);
+	if (!updateScopeValue(scope, scope, expr->id, copy)) {
+		deleteValueObject(copy);
+		deleteValueObject(val);
+		return NULL;
+	}
+	return val;
+}
+
 /*
  * A jump table for expressions.  The index of a function in the table is given
  * by its its index in the enumerated ExprType type.
  */
-static ValueObject *(*ExprJumpTable[6])(ExprNode *, ScopeObject *) = {
+static ValueObject *(*ExprJumpTable[7])(ExprNode *, ScopeObject *) = {
 	interpretCastExprNode,
 	interpretConstantExprNode,
 	interpretIdentifierExprNode,
 	interpretFuncCallExprNode,
 	interpretOpExprNode,
-	interpretImpVarExprNode };
+	interpretImpVarExprNode,
+	interpretInvariantExprNode };
 
 /**
  * Interprets an expression.
@@ -2935,6 +4728,110 @@ ValueObject *interpretExprNode(ExprNode *node,
 	return ExprJumpTable[node->type](node, scope);
 }
 
+/**
+ * Gets the truth value of an equality operation.  Variables are compared in
+ * place and, since the result of a comparison is an immediate value, nothing
+ * is allocated for comparisons of variables with each other or with numeric
+ * constants.
+ *
+ * \param [in] expr The operation to evaluate.
+ *
+ * \param [in] scope The scope to evaluate \a expr under.
+ *
+ * \param [out] truth The truth value of \a expr.
+ *
+ * \retval 0 An error occurred during evaluation.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+static int getEqualityOpValue(OpExprNode *expr,
+                              ScopeObject *scope,
+                              int *truth)
+{
+	ExprNode *arg2 = expr->args->exprs[1];
+	ValueObject *val1 = NULL;
+	ValueObject *val2 = NULL;
+	ValueObject *ret = NULL;
+	int own1;
+	int own2;
+	int status = 1;
+	/* The first operand stays valid if the second has no side effects */
+	val1 = getOperandValue(expr->args->exprs[0],
+			scope,
+			arg2->type == ET_CONSTANT || isDirectVariable(arg2),
+			&own1);
+	if (!val1) return 0;
+	val2 = getOperandValue(arg2, scope, 1, &own2);
+	if (!val2) {
+		if (own1) deleteValueObject(val1);
+		return 0;
+	}
+	/* Integers and booleans of the same type are compared directly */
+	if (getType(val1) == getType(val2)
+			&& (getType(val1) == VT_INTEGER || getType(val1) == VT_BOOLEAN)) {
+		*truth = (getInteger(val1) == getInteger(val2)) == (expr->type == OP_EQ);
+	}
+	else {
+		ret = interpretEqualityOpValues(expr->type, val1, val2);
+		if (ret) *truth = (int)getInteger(ret);
+		else status = 0;
+		deleteValueObject(ret);
+	}
+	if (own1) deleteValueObject(val1);
+	if (own2) deleteValueObject(val2);
+	return status;
+}
+
+/**
+ * Evaluates an expression as a condition, as used by if/then/else statements
+ * and loop guards.  Boolean operations, negations, and equality operations are
+ * evaluated directly to a truth value without creating values for their
+ * results; any other expression is interpreted and its value is used the way
+ * getBooleanValue() does.
+ *
+ * \param [in] node The expression to evaluate.
+ *
+ * \param [in] scope The scope to evaluate \a node under.
+ *
+ * \param [out] truth The truth value of \a node, which is nonzero if it holds.
+ *
+ * \retval 0 An error occurred during evaluation.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+int getConditionValue(ExprNode *node,
+                      ScopeObject *scope,
+                      int *truth)
+{
+	ValueObject *val = NULL;
+	int owned;
+	int status;
+	if (node->type == ET_OP) {
+		OpExprNode *expr = (OpExprNode *)node->expr;
+		switch (expr->type) {
+			case OP_AND:
+			case OP_OR:
+			case OP_XOR:
+				return getBoolOpValue(expr, scope, truth);
+			case OP_NOT:
+				if (!getConditionValue(expr->args->exprs[0], scope, truth))
+					return 0;
+				*truth = !*truth;
+				return 1;
+			case OP_EQ:
+			case OP_NEQ:
+				return getEqualityOpValue(expr, scope, truth);
+			default:
+				break;
+		}
+	}
+	val = getOperandValue(node, scope, 1, &owned);
+	if (!val) return 0;
+	status = getBooleanValue(val, scope, truth);
+	if (owned) deleteValueObject(val);
+	return status;
+}
+
 /**
  * Interprets a cast statement.
  *
@@ -2952,49 +4849,115 @@ ReturnObject *interpretCastStmtNode(StmtNode *node,
                                     ScopeObject *scope)
 {
 	CastStmtNode *stmt = (CastStmtNode *)node->stmt;
-	ValueObject *val = getScopeValue(scope, scope, stmt->target);
+	IdentifierNode *target = NULL;
+	ValueObject *val = NULL;
 	ValueObject *cast = NULL;
-	if (!val) {
-		IdentifierNode *id = (IdentifierNode *)(stmt->target);
-		char *name = resolveIdentifierName(id, scope);
-		if (name) {
-			error(IN_VARIABLE_DOES_NOT_EXIST, id->fname, id->line, name);
-			free(name);
-		}
-		return NULL;
-	}
+	/* Evaluate the name being cast only once */
+	target = evaluateIdentifierNode(stmt->target, scope);
+	if (!target) return NULL;
+	val = getScopeValue(scope, scope, target);
+	if (!val) goto interpretCastStmtNodeAbort;
 	switch(stmt->newtype->type) {
 		case CT_NIL:
-			if (!(cast = createNilValueObject())) return NULL;
+			cast = createNilValueObject();
 			break;
 		case CT_BOOLEAN:
-			if (!(cast = castBooleanExplicit(val, scope))) return NULL;
+			cast = castBooleanExplicit(val, scope);
 			break;
 		case CT_INTEGER:
-			if (!(cast = castIntegerExplicit(val, scope))) return NULL;
+			cast = castIntegerExplicit(val, scope);
 			break;
 		case CT_FLOAT:
-			if (!(cast = castFloatExplicit(val, scope))) return NULL;
+			cast = castFloatExplicit(val, scope);
 			break;
 		case CT_STRING:
-			if (!(cast = castStringExplicit(val, scope))) return NULL;
+			cast = castStringExplicit(val, scope);
 			break;
 		case CT_ARRAY: {
-			IdentifierNode *id = (IdentifierNode *)(stmt->target);
-			char *name = resolveIdentifierName(id, scope);
+			char *name = resolveIdentifierName(target, scope);
 			if (name) {
-				error(IN_CANNOT_CAST_VALUE_TO_ARRAY, id->fname, id->line, name);
+				error(IN_CANNOT_CAST_VALUE_TO_ARRAY, target->fname, target->line, name);
 				free(name);
 			}
-			return NULL;
 			break;
 		}
 	}
-	if (!updateScopeValue(scope, scope, stmt->target, cast)) {
+	if (!cast) goto interpretCastStmtNodeAbort;
+	if (!updateScopeValue(scope, scope, target, cast)) {
 		deleteValueObject(cast);
-		return NULL;
+		goto interpretCastStmtNodeAbort;
 	}
+	deleteEvaluatedIdentifierNode(target, stmt->target);
 	return createReturnObject(RT_DEFAULT, NULL);
+
+interpretCastStmtNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	deleteEvaluatedIdentifierNode(target, stmt->target);
+
+	return NULL;
+}
+
+/**
+ * Writes a value to a file the way a print statement does, formatting
+ * integers, decimals, and strings without escape sequences directly instead of
+ * casting them to new string values first.
+ *
+ * \param [in] val The value to write.
+ *
+ * \param [in] scope The scope to perform any string interpolation under.
+ *
+ * \param [in] file The file to write \a val to.
+ *
+ * \retval 0 An error occurred while casting \a val.
+ *
+ * \retval 1 \a val was written to \a file.
+ */
+int printValueObject(ValueObject *val,
+                     ScopeObject *scope,
+                     FILE *file)
+{
+	switch (getType(val)) {
+		case VT_INTEGER: {
+			/* One character per integer bit plus a sign */
+			char buf[sizeof(long long) * 8 + 1];
+			char *cur = buf + sizeof(buf);
+			long long i = getInteger(val);
+			unsigned long long u = i < 0 ? 0 - (unsigned long long)i : (unsigned long long)i;
+			do {
+				*--cur = (char)('0' + u % 10);
+				u /= 10;
+			} while (u);
+			if (i < 0) *--cur = '-';
+			writeFile(file, cur, (size_t)(buf + sizeof(buf) - cur));
+			return 1;
+		}
+		case VT_FLOAT: {
+			/* Enough characters for the largest float and its digits */
+			char buf[FLT_MAX_10_EXP + 16];
+			unsigned int precision = 2;
+			char *end = NULL;
+			sprintf(buf, "%f", getFloat(val));
+			/* Truncate to a certain number of decimal places */
+			if ((end = strchr(buf, '.'))) end += precision + 1;
+			else end = buf + strlen(buf);
+			writeFile(file, buf, (size_t)(end - buf));
+			return 1;
+		}
+		case VT_STRING:
+			if (val->plain) {
+				writeFile(file, getString(val), getStringLength(val));
+				return 1;
+			}
+			/* Fall through */
+		default: {
+			ValueObject *use = castStringImplicit(val, scope);
+			if (!use) return 0;
+			writeFile(file, getString(use), getStringLength(use));
+			deleteValueObject(use);
+			return 1;
+		}
+	}
 }
 
 /**
@@ -3016,19 +4979,15 @@ ReturnObject *interpretPrintStmtNode(StmtNode *node,
 	PrintStmtNode *stmt = (PrintStmtNode *)node->stmt;
 	unsigned int n;
 	for (n = 0; n < stmt->args->num; n++) {
-		ValueObject *val = interpretExprNode(stmt->args->exprs[n], scope);
-		ValueObject *use = castStringImplicit(val, scope);
-		if (!val || !use) {
-			deleteValueObject(val);
-			deleteValueObject(use);
-			return NULL;
-		}
-		fprintf(stmt->file, "%s", getString(use));
-		deleteValueObject(val);
-		deleteValueObject(use);
+		int owned;
+		/* Each value is printed before the next one is evaluated */
+		ValueObject *val = getOperandValue(stmt->args->exprs[n], scope, 1, &owned);
+		int status = val && printValueObject(val, scope, stmt->file);
+		if (owned) deleteValueObject(val);
+		if (!status) return NULL;
 	}
 	if (!stmt->nonl)
-		putc('\n', stmt->file);
+		writeFile(stmt->file, "\n", 1);
 	return createReturnObject(RT_DEFAULT, NULL);
 }
 
@@ -3048,38 +5007,13 @@ ReturnObject *interpretPrintStmtNode(StmtNode *node,
 ReturnObject *interpretInputStmtNode(StmtNode *node,
                                      ScopeObject *scope)
 {
-	unsigned int size = 16;
-	unsigned int cur = 0;
-	char *temp = malloc(sizeof(char) * size);
-	int c;
-	void *mem = NULL;
 	InputStmtNode *stmt = (InputStmtNode *)node->stmt;
 	ValueObject *val = NULL;
-	while ((c = getchar()) && !feof(stdin)) {
-		/**
-		 * \note The specification is unclear as to the exact semantics
-		 * of input.  Here, we read up until the first newline or EOF
-		 * but do not store it.
-		 */
-		if (c == EOF || c == (int)'\r' || c == (int)'\n') break;
-		temp[cur] = (char)c;
-		cur++;
-		if (cur > size - 1) {
-			/* Increasing buffer size. */
-			size *= 2;
-			mem = realloc(temp, sizeof(char) * size);
-			if (!mem) {
-				perror("realloc");
-				free(temp);
-				return NULL;
-			}
-			temp = mem;
-		}
-	}
-	temp[cur] = '\0';
-	val = createStringValueObject(temp);
+	char *line = readInputLine();
+	if (!line) return NULL;
+	val = createStringValueObject(line);
 	if (!val) {
-		free(temp);
+		free(line);
 		return NULL;
 	}
 	if (!updateScopeValue(scope, scope, stmt->target, val)) {
@@ -3106,10 +5040,14 @@ ReturnObject *interpretAssignmentStmtNode(StmtNode *node,
                                           ScopeObject *scope)
 {
 	AssignmentStmtNode *stmt = (AssignmentStmtNode *)node->stmt;
-	ValueObject *val = interpretExprNode(stmt->expr, scope);
+	ValueObject *val = NULL;
+	if (isAppendAssignment(stmt))
+		val = interpretConcatOpExprNodeTarget(stmt->expr->expr, scope, stmt->target);
+	else
+		val = interpretExprNode(stmt->expr, scope);
 	if (!val) return NULL;
 	/* interpolate assigned strings */
-	if (val->type == VT_STRING) {
+	if (getType(val) == VT_STRING) {
 		ValueObject *use = castStringImplicit(val, scope);
 		deleteValueObject(val);
 		if (!use) return NULL;
@@ -3139,19 +5077,23 @@ ReturnObject *interpretDeclarationStmtNode(StmtNode *node,
                                            ScopeObject *scope)
 {
 	DeclarationStmtNode *stmt = (DeclarationStmtNode *)node->stmt;
+	IdentifierNode *target = NULL;
 	ValueObject *init = NULL;
 	ScopeObject *dest = NULL;
 	dest = getScopeObject(scope, scope, stmt->scope);
 	if (!dest) return NULL;
-	if (getScopeValueLocal(scope, dest, stmt->target)) {
-		IdentifierNode *id = (IdentifierNode *)(stmt->target);
-		char *name = resolveIdentifierName(id, scope);
+	/* Evaluate the name being declared only once */
+	target = evaluateIdentifierNode(stmt->target, scope);
+	if (!target) return NULL;
+	if (getScopeValueLocal(scope, dest, target)) {
+		char *name = resolveIdentifierName(target, scope);
 		if (name) {
-			error(IN_REDEFINITION_OF_VARIABLE, id->fname, id->line, name);
+			error(IN_REDEFINITION_OF_VARIABLE, target->fname, target->line, name);
 			free(name);
 		}
-		return NULL;
+		goto interpretDeclarationStmtNodeAbort;
 	}
+	if (getErrorCode()) goto interpretDeclarationStmtNodeAbort;
 	if (stmt->expr)
 		init = interpretExprNode(stmt->expr, scope);
 	else if (stmt->type) {
@@ -3176,26 +5118,31 @@ ReturnObject *interpretDeclarationStmtNode(StmtNode *node,
 				break;
 			default:
 				error(IN_INVALID_DECLARATION_TYPE);
-				return NULL;
+				goto interpretDeclarationStmtNodeAbort;
 		}
 	}
 	else if (stmt->parent) {
 		ScopeObject *parent = getScopeObject(scope, scope, stmt->parent);
-		if (!parent) return NULL;
+		if (!parent) goto interpretDeclarationStmtNodeAbort;
 		init = createArrayValueObject(parent);
 	}
 	else
 		init = createNilValueObject();
-	if (!init) return NULL;
-	if (!createScopeValue(scope, dest, stmt->target)) {
-		deleteValueObject(init);
-		return NULL;
-	}
-	if (!updateScopeValue(scope, dest, stmt->target, init)) {
-		deleteValueObject(init);
-		return NULL;
-	}
+	if (!init) goto interpretDeclarationStmtNodeAbort;
+	if (!createScopeValue(scope, dest, target))
+		goto interpretDeclarationStmtNodeAbort;
+	if (!updateScopeValue(scope, dest, target, init))
+		goto interpretDeclarationStmtNodeAbort;
+	deleteEvaluatedIdentifierNode(target, stmt->target);
 	return createReturnObject(RT_DEFAULT, NULL);
+
+interpretDeclarationStmtNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	if (init) deleteValueObject(init);
+	deleteEvaluatedIdentifierNode(target, stmt->target);
+
+	return NULL;
 }
 
 /**
@@ -3215,39 +5162,18 @@ ReturnObject *interpretIfThenElseStmtNode(StmtNode *node,
                                           ScopeObject *scope)
 {
 	IfThenElseStmtNode *stmt = (IfThenElseStmtNode *)node->stmt;
-	ValueObject *use1 = scope->impvar;
 	int use1val;
-	unsigned int cast1 = 0;
 	BlockNode *path = NULL;
-	if (scope->impvar->type != VT_BOOLEAN && scope->impvar->type != VT_INTEGER) {
-		use1 = castBooleanImplicit(scope->impvar, scope);
-		if (!use1) return NULL;
-		cast1 = 1;
-	}
-	use1val = getInteger(use1);
-	if (cast1) deleteValueObject(use1);
+	if (!getBooleanValue(scope->impvar, scope, &use1val)) return NULL;
 	/* Determine which block of code to execute */
 	if (use1val)
 		path = stmt->yes;
 	else {
 		unsigned int n;
 		for (n = 0; n < stmt->guards->num; n++) {
-			ValueObject *val = interpretExprNode(stmt->guards->exprs[n], scope);
-			ValueObject *use2 = val;
 			int use2val;
-			unsigned int cast2 = 0;
-			if (!val) return NULL;
-			if (val->type != VT_BOOLEAN && val->type != VT_INTEGER) {
-				use2 = castBooleanImplicit(val, scope);
-				if (!use2) {
-					deleteValueObject(val);
-					return NULL;
-				}
-				cast2 = 1;
-			}
-			use2val = getInteger(use2);
-			deleteValueObject(val);
-			if (cast2) deleteValueObject(use2);
+			if (!getConditionValue(stmt->guards->exprs[n], scope, &use2val))
+				return NULL;
 			if (use2val) {
 				path = stmt->blocks->blocks[n];
 				break;
@@ -3272,68 +5198,143 @@ ReturnObject *interpretIfThenElseStmtNode(StmtNode *node,
 }
 
 /**
- * Interprets a switch statement.
- *
- * \param [in] node The statement to interpret.
+ * Finds the guard of a switch statement which matches the \ref impvar
+ * "implicit variable".  Guards stored in the jump table of the statement are
+ * found by hashing the implicit variable; otherwise, each guard is tested in
+ * order.
  *
- * \param [in] scope The scope to evaluate \a node under.
+ * \param [in] stmt The switch statement.
  *
- * \pre \a node contains a statement created by createSwitchStmtNode().
+ * \param [in] scope The scope \a stmt is executed under.
  *
- * \note The specification is unclear as to whether guards are implicitly cast
- * to the type of the implicit variable.  This only matters in the case that
- * mixed guard types are present, and in this code, the action that is performed
- * is the same as the comparison operator, that is, in order for a guard to
- * match, both its type and value must match the implicit variable.
+ * \param [out] index The position of the first matching guard, or the number
+ * of guards if none match.
  *
- * \return A pointer to a default return value.
+ * \retval 0 An error occurred while testing a guard.
  *
- * \retval NULL An error occurred during interpretation.
+ * \retval 1 \a index was set successfully.
  */
-ReturnObject *interpretSwitchStmtNode(StmtNode *node,
-                                      ScopeObject *scope)
+int findSwitchCase(SwitchStmtNode *stmt,
+                   ScopeObject *scope,
+                   unsigned int *index)
 {
-	SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+	ValueObject *it = scope->impvar;
 	unsigned int n;
+	*index = stmt->guards->num;
+	if (stmt->table) {
+		ConstantType type;
+		unsigned int h;
+		switch (getType(it)) {
+			case VT_BOOLEAN:
+				type = CT_BOOLEAN;
+				h = hashSwitchKey(type, getInteger(it), NULL, 0);
+				break;
+			case VT_INTEGER:
+				type = CT_INTEGER;
+				h = hashSwitchKey(type, getInteger(it), NULL, 0);
+				break;
+			case VT_STRING:
+				/**
+				 * \note Strings with interpolation
+				 * should have already been checked for.
+				 */
+				type = CT_STRING;
+				h = hashSwitchKey(type, 0, getString(it), getStringLength(it));
+				break;
+			case VT_FLOAT:
+				/* Decimals match within an epsilon, so they are not hashed */
+				for (n = 0; n < stmt->guards->num && stmt->floats; n++) {
+					ConstantNode *c = stmt->guards->exprs[n]->expr;
+					if (c->type == CT_FLOAT
+							&& fabs(getFloat(it) - c->data.f) < FLT_EPSILON) {
+						*index = n;
+						break;
+					}
+				}
+				return 1;
+			default:
+				return 1;
+		}
+		for (h &= stmt->size - 1; stmt->table[h].guard; h = (h + 1) & (stmt->size - 1)) {
+			ConstantNode *c = stmt->table[h].guard;
+			int match;
+			if (c->type != type) continue;
+			if (type == CT_STRING)
+				match = (c->data.s == getString(it) || !strcmp(c->data.s, getString(it)));
+			else
+				match = (c->data.i == getInteger(it));
+			if (match) {
+				*index = stmt->table[h].index;
+				break;
+			}
+		}
+		return 1;
+	}
 	/*
 	 * Loop over each of the guards, checking if any match the implicit
 	 * variable.
 	 */
 	for (n = 0; n < stmt->guards->num; n++) {
-		ValueObject *use1 = scope->impvar;
 		ValueObject *use2 = interpretExprNode(stmt->guards->exprs[n], scope);
 		unsigned int done = 0;
-		if (!use2) return NULL;
-		if (use1->type == use2->type) {
-			switch (use1->type) {
+		if (!use2) return 0;
+		if (getType(it) == getType(use2)) {
+			switch (getType(it)) {
 				case VT_NIL:
 					break;
 				case VT_BOOLEAN:
 				case VT_INTEGER:
-					if (getInteger(use1) == getInteger(use2))
+					if (getInteger(it) == getInteger(use2))
 						done = 1;
 					break;
 				case VT_FLOAT:
-					if (fabs(getFloat(use1) - getFloat(use2)) < FLT_EPSILON)
+					if (fabs(getFloat(it) - getFloat(use2)) < FLT_EPSILON)
 						done = 1;
 					break;
 				case VT_STRING:
-					/**
-					 * \note Strings with interpolation
-					 * should have already been checked for.
-					 */
-					if (!strcmp(getString(use1), getString(use2)))
+					if (isStringEqual(it, use2))
 						done = 1;
 					break;
 				default:
 					error(IN_INVALID_TYPE);
 					deleteValueObject(use2);
-					return NULL;
+					return 0;
 			}
 		}
 		deleteValueObject(use2);
-		if (done) break;
+		if (done) {
+			*index = n;
+			break;
+		}
 	}
+	return 1;
+}
+
+/**
+ * Interprets a switch statement.
+ *
+ * \param [in] node The statement to interpret.
+ *
+ * \param [in] scope The scope to evaluate \a node under.
+ *
+ * \pre \a node contains a statement created by createSwitchStmtNode().
+ *
+ * \note The specification is unclear as to whether guards are implicitly cast
+ * to the type of the implicit variable.  This only matters in the case that
+ * mixed guard types are present, and in this code, the action that is performed
+ * is the same as the comparison operator, that is, in order for a guard to
+ * match, both its type and value must match the implicit variable.
+ *
+ * \return A pointer to a default return value.
+ *
+ * \retval NULL An error occurred during interpretation.
+ */
+ReturnObject *interpretSwitchStmtNode(StmtNode *node,
+                                      ScopeObject *scope)
+{
+	SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+	unsigned int n;
+	if (!findSwitchCase(stmt, scope, &n)) return NULL;
 	/* If none of the guards match and a default block exists */
 	if (n == stmt->blocks->num && stmt->def) {
 		ReturnObject *r = interpretBlockNode(stmt->def, scope);
@@ -3410,13 +5411,151 @@ ReturnObject *interpretReturnStmtNode(StmtNode *node,
 {
 	/* Evaluate and return the expression. */
 	ReturnStmtNode *stmt = (ReturnStmtNode *)node->stmt;
-	ValueObject *value = interpretExprNode(stmt->value, scope);
+	ValueObject *value = NULL;
+	if (stmt->func) {
+		/* Hand a call in tail position back to the calling function */
+		FuncDefStmtNode *func = NULL;
+		ScopeObject *outer = NULL;
+		ReturnObject *ret = NULL;
+		outer = createFuncCallScope(stmt->value->expr, scope, &func);
+		if (!outer) return NULL;
+		if (!canReuseFuncScope(stmt->func, func, outer)) {
+			value = executeFunction(func, outer);
+			if (!value) return NULL;
+			return createReturnObject(RT_RETURN, value);
+		}
+		ret = createReturnObject(RT_RETURN, NULL);
+		if (!ret) {
+			deleteScopeObject(outer);
+			return NULL;
+		}
+		ret->func = func;
+		ret->scope = outer;
+		return ret;
+	}
+	value = interpretExprNode(stmt->value, scope);
 	if (!value) return NULL;
 	return createReturnObject(RT_RETURN, value);
 }
 
 /**
- * Interprets a loop statement.
+ * Compares the variable of a counting loop to its limit on integers directly.
+ *
+ * \param [in] stmt The loop statement.
+ *
+ * \param [in] scope The scope of the loop, holding its variable.
+ *
+ * \param [out] truth Whether the loop continues.
+ *
+ * \retval -1 An error occurred while evaluating the limit.
+ *
+ * \retval 0 The variable or the limit is not an integer, so the guard must be
+ * evaluated in the general way.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+static int compareLoopCounter(LoopStmtNode *stmt,
+                              ScopeObject *scope,
+                              int *truth)
+{
+	/* The loop variable is the first value in the loop scope */
+	ValueObject *var = scope->values[0];
+	long long a, b;
+	if (getType(var) != VT_INTEGER) return 0;
+	a = getInteger(var);
+	if (stmt->limit->type == ET_CONSTANT)
+		b = ((ConstantNode *)stmt->limit->expr)->data.i;
+	else {
+		ValueObject *limit = interpretExprNode(stmt->limit, scope);
+		if (!limit) return -1;
+		if (getType(limit) != VT_INTEGER) {
+			deleteValueObject(limit);
+			return 0;
+		}
+		b = getInteger(limit);
+		deleteValueObject(limit);
+	}
+	switch (stmt->cmp) {
+		case LC_EQ: *truth = (a == b); break;
+		case LC_NEQ: *truth = (a != b); break;
+		case LC_LT: *truth = (a < b); break;
+		case LC_LTE: *truth = (a <= b); break;
+		case LC_GT: *truth = (a > b); break;
+		case LC_GTE: *truth = (a >= b); break;
+		default: return 0;
+	}
+	return 1;
+}
+
+/**
+ * Evaluates the guard of a loop.  The guards of counting loops which compare
+ * integers are evaluated without creating any values; any other guard is
+ * evaluated as a condition with getConditionValue().
+ *
+ * \param [in] stmt The loop statement.
+ *
+ * \param [in] scope The scope of the loop, holding its variable.
+ *
+ * \param [out] truth Whether the loop continues.
+ *
+ * \pre \a stmt has a guard.
+ *
+ * \retval 0 An error occurred while evaluating the guard.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+int getLoopGuardValue(LoopStmtNode *stmt,
+                      ScopeObject *scope,
+                      int *truth)
+{
+	if (stmt->cmp != LC_NONE) {
+		int status = compareLoopCounter(stmt, scope, truth);
+		if (status) return status > 0;
+	}
+	return getConditionValue(stmt->guard, scope, truth);
+}
+
+/**
+ * Updates the variable of a loop.  The variable of a counting loop which still
+ * holds an integer is stepped in place; any other variable is updated by
+ * evaluating the update expression.
+ *
+ * \param [in] stmt The loop statement.
+ *
+ * \param [in,out] scope The scope of the loop, holding its variable.
+ *
+ * \pre \a stmt has an update.
+ *
+ * \retval 0 An error occurred while updating the variable.
+ *
+ * \retval 1 The variable was updated.
+ */
+int stepLoopVariable(LoopStmtNode *stmt,
+                     ScopeObject *scope)
+{
+	ValueObject *updated = NULL;
+	if (stmt->step && getType(scope->values[0]) == VT_INTEGER) {
+		/* The loop variable is the first value in the loop scope */
+		updated = createIntegerValueObject(getInteger(scope->values[0]) + stmt->step);
+		if (!updated) return 0;
+		deleteValueObject(scope->values[0]);
+		scope->values[0] = updated;
+		return 1;
+	}
+	updated = interpretExprNode(stmt->update, scope);
+	if (!updated) return 0;
+	if (!updateScopeValue(scope->parent, scope, stmt->var, updated)) {
+		deleteValueObject(updated);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Interprets a loop statement.  A body which does not declare any variables
+ * is executed in a single scope, which is emptied after each iteration,
+ * rather than in a new scope each time.  The hidden variables holding the
+ * values of the loop invariants start out as nil alongside the loop variable.
  *
  * \param [in] node The statement to interpret.
  *
@@ -3433,94 +5572,80 @@ ReturnObject *interpretLoopStmtNode(StmtNode *node,
 {
 	LoopStmtNode *stmt = (LoopStmtNode *)node->stmt;
 	ScopeObject *outer = createScopeObject(scope);
+	ScopeObject *inner = NULL;
+	ReturnObject *ret = NULL;
 	ValueObject *var = NULL;
+	unsigned int n;
 	if (!outer) return NULL;
 	/* Create a temporary loop variable if required */
 	if (stmt->var) {
-		var = createScopeValue(scope, outer, stmt->var);
-		if (!var) {
-			deleteScopeObject(outer);
-			return NULL;
+		if (!createScopeValue(scope, outer, stmt->var))
+			goto interpretLoopStmtNodeAbort;
+		var = createIntegerValueObject(0);
+		if (!var) goto interpretLoopStmtNodeAbort;
+		if (!updateScopeValue(scope, outer, stmt->var, var)) {
+			deleteValueObject(var);
+			goto interpretLoopStmtNodeAbort;
 		}
-		var->type = VT_INTEGER;
-		var->data.i = 0;
-		var->semaphore = 1;
+	}
+	/* Loop invariants are evaluated again each time the loop executes */
+	for (n = 0; stmt->invariants && n < stmt->invariants->num; n++) {
+		if (!createScopeValue(scope, outer, stmt->invariants->ids[n]))
+			goto interpretLoopStmtNodeAbort;
 	}
 	while (1) {
 		if (stmt->guard) {
-			ValueObject *val = interpretExprNode(stmt->guard, outer);
-			ValueObject *use = val;
-			unsigned short cast = 0;
 			int guardval;
-			if (val->type != VT_BOOLEAN && val->type != VT_INTEGER) {
-				use = castBooleanImplicit(val, scope);
-				if (!use) {
-					deleteScopeObject(outer);
-					deleteValueObject(val);
-					return NULL;
-				}
-				cast = 1;
-			}
-			guardval = getInteger(use);
-			if (cast) deleteValueObject(use);
-			deleteValueObject(val);
+			if (!getLoopGuardValue(stmt, outer, &guardval))
+				goto interpretLoopStmtNodeAbort;
 			if (guardval == 0) break;
 		}
 		if (stmt->body) {
-			ReturnObject *result = interpretBlockNode(stmt->body, outer);
-			if (!result) {
-				deleteScopeObject(outer);
-				return NULL;
+			ReturnObject *result = NULL;
+			if (stmt->declares)
+				result = interpretBlockNode(stmt->body, outer);
+			else {
+				if (!inner && !(inner = createScopeObject(outer)))
+					goto interpretLoopStmtNodeAbort;
+				result = interpretStmtNodeList(stmt->body->stmts, inner);
+				/* Start the next iteration with an empty scope */
+				if (inner->numvals > 0 || inner->numelems > 0) {
+					deleteScopeObject(inner);
+					inner = NULL;
+				}
+				else if (getType(inner->impvar) != VT_NIL) {
+					deleteValueObject(inner->impvar);
+					inner->impvar = createNilValueObject();
+				}
 			}
+			if (!result)
+				goto interpretLoopStmtNodeAbort;
 			else if (result->type == RT_BREAK) {
 				deleteReturnObject(result);
 				break;
 			}
 			else if (result->type == RT_RETURN) {
-				deleteScopeObject(outer);
-				return result;
+				ret = result;
+				break;
 			}
 			else
 				deleteReturnObject(result);
 		}
-		if (stmt->update) {
-			/*
-			 * A little efficiency hack: if we know the operation to
-			 * perform, don't bother evaluating the ExprNode
-			 * structure, just go ahead and do it to the loop
-			 * variable.
-			 */
-			if (stmt->update->type == ET_OP) {
-				ValueObject *updated = NULL;
-				var = getScopeValue(scope, outer, stmt->var);
-				OpExprNode *op = (OpExprNode *)stmt->update->expr;
-				if (op->type == OP_ADD)
-					updated = createIntegerValueObject(var->data.i + 1);
-				else if (op->type == OP_SUB)
-					updated = createIntegerValueObject(var->data.i - 1);
-
-				if (!updateScopeValue(scope, outer, stmt->var, updated)) {
-					deleteValueObject(updated);
-					deleteScopeObject(outer);
-					return NULL;
-				}
-			}
-			else {
-				ValueObject *update = interpretExprNode(stmt->update, outer);
-				if (!update) {
-					deleteScopeObject(outer);
-					return NULL;
-				}
-				if (!updateScopeValue(scope, outer, stmt->var, update)) {
-					deleteScopeObject(outer);
-					deleteValueObject(update);
-					return NULL;
-				}
-			}
-		}
+		if (stmt->update && !stepLoopVariable(stmt, outer))
+			goto interpretLoopStmtNodeAbort;
 	}
+	deleteScopeObject(inner);
 	deleteScopeObject(outer);
+	if (ret) return ret;
 	return createReturnObject(RT_DEFAULT, NULL);
+
+interpretLoopStmtNodeAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	deleteScopeObject(inner);
+	deleteScopeObject(outer);
+
+	return NULL;
 }
 
 /**
@@ -3565,31 +5690,40 @@ ReturnObject *interpretFuncDefStmtNode(StmtNode *node,
 {
 	/* Add the function to the current scope */
 	FuncDefStmtNode *stmt = (FuncDefStmtNode *)node->stmt;
+	IdentifierNode *target = NULL;
 	ValueObject *init = NULL;
 	ScopeObject *dest = NULL;
 
 	dest = getScopeObject(scope, scope, stmt->scope);
 	if (!dest) return NULL;
-	if (getScopeValueLocal(scope, dest, stmt->name)) {
-		IdentifierNode *id = (IdentifierNode *)(stmt->name);
-		char *name = resolveIdentifierName(id, scope);
+	/* Evaluate the name being defined only once */
+	target = evaluateIdentifierNode(stmt->name, scope);
+	if (!target) return NULL;
+	if (getScopeValueLocal(scope, dest, target)) {
+		char *name = resolveIdentifierName(target, scope);
 		if (name) {
-			error(IN_FUNCTION_NAME_USED_BY_VARIABLE, id->fname, id->line, name);
+			error(IN_FUNCTION_NAME_USED_BY_VARIABLE, target->fname, target->line, name);
 			free(name);
 		}
-		return NULL;
+		goto interpretFuncDefStmtNodeAbort;
 	}
+	if (getErrorCode()) goto interpretFuncDefStmtNodeAbort;
 	init = createFunctionValueObject(stmt);
-	if (!init) return NULL;
-	if (!createScopeValue(scope, dest, stmt->name)) {
-		deleteValueObject(init);
-		return NULL;
-	}
-	if (!updateScopeValue(scope, dest, stmt->name, init)) {
-		deleteValueObject(init);
-		return NULL;
-	}
+	if (!init) goto interpretFuncDefStmtNodeAbort;
+	if (!createScopeValue(scope, dest, target))
+		goto interpretFuncDefStmtNodeAbort;
+	if (!updateScopeValue(scope, dest, target, init))
+		goto interpretFuncDefStmtNodeAbort;
+	deleteEvaluatedIdentifierNode(target, stmt->name);
 	return createReturnObject(RT_DEFAULT, NULL);
+
+interpretFuncDefStmtNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	if (init) deleteValueObject(init);
+	deleteEvaluatedIdentifierNode(target, stmt->name);
+
+	return NULL;
 }
 
 /**
@@ -3613,9 +5747,10 @@ ReturnObject *interpretExprStmtNode(StmtNode *node,
 {
 	/* Set the implicit variable to the result of the expression */
 	ExprNode *expr = (ExprNode *)node->stmt;
+	ValueObject *val = interpretExprNode(expr, scope);
+	if (!val) return NULL;
 	deleteValueObject(scope->impvar);
-	scope->impvar = interpretExprNode(expr, scope);
-	if (!scope->impvar) return NULL;
+	scope->impvar = val;
 	return createReturnObject(RT_DEFAULT, NULL);
 }
 
@@ -3636,44 +5771,50 @@ ReturnObject *interpretAltArrayDefStmtNode(StmtNode *node,
                                            ScopeObject *scope)
 {
 	AltArrayDefStmtNode *stmt = (AltArrayDefStmtNode *)node->stmt;
+	IdentifierNode *target = NULL;
 	ValueObject *init = NULL;
 	ScopeObject *dest = scope;
 	ReturnObject *ret = NULL;
-	if (getScopeValueLocal(scope, dest, stmt->name)) {
-		IdentifierNode *id = (IdentifierNode *)(stmt->name);
-		char *name = resolveIdentifierName(id, scope);
+	/* Evaluate the name being declared only once */
+	target = evaluateIdentifierNode(stmt->name, scope);
+	if (!target) return NULL;
+	if (getScopeValueLocal(scope, dest, target)) {
+		char *name = resolveIdentifierName(target, scope);
 		if (name) {
-			fprintf(stderr, "%s:%u: redefinition of existing variable at: %s\n", id->fname, id->line, name);
+			error(IN_REDEFINITION_OF_VARIABLE, target->fname, target->line, name);
 			free(name);
 		}
-		return NULL;
+		goto interpretAltArrayDefStmtNodeAbort;
 	}
+	if (getErrorCode()) goto interpretAltArrayDefStmtNodeAbort;
 	if (stmt->parent) {
 		ScopeObject *parent = getScopeObject(scope, scope, stmt->parent);
-		if (!parent) return NULL;
+		if (!parent) goto interpretAltArrayDefStmtNodeAbort;
 		init = createArrayValueObject(parent);
 	}
 	else {
 		init = createArrayValueObject(scope);
 	}
-	if (!init) return NULL;
+	if (!init) goto interpretAltArrayDefStmtNodeAbort;
 
 	/* Populate the array body */
 	ret = interpretStmtNodeList(stmt->body->stmts, getArray(init));
-	if (!ret) {
-		deleteValueObject(init);
-		return NULL;
-	}
+	if (!ret) goto interpretAltArrayDefStmtNodeAbort;
 	deleteReturnObject(ret);
-	if (!createScopeValue(scope, dest, stmt->name)) {
-		deleteValueObject(init);
-		return NULL;
-	}
-	if (!updateScopeValue(scope, dest, stmt->name, init)) {
-		deleteValueObject(init);
-		return NULL;
-	}
+	if (!createScopeValue(scope, dest, target))
+		goto interpretAltArrayDefStmtNodeAbort;
+	if (!updateScopeValue(scope, dest, target, init))
+		goto interpretAltArrayDefStmtNodeAbort;
+	deleteEvaluatedIdentifierNode(target, stmt->name);
 	return createReturnObject(RT_DEFAULT, NULL);
+
+interpretAltArrayDefStmtNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	if (init) deleteValueObject(init);
+	deleteEvaluatedIdentifierNode(target, stmt->name);
+
+	return NULL;
 }
 
 /*
@@ -3713,7 +5854,13 @@ static ReturnObject *(*StmtJumpTable[14])(StmtNode *, ScopeObject *) = {
 ReturnObject *interpretStmtNode(StmtNode *node,
                                 ScopeObject *scope)
 {
-	return StmtJumpTable[node->type](node, scope);
+	ReturnObject *ret = NULL;
+	unsigned int prev;
+	if (!CurrentProfile) return StmtJumpTable[node->type](node, scope);
+	if (!enterProfileLine(CurrentProfile, node->line, &prev)) return NULL;
+	ret = StmtJumpTable[node->type](node, scope);
+	leaveProfileLine(CurrentProfile, prev);
+	return ret;
 }
 
 /**
@@ -3788,10 +5935,44 @@ ReturnObject *interpretBlockNode(BlockNode *node,
  */
 int interpretMainNode(MainNode *main)
 {
-	ReturnObject *ret = NULL;
+	ScopeObject *scope = NULL;
+	int status;
 	if (!main) return 1;
-	ret = interpretBlockNode(main->block, NULL);
-       	if (!ret) return 1;
+	scope = createScopeObject(NULL);
+	if (!scope) return 1;
+	status = interpretMainNodeScope(main, scope);
+	deleteScopeObject(scope);
+	return status;
+}
+
+/**
+ * Interprets the main block of code in an existing outermost scope.  The
+ * values the block creates are left in the scope, so separate programs
+ * interpreted in the same scope may use each other's variables and functions.
+ *
+ * \param [in] main The main block of code to interpret.
+ *
+ * \param [in,out] scope The outermost scope to interpret \a main in.
+ *
+ * \pre \a main contains a block of code created by parseMainNode().
+ *
+ * \pre \a scope was created by createScopeObject() with no parent.
+ *
+ * \return The final status of the program.
+ *
+ * \retval 0 \a main was interpreted without any errors.
+ *
+ * \retval 1 An error occurred while interpreting \a main.
+ */
+int interpretMainNodeScope(MainNode *main,
+                           ScopeObject *scope)
+{
+	ReturnObject *ret = NULL;
+	if (!main || !scope) return 1;
+	ret = interpretStmtNodeList(main->block->stmts, scope);
+	/* The values cast may be freed once the program is done with them */
+	clearCastCache();
+	if (!ret) return 1;
 	deleteReturnObject(ret);
 	return 0;
 }
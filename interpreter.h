@@ -17,25 +17,108 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <math.h>
+#include <stdint.h>
 
 #include "parser.h"
 #include "unicode.h"
+#include "memory.h"
+#include "intern.h"
+#include "profiler.h"
+#include "stats.h"
 
 /**
- * Retrieves a value's integer data.
+ * \page immediates Immediate Values
+ *
+ * Integer, decimal, boolean, and nil values are stored directly in the bits of
+ * a value pointer instead of being allocated, so arithmetic and comparisons
+ * need not allocate their results.  The two lowest bits of such a pointer,
+ * which are always zero for allocated values, hold a tag:
+ *
+ *   - \c 01 for integers, stored in the remaining bits,
+ *   - \c 10 for decimals, stored in the upper 32 bits on 64-bit systems,
+ *   - \c 11 for nil (\c 0x3) and booleans (\c 0x7 for FAIL, \c 0xf for WIN).
+ *
+ * Integers too large for the remaining bits (and, on 32-bit systems,
+ * decimals) are allocated as before.  Immediate values are immutable and are
+ * never counted or freed, so copying and deleting them does nothing; only
+ * strings, functions, arrays, and large integers are reference counted.
+ */
+
+/**
+ * Retrieves the tag of a value pointer.
+ */
+#define getImmediateTag(value) ((uintptr_t)(value) & 3)
+
+/**
+ * Checks whether a value is stored in its pointer rather than allocated.
+ */
+#define isImmediate(value) (getImmediateTag(value) != 0)
+
+/**
+ * The tags of immediate values.
+ */
+#define IMMEDIATE_INTEGER 1
+#define IMMEDIATE_FLOAT   2
+#define IMMEDIATE_OTHER   3
+
+/**
+ * The immediate nil value.
+ */
+#define IMMEDIATE_NIL ((ValueObject *)(uintptr_t)0x3)
+
+/**
+ * The immediate boolean values.
+ */
+#define IMMEDIATE_BOOLEAN(data) ((ValueObject *)(uintptr_t)((data) ? 0xf : 0x7))
+
+/**
+ * The range of integers which may be stored as immediate values.
+ */
+#define IMMEDIATE_INTEGER_MAX ((long long)(INTPTR_MAX >> 2))
+#define IMMEDIATE_INTEGER_MIN (-IMMEDIATE_INTEGER_MAX - 1)
+
+/**
+ * Decimals are stored as immediate values if a pointer can hold all their bits
+ * alongside the tag.
+ */
+#if UINTPTR_MAX > 0xffffffffu
+#define IMMEDIATE_FLOATS
+#endif
+
+/**
+ * Retrieves a value's type.
+ */
+#define getType(value) (!isImmediate(value) ? (value)->type \
+		: getImmediateTag(value) == IMMEDIATE_INTEGER ? VT_INTEGER \
+		: getImmediateTag(value) == IMMEDIATE_FLOAT ? VT_FLOAT \
+		: (value) == IMMEDIATE_NIL ? VT_NIL : VT_BOOLEAN)
+
+/**
+ * Retrieves a value's integer data (or boolean data, as 0 or 1).
  */
-#define getInteger(value) (value->data.i)
+#define getInteger(value) (getImmediateTag(value) == IMMEDIATE_INTEGER \
+		? (long long)((intptr_t)(value) >> 2) \
+		: getImmediateTag(value) == IMMEDIATE_OTHER \
+		? (long long)((uintptr_t)(value) >> 3) \
+		: (value)->data.i)
 
 /**
  * Retrieves a value's decimal data.
  */
-#define getFloat(value) (value->data.f)
+#define getFloat(value) (getImmediateTag(value) == IMMEDIATE_FLOAT \
+		? getImmediateFloat(value) \
+		: (value)->data.f)
 
 /**
  * Retrieves a value's string data.
  */
 #define getString(value) (value->data.s)
 
+/**
+ * Retrieves the length of a value's string data.
+ */
+#define getStringLength(value) (value->length)
+
 /**
  * Retrieves a value's function data.
  */
@@ -84,9 +167,14 @@ typedef union {
  * Stores a value.
  */
 typedef struct {
-	ValueType type;           /**< The type of value stored. */
-	ValueData data;           /**< The value data. */
-	unsigned short semaphore; /**< A semaphore for value usage. */
+	ValueType type;          /**< The type of value stored. */
+	ValueData data;          /**< The value data. */
+	unsigned int semaphore;  /**< A semaphore for value usage, counting the references to the value. */
+	unsigned short borrowed; /**< Whether string data is owned elsewhere and must not be freed. */
+	unsigned short plain;    /**< Whether string data contains no escape sequences. */
+	StringTemplate *tmpl;    /**< The template to interpolate string data with (NULL if none). */
+	size_t length;           /**< The length of string data. */
+	size_t capacity;         /**< The space allocated for string data (0 if borrowed). */
 } ValueObject;
 
 /**
@@ -100,22 +188,81 @@ typedef enum {
 
 /**
  * Stores return state.
+ *
+ * \note A return of a call in tail position carries the called function and
+ * its scope instead of a value.  The calling function continues with them in
+ * place of its own body and scope.
  */
 typedef struct {
-	ReturnType type;    /**< The type of return encountered. */
-	ValueObject *value; /**< The optional return value. */
+	ReturnType type;            /**< The type of return encountered. */
+	ValueObject *value;         /**< The optional return value. */
+	FuncDefStmtNode *func;      /**< The function called in tail position, if any. */
+	struct scopeobject *scope;  /**< The scope prepared for \a func, which replaces the scope of the returning function. */
 } ReturnObject;
 
+/**
+ * Represents when buffered output is written.
+ */
+typedef enum {
+	FP_LINE, /**< At the end of each line. */
+	FP_FULL, /**< When the buffer fills and before input is read. */
+	FP_EXIT  /**< Only when the buffer fills and when the program exits. */
+} FlushPolicy;
+
+/**
+ * The size of the output buffer used by the full and exit flush policies.
+ */
+#define OUTPUT_BUFFER_SIZE 65536
+
+/**
+ * The size of the buffer input is read into from standard input, which holds
+ * the lines read ahead of the one being read.
+ */
+#define INPUT_BUFFER_SIZE 65536
+
+/**
+ * The number of named values a scope holds before they are indexed by a hash
+ * table.
+ */
+#define SCOPE_HASH_THRESHOLD 8
+
+/**
+ * The number of bits of the hash which selects an entry of the cast cache,
+ * which holds (1 << CAST_CACHE_BITS) entries.
+ */
+#define CAST_CACHE_BITS 6
+
+/**
+ * Stores the result of an explicit cast of a value which does not depend on
+ * the scope it is cast in, so that casting the same value to the same type
+ * again need not repeat the conversion.  Values are identified by their
+ * pointers, which, for immediate values, are their contents.
+ */
+typedef struct {
+	ValueObject *key;   /**< The value that was cast (NULL if the entry is empty). */
+	ValueType type;     /**< The type \a key was cast to. */
+	ValueObject *value; /**< The result of the cast, which the entry holds a copy of. */
+} CastCacheEntry;
+
 /**
  * Stores a set of variables hierarchically.
  */
 typedef struct scopeobject {
 	struct scopeobject *parent; /**< The parent scope. */
 	struct scopeobject *caller; /**< The caller scope (if in a function). */
+	struct scopeobject *global; /**< The outermost scope this scope is nested in. */
 	ValueObject *impvar;        /**< The \ref impvar "implicit variable". */
 	unsigned int numvals;       /**< The number of values in the scope. */
-	char **names;               /**< The names of the values. */
+	unsigned int size;          /**< The number of values there is space for. */
+	char **names;               /**< The names of the values (stored after \a values). */
+	unsigned int numcopies;     /**< The number of names in \a names which are copies rather than atoms. */
 	ValueObject **values;       /**< The values in the scope. */
+	unsigned int numelems;      /**< The number of elements in the scope. */
+	unsigned int elemsize;      /**< The number of elements there is space for. */
+	unsigned int numsparse;     /**< The number of values named by an index past the elements. */
+	ValueObject **elems;        /**< The values named 0, 1, 2, and so on (NULL if deleted). */
+	unsigned int tablesize;     /**< The number of entries in \a table. */
+	unsigned int *table;        /**< The positions of values by the hash of their names, plus one (NULL in small scopes). */
 } ScopeObject;
 
 /**
@@ -127,7 +274,18 @@ typedef struct scopeobject {
 void printInterpreterError(const char *, IdentifierNode *, ScopeObject *);
 char *copyString(char *);
 unsigned int isHexString(const char *);
+int isStringEqual(ValueObject *, ValueObject *);
+int findSwitchCase(SwitchStmtNode *, ScopeObject *, unsigned int *);
 char *resolveIdentifierName(IdentifierNode *, ScopeObject *);
+IdentifierNode *evaluateIdentifierNode(IdentifierNode *, ScopeObject *);
+void deleteEvaluatedIdentifierNode(IdentifierNode *, IdentifierNode *);
+int setFlushPolicy(FlushPolicy);
+void setOutputFile(FILE *);
+FILE *getOutputFile(void);
+void setProfile(Profile *);
+FILE *redirectFile(FILE *);
+void writeFile(FILE *, const char *, size_t);
+char *readInputLine(void);
 int resolveTerminalSlot(ScopeObject *, ScopeObject *, IdentifierNode *, ScopeObject **, IdentifierNode **);
 /**@}*/
 
@@ -142,10 +300,12 @@ ValueObject *createBooleanValueObject(int);
 ValueObject *createIntegerValueObject(long long);
 ValueObject *createFloatValueObject(float);
 ValueObject *createStringValueObject(char *);
+ValueObject *createBorrowedStringValueObject(char *, StringTemplate *);
 ValueObject *createFunctionValueObject(FuncDefStmtNode *);
 ValueObject *createArrayValueObject(ScopeObject *);
 ValueObject *copyValueObject(ValueObject *);
 void deleteValueObject(ValueObject *);
+float getImmediateFloat(ValueObject *);
 /**@}*/
 
 /**
@@ -157,12 +317,20 @@ void deleteValueObject(ValueObject *);
 ScopeObject *createScopeObject(ScopeObject *);
 ScopeObject *createScopeObjectCaller(ScopeObject *, ScopeObject *);
 void deleteScopeObject(ScopeObject *);
+void clearScopeObject(ScopeObject *);
+int reserveScopeValues(ScopeObject *, unsigned int);
+void replaceScopeValues(ScopeObject *, ScopeObject *);
+ValueObject **getResolvedScopeSlot(ScopeObject *, IdentifierNode *);
+FuncDefStmtNode *getResolvedFunction(ScopeObject *, FuncCallExprNode *);
+FuncDefStmtNode *getFuncCallTarget(FuncCallExprNode *, ScopeObject *, ScopeObject **);
+int canReuseFuncScope(FuncDefStmtNode *, FuncDefStmtNode *, ScopeObject *);
 ValueObject *createScopeValue(ScopeObject *, ScopeObject *, IdentifierNode *);
 ValueObject *updateScopeValue(ScopeObject *, ScopeObject *, IdentifierNode *, ValueObject *);
 ValueObject *getScopeValue(ScopeObject *, ScopeObject *, IdentifierNode *);
 ValueObject *getScopeValueLocal(ScopeObject *, ScopeObject *, IdentifierNode *);
 ScopeObject *getScopeObject(ScopeObject *, ScopeObject *, IdentifierNode *);
 ScopeObject *getScopeObjectLocal(ScopeObject *, ScopeObject *, IdentifierNode *);
+ScopeObject *getScopeObjectLocalCaller(ScopeObject *, ScopeObject *, IdentifierNode *);
 void deleteScopeValue(ScopeObject *, ScopeObject *, IdentifierNode *);
 /**@}*/
 
@@ -190,6 +358,12 @@ ValueObject *castBooleanExplicit(ValueObject *, ScopeObject *);
 ValueObject *castIntegerExplicit(ValueObject *, ScopeObject *);
 ValueObject *castFloatExplicit(ValueObject *, ScopeObject *);
 ValueObject *castStringExplicit(ValueObject *, ScopeObject *);
+ValueObject *interpolateStringTemplate(StringTemplate *, ValueObject *, ScopeObject *);
+void clearCastCache(void);
+ValueObject *concatStringValues(ValueObject **, unsigned int, ScopeObject *, IdentifierNode *);
+int isAppendAssignment(AssignmentStmtNode *);
+int getBooleanValue(ValueObject *, ScopeObject *, int *);
+int printValueObject(ValueObject *, ScopeObject *, FILE *);
 /**@}*/
 
 /**
@@ -199,10 +373,12 @@ ValueObject *castStringExplicit(ValueObject *, ScopeObject *);
  */
 /**@{*/
 ValueObject *interpretExprNode(ExprNode *, ScopeObject *);
+int getConditionValue(ExprNode *, ScopeObject *, int *);
 ReturnObject *interpretStmtNode(StmtNode *, ScopeObject *);
 ReturnObject *interpretStmtNodeList(StmtNodeList *, ScopeObject *);
 ReturnObject *interpretBlockNode(BlockNode *, ScopeObject *);
 int interpretMainNode(MainNode *);
+int interpretMainNodeScope(MainNode *, ScopeObject *);
 /**@}*/
 
 /**
@@ -216,6 +392,7 @@ ValueObject *interpretCastExprNode(ExprNode *, ScopeObject *);
 ValueObject *interpretFuncCallExprNode(ExprNode *, ScopeObject *);
 ValueObject *interpretIdentifierExprNode(ExprNode *, ScopeObject *);
 ValueObject *interpretConstantExprNode(ExprNode *, ScopeObject *);
+ValueObject *interpretInvariantExprNode(ExprNode *, ScopeObject *);
 /**@}*/
 
 /**
@@ -226,12 +403,24 @@ ValueObject *interpretConstantExprNode(ExprNode *, ScopeObject *);
 /**@{*/
 ValueObject *interpretNotOpExprNode(OpExprNode *, ScopeObject *);
 ValueObject *interpretArithOpExprNode(OpExprNode *, ScopeObject *);
+ValueObject *interpretArithOpValues(OpType, ValueObject *, ValueObject *, ScopeObject *);
 ValueObject *interpretBoolOpExprNode(OpExprNode *, ScopeObject *);
 ValueObject *interpretEqualityOpExprNode(OpExprNode *, ScopeObject *);
+ValueObject *interpretEqualityOpValues(OpType, ValueObject *, ValueObject *);
 ValueObject *interpretConcatOpExprNode(OpExprNode *, ScopeObject *);
 ValueObject *interpretOpExprNode(ExprNode *, ScopeObject *);
 /**@}*/
 
+/**
+ * \name Loop helpers
+ *
+ * Functions for evaluating the guards and updates of loops.
+ */
+/**@{*/
+int getLoopGuardValue(LoopStmtNode *, ScopeObject *, int *);
+int stepLoopVariable(LoopStmtNode *, ScopeObject *);
+/**@}*/
+
 /**
  * \name Statement interpreters
  *
@@ -0,0 +1,316 @@
+#include "lci.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "tokenizer.h"
+#include "parser.h"
+#include "optimizer.h"
+#include "resolver.h"
+#include "interpreter.h"
+#include "intern.h"
+#include "memory.h"
+#include "error.h"
+
+/**
+ * Stores a parsed program.
+ */
+struct lciprogram {
+	MainNode *node;          /**< The parse tree of the program. */
+	char *fname;             /**< The name of the source file, which the parse tree refers to. */
+	struct lciprogram *next; /**< The next program owned by the same context. */
+};
+
+/**
+ * Stores the state of an embedded interpreter.
+ */
+struct lcicontext {
+	IoHandler io;          /**< The functions input and output are performed with. */
+	ScopeObject *scope;    /**< The outermost scope programs are executed in. */
+	LciProgram *programs;  /**< The programs parsed with the context. */
+#ifdef HAVE_PTHREAD
+	pthread_mutex_t lock;  /**< Guards the context while it is used. */
+#endif
+};
+
+/**
+ * Starts using a context on the calling thread.  The context is locked and
+ * its input and output functions replace those of the thread.
+ *
+ * \param [in,out] ctx The context to use.
+ *
+ * \return The input and output functions the thread used before.
+ */
+static const IoHandler *enterContext(LciContext *ctx)
+{
+	const IoHandler *prev = NULL;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+	prev = getIoHandler();
+	setIoHandler(&ctx->io);
+	clearErrorCode();
+	return prev;
+}
+
+/**
+ * Stops using a context on the calling thread.
+ *
+ * \param [in,out] ctx The context to stop using.
+ *
+ * \param [in] prev The input and output functions returned by enterContext().
+ */
+static void leaveContext(LciContext *ctx,
+                         const IoHandler *prev)
+{
+	setIoHandler(prev);
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+}
+
+/**
+ * Gets the exit status of a call which failed.
+ *
+ * \return The exit code of the first error reported during the call, or 1 if
+ * none was reported (such as when memory could not be allocated).
+ */
+static int getFailureStatus(void)
+{
+	int status = getErrorCode();
+	return status ? status : 1;
+}
+
+/**
+ * Deletes a program.
+ *
+ * \param [in,out] prog The program to delete.
+ */
+static void deleteLciProgram(LciProgram *prog)
+{
+	if (!prog) return;
+	deleteMainNode(prog->node);
+	free(prog->fname);
+	free(prog);
+}
+
+/**
+ * Creates a context.
+ *
+ * \param [in] io The functions to perform input and output with (NULL for the
+ * standard streams).
+ *
+ * \return A context with an empty outermost scope.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+LciContext *lciCreateContext(const LciIo *io)
+{
+	LciContext *p = malloc(sizeof(LciContext));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->io.data = io ? io->data : NULL;
+	p->io.write = io ? io->write : NULL;
+	p->io.read = io ? io->read : NULL;
+	p->programs = NULL;
+	p->scope = createScopeObject(NULL);
+	if (!p->scope) {
+		free(p);
+		return NULL;
+	}
+#ifdef HAVE_PTHREAD
+	if (pthread_mutex_init(&p->lock, NULL)) {
+		deleteScopeObject(p->scope);
+		free(p);
+		return NULL;
+	}
+#endif
+	return p;
+}
+
+/**
+ * Deletes a context along with the programs parsed with it.
+ *
+ * \param [in,out] ctx The context to delete.
+ *
+ * \pre No other context is executing a program parsed with \a ctx.
+ *
+ * \post The memory at \a ctx and any of its programs will be freed.
+ */
+void lciDeleteContext(LciContext *ctx)
+{
+	const IoHandler *prev = NULL;
+	if (!ctx) return;
+	prev = enterContext(ctx);
+	while (ctx->programs) {
+		LciProgram *next = ctx->programs->next;
+		deleteLciProgram(ctx->programs);
+		ctx->programs = next;
+	}
+	deleteScopeObject(ctx->scope);
+	leaveContext(ctx, prev);
+#ifdef HAVE_PTHREAD
+	pthread_mutex_destroy(&ctx->lock);
+#endif
+	free(ctx);
+}
+
+/**
+ * Parses a program.  The program is optimized and resolved as it would be by
+ * lci itself and is owned by the context until it is deleted.
+ *
+ * \param [in,out] ctx The context to parse the program with.
+ *
+ * \param [in] source The source code of the program, which need not be
+ * terminated.
+ *
+ * \param [in] length The number of characters in \a source.
+ *
+ * \param [in] fname The name of the source file, used in error messages (NULL
+ * for none).
+ *
+ * \param [out] prog The parsed program.
+ *
+ * \retval 0 \a prog holds the parsed program.
+ *
+ * \return The exit status of the error which stopped the program from being
+ * parsed.
+ */
+int lciParse(LciContext *ctx,
+             const char *source,
+             size_t length,
+             const char *fname,
+             LciProgram **prog)
+{
+	const IoHandler *prev = NULL;
+	LciProgram *p = NULL;
+	char *buffer = NULL;
+	TokenStream *stream = NULL;
+	int status = 0;
+	*prog = NULL;
+	if (!fname) fname = "lci";
+	prev = enterContext(ctx);
+	p = malloc(sizeof(LciProgram));
+	if (!p) {
+		perror("malloc");
+		goto lciParseAbort;
+	}
+	p->node = NULL;
+	p->fname = malloc(sizeof(char) * (strlen(fname) + 1));
+	if (!p->fname) {
+		perror("malloc");
+		goto lciParseAbort;
+	}
+	strcpy(p->fname, fname);
+	/* The lexer modifies the characters it reads, so it reads a copy */
+	buffer = malloc(sizeof(char) * (length + 1));
+	if (!buffer) {
+		perror("malloc");
+		goto lciParseAbort;
+	}
+	memcpy(buffer, source, length);
+	buffer[length] = '\0';
+	/* Remove hash bang line if run as a standalone script */
+	if (buffer[0] == '#' && buffer[1] == '!') {
+		size_t n;
+		for (n = 0; buffer[n] && buffer[n] != '\n' && buffer[n] != '\r'; n++)
+			buffer[n] = ' ';
+	}
+	stream = createTokenStream(buffer, (unsigned int)length, p->fname);
+	if (!stream) goto lciParseAbort;
+	p->node = parseMainNode(stream);
+	/* Tokens refer to the source, so it may only be freed after them */
+	deleteTokenStream(stream);
+	free(buffer);
+	buffer = NULL;
+	if (!p->node
+			|| optimizeMainNode(p->node, OPTIMIZE_DEFAULT)
+			|| resolveMainNode(p->node))
+		goto lciParseAbort;
+	p->next = ctx->programs;
+	ctx->programs = p;
+	*prog = p;
+	leaveContext(ctx, prev);
+	return 0;
+
+lciParseAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	status = getFailureStatus();
+	if (buffer) free(buffer);
+	deleteLciProgram(p);
+	leaveContext(ctx, prev);
+	return status;
+}
+
+/**
+ * Executes a program in the outermost scope of a context.  The values the
+ * program creates stay in the scope until the context is reset, so programs
+ * executed one after another may use each other's variables and functions.
+ *
+ * \param [in,out] ctx The context to execute the program with.
+ *
+ * \param [in] prog The program to execute, which may have been parsed with
+ * any context.
+ *
+ * \note A program which declares variables or functions must be executed in a
+ * context which has been reset with lciResetContext() to be executed again.
+ *
+ * \retval 0 \a prog was executed without any errors.
+ *
+ * \return The exit status of the error which stopped \a prog.
+ */
+int lciExecute(LciContext *ctx,
+               LciProgram *prog)
+{
+	const IoHandler *prev = NULL;
+	int status = 0;
+	if (!prog) return 1;
+	prev = enterContext(ctx);
+	if (interpretMainNodeScope(prog->node, ctx->scope))
+		status = getFailureStatus();
+	leaveContext(ctx, prev);
+	return status;
+}
+
+/**
+ * Removes every value from the outermost scope of a context.  The programs
+ * parsed with the context are kept.
+ *
+ * \param [in,out] ctx The context to reset.
+ */
+void lciResetContext(LciContext *ctx)
+{
+	const IoHandler *prev = enterContext(ctx);
+	clearScopeObject(ctx->scope);
+	leaveContext(ctx, prev);
+}
+
+/**
+ * Returns the memory the calling thread keeps for reuse so that other threads
+ * may use it.  A thread which has used lci should call this once it is done,
+ * such as before it exits, since the memory would otherwise stay with the
+ * thread until lciShutdown().
+ *
+ * \note The thread may use lci again afterwards.
+ */
+void lciReleaseThread(void)
+{
+	releaseMemoryPools();
+}
+
+/**
+ * Frees the memory shared by every context, such as before the host exits.
+ * The memory kept by threads other than the calling thread is only freed once
+ * each of them has called lciReleaseThread().
+ *
+ * \pre Every context has been deleted and no other thread is using lci.
+ */
+void lciShutdown(void)
+{
+	deleteMemoryPools();
+	deleteInternTable();
+}
@@ -0,0 +1,79 @@
+/**
+ * Structures and functions for embedding lci in another program.  A context
+ * owns the programs parsed with it, the outermost scope they are executed in,
+ * and the functions their input and output are performed with, so a host may
+ * parse a program once and execute it many times without starting a new
+ * process.
+ *
+ * Programs are never modified once they are parsed, so a program owned by one
+ * context may also be executed by other contexts.  A context may be used by
+ * any thread, but by only one thread at a time: calls made with the same
+ * context from several threads are run one after another.  Threads which need
+ * to execute programs at the same time should each use their own context.
+ * Each thread keeps the memory it frees for its own reuse, so a thread should
+ * call lciReleaseThread() once it is done with lci, and every thread other than
+ * the one calling lciShutdown() must have done so for all memory to be freed.
+ *
+ * Errors are reported with the error function of a context and returned as the
+ * exit status lci itself would have exited with; they never end the host
+ * process.
+ *
+ * \file   lci.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __LCI_H__
+#define __LCI_H__
+
+#include <stddef.h>
+
+/**
+ * The stream passed to the output function of a context for program output.
+ */
+#define LCI_OUTPUT 0
+
+/**
+ * The stream passed to the output function of a context for errors and the
+ * output of \c INVISIBLE.
+ */
+#define LCI_ERROR 1
+
+/**
+ * Stores the functions a context performs input and output with.  A function
+ * which is NULL is replaced by the corresponding standard stream.
+ */
+typedef struct {
+	void *data;                                         /**< The data passed to each function. */
+	size_t (*write)(void *, int, const char *, size_t); /**< Writes characters to \c LCI_OUTPUT or \c LCI_ERROR. */
+	int (*read)(void *);                                /**< Reads the next character of input (EOF at the end). */
+} LciIo;
+
+/**
+ * Stores the state of an embedded interpreter.
+ */
+typedef struct lcicontext LciContext;
+
+/**
+ * Stores a parsed program.
+ */
+typedef struct lciprogram LciProgram;
+
+/**
+ * \name Contexts
+ *
+ * Functions for creating contexts and running programs with them.
+ */
+/**@{*/
+LciContext *lciCreateContext(const LciIo *);
+void lciDeleteContext(LciContext *);
+int lciParse(LciContext *, const char *, size_t, const char *, LciProgram **);
+int lciExecute(LciContext *, LciProgram *);
+void lciResetContext(LciContext *);
+void lciReleaseThread(void);
+void lciShutdown(void);
+/**@}*/
+
+#endif /* __LCI_H__ */
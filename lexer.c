@@ -1,203 +1,151 @@
 #include "lexer.h"
 
 /**
- * Creates a lexeme.
+ * Initializes a lexer to scan a buffer.
  *
- * \param [in] image The string that identifies the lexeme.
+ * \param [out] lexer The lexer to initialize.
  *
- * \param [in] fname The name of the file containing the lexeme.
+ * \param [in,out] buffer The characters to turn into lexemes.
  *
- * \param [in] line  The line number the lexeme occurred on.
+ * \param [in] size The number of characters in \a buffer.
  *
- * \return A new lexeme with the desired properties.
+ * \param [in] fname The name of the file \a buffer was read from.
  *
- * \retval NULL Memory allocation failed.
- */
-Lexeme *createLexeme(char *image, const char *fname, unsigned int line)
-{
-	Lexeme *ret = malloc(sizeof(Lexeme));
-	if (!ret) {
-		perror("malloc");
-		return NULL;
-	}
-	ret->image = malloc(sizeof(char) * (strlen(image) + 1));
-	if (!(ret->image)) {
-		free(ret);
-		perror("malloc");
-		return NULL;
-	}
-	strcpy(ret->image, image);
-	/**
-	 * \note \a fname is not copied because it only one copy is stored for
-	 * all lexemes from the same file.  This is simply to avoid large
-	 * numbers of lexemes storing duplicate file name strings.
-	 */
-	ret->fname = fname;
-	ret->line = line;
-#ifdef DEBUG
-	fprintf(stderr, "Creating lexeme [%s]\n", image);
-#endif
-	return ret;
-}
-
-/**
- * Deletes a lexeme.
+ * \pre \a buffer is followed by a null character at \a buffer[\a size].
  *
- * \param [in,out] lexeme The lexeme to delete.
+ * \post \a lexer will be positioned at the start of \a buffer.
  */
-void deleteLexeme(Lexeme *lexeme)
+void initLexer(Lexer *lexer,
+               char *buffer,
+               unsigned int size,
+               const char *fname)
 {
-	if (!lexeme) return;
-	free(lexeme->image);
-	/**
-	 * \note We do not free the file name because it is shared between many
-	 * lexemes and is freed by whomever created the file name string.
-	 */
-	free(lexeme);
+	lexer->buffer = buffer;
+	lexer->size = size;
+	lexer->start = buffer;
+	lexer->fname = fname;
+	lexer->line = 1;
+	lexer->linestart = 1;
+	lexer->spacing = 0;
+	lexer->end = NULL;
+	lexer->done = 0;
 }
 
 /**
- * Creates a list of lexemes.
+ * Stores a lexeme scanned by a lexer.
  *
- * \return An empty lexeme list.
+ * \param [in,out] lexer The lexer that scanned the lexeme.
  *
- * \retval NULL Memory allocation failed.
- */
-LexemeList *createLexemeList(void)
-{
-	LexemeList *p = malloc(sizeof(LexemeList));
-	if (!p) {
-		perror("malloc");
-		return NULL;
-	}
-	p->num = 0;
-	p->lexemes = NULL;
-	return p;
-}
-
-/**
- * Adds a lexeme to a list of lexemes.
+ * \param [out] lex The lexeme to store.
  *
- * \param [in,out] list The list of lexemes to add \a lexeme to.
+ * \param [in] image The characters that identify the lexeme.
  *
- * \param [in] lexeme The lexeme to add to \a list.
+ * \param [in] length The number of characters in \a image.
  *
- * \post \a lexeme will be added to the end of \a list and the size of \a list
- * will be updated.
+ * \param [in] line The line number the lexeme occurred on.
  *
- * \return A pointer to the added lexeme (will be the same as \a lexeme).
+ * \note Neither \a image nor the file name are copied.  The file name is
+ * shared by all lexemes from the same file and \a image refers either to the
+ * buffer being scanned or to a string constant.
  *
- * \retval NULL Memory allocation failed.
+ * \post The previous lexeme scanned from the buffer, which has now been
+ * scanned past, will be null-terminated in place.
+ *
+ * \return 1
  */
-Lexeme *addLexeme(LexemeList *list, Lexeme *lexeme)
+static int storeLexeme(Lexer *lexer,
+                       Lexeme *lex,
+                       const char *image,
+                       unsigned int length,
+                       unsigned int line)
 {
-	unsigned int newsize;
-	void *mem = NULL;
-	if (!list) return NULL;
-	newsize = list->num + 1;
-	mem = realloc(list->lexemes, sizeof(Lexeme *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return NULL;
-	}
-	list->lexemes = mem;
-	list->lexemes[list->num] = lexeme;
-	list->num = newsize;
-	return lexeme;
+	if (lexer->end) *(lexer->end) = '\0';
+	if (image >= lexer->buffer && image < lexer->buffer + lexer->size)
+		lexer->end = lexer->buffer + (image - lexer->buffer) + length;
+	else
+		lexer->end = NULL;
+	lexer->linestart = (*image == '\n');
+	lex->image = image;
+	lex->length = length;
+	lex->fname = lexer->fname;
+	lex->line = line;
+#ifdef DEBUG
+	fprintf(stderr, "Creating lexeme [%.*s]\n", (int)length, image);
+#endif
+	return 1;
 }
 
 /**
- * Deletes a list of lexemes.
+ * Stops a lexer after an error, so that no more lexemes are scanned.
+ *
+ * \param [in,out] lexer The lexer to stop.
  *
- * \param [in,out] list The lexeme list to delete.
+ * \post The image of the previous lexeme will be null-terminated.
  *
- * \post The memory at \a list and all of its members will be freed.
+ * \retval 0 Always, so errors may be returned with this.
  */
-void deleteLexemeList(LexemeList *list)
+static int stopLexer(Lexer *lexer)
 {
-	unsigned int n;
-	if (!list) return;
-	for (n = 0; n < list->num; n++)
-		deleteLexeme(list->lexemes[n]);
-	free(list->lexemes);
-	free(list);
+	if (lexer->end) *(lexer->end) = '\0';
+	lexer->end = NULL;
+	lexer->done = 1;
+	return 0;
 }
 
 /**
- * Scans a buffer, removing unnecessary characters and grouping characters into
- * lexemes.  Lexemes are strings of characters separated by whitespace (although
- * newline characters are considered separate lexemes).  String literals are
- * handled a bit differently:  Starting at the first quotation character,
- * characters are collected until either a non-escaped quotation character is
- * read (i.e., a quotation character not preceded by a colon which itself is not
- * preceded by a colon) or a newline or carriage return character is read,
- * whichever comes first.  This handles the odd (but possible) case of strings
- * such as "::" which print out a single colon.  Also handled are the effects of
- * commas, ellipses, bangs (!), and array accesses ('Z).
+ * Scans the next lexeme from a buffer, removing unnecessary characters and
+ * grouping characters into lexemes.  Lexemes are strings of characters
+ * separated by whitespace (although newline characters are considered
+ * separate lexemes).  String literals are handled a bit differently:  Starting
+ * at the first quotation character, characters are collected until either a
+ * non-escaped quotation character is read (i.e., a quotation character not
+ * preceded by a colon which itself is not preceded by a colon) or a newline or
+ * carriage return character is read, whichever comes first.  This handles the
+ * odd (but possible) case of strings such as "::" which print out a single
+ * colon.  Also handled are the effects of commas, ellipses, bangs (!), and
+ * array accesses ('Z).  Once the end of the buffer is reached, a single
+ * end-of-file lexeme ($) is produced.
  *
- * \param [in] buffer The characters to turn into lexemes.
+ * \param [in,out] lexer The lexer to scan with.
  *
- * \param [in] size The number of characters in \a buffer.
+ * \param [out] lex The lexeme scanned.
  *
- * \param [in] fname The name of the file \a buffer was read from.
+ * \post \a lex will refer to the buffer being scanned, which must not be
+ * freed until it and any tokens created from it are deleted.  Its image is
+ * only null-terminated once the following lexeme has been scanned.
+ *
+ * \retval 0 There are no more lexemes or an error occurred.
  *
- * \return A list of lexemes created from the contents of \a buffer.
+ * \retval 1 A lexeme was scanned into \a lex.
  */
-LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
+int scanLexeme(Lexer *lexer,
+               Lexeme *lex)
 {
-	const char *start = buffer;
-	LexemeList *list = NULL;
-	unsigned int line = 1;
-	list = createLexemeList();
-	if (!list) return NULL;
-	while (start < buffer + size) {
-		char *temp = NULL;
+	const char *start = lexer->start;
+	const char *buffer = lexer->buffer;
+	const char *fname = lexer->fname;
+	if (lexer->done) return 0;
+	while (start < buffer + lexer->size) {
 		unsigned int len = 1;
-		/* Comma (,) is a soft newline */
-		if (*start == ',') {
-			Lexeme *lex = createLexeme("\n", fname, line);
-			if (!lex) {
-				deleteLexemeList(list);
-				return NULL;
+		/* Unless whitespace after a newline is still being skipped, */
+		if (!lexer->spacing) {
+			/* Comma (,) is a soft newline */
+			if (*start == ',') {
+				lexer->start = start + 1;
+				return storeLexeme(lexer, lex, "\n", 1, lexer->line);
 			}
-			if (!addLexeme(list, lex)) {
-				deleteLexeme(lex);
-				deleteLexemeList(list);
-				return NULL;
-			}
-			start++;
-			continue;
-		}
-		/* Bang (!) is its own lexeme */
-		if (*start == '!') {
-			Lexeme *lex = createLexeme("!", fname, line);
-			if (!lex) {
-				deleteLexemeList(list);
-				return NULL;
-			}
-			if (!addLexeme(list, lex)) {
-				deleteLexeme(lex);
-				deleteLexemeList(list);
-				return NULL;
-			}
-			start++;
-			continue;
-		}
-		/* Apostrophe Z ('Z) is its own lexeme */
-		if (!strncmp(start, "'Z", 2)) {
-			Lexeme *lex = createLexeme("'Z", fname, line);
-			if (!lex) {
-				deleteLexemeList(list);
-				return NULL;
+			/* Bang (!) is its own lexeme */
+			if (*start == '!') {
+				lexer->start = start + 1;
+				return storeLexeme(lexer, lex, "!", 1, lexer->line);
 			}
-			if (!addLexeme(list, lex)) {
-				deleteLexeme(lex);
-				deleteLexemeList(list);
-				return NULL;
+			/* Apostrophe Z ('Z) is its own lexeme */
+			if (!strncmp(start, "'Z", 2)) {
+				lexer->start = start + 2;
+				return storeLexeme(lexer, lex, "'Z", 2, lexer->line);
 			}
-			start += 2;
-			continue;
 		}
+		lexer->spacing = 0;
 		/* Skip over leading whitespace */
 		while (isspace(*start)) {
 			unsigned int newline = 0;
@@ -209,21 +157,13 @@ LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
 			else if (*start == '\r' || *start == '\n') {
 				newline = 1;
 			}
+			start++;
 			if (newline) {
-				Lexeme *lex = createLexeme("\n", fname, line);
-				if (!lex) {
-					deleteLexemeList(list);
-					return NULL;
-				}
-				if (!addLexeme(list, lex)) {
-					deleteLexeme(lex);
-					deleteLexemeList(list);
-					return NULL;
-				}
-				line++;
+				lexer->start = start;
+				lexer->spacing = 1;
+				storeLexeme(lexer, lex, "\n", 1, lexer->line++);
+				return 1;
 			}
-			start++;
-			continue;
 		}
 		/* Skip over ellipses (...) and newline */
 		if ((!strncmp(start, "\xE2\x80\xA6\r\n", 5) && (start += 5))
@@ -236,24 +176,21 @@ LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
 			/* Make sure next line is not empty */
 			while (*test && isspace(*test)) {
 				if (*test == '\r' || *test == '\n') {
-					error(LX_LINE_CONTINUATION, fname, line);
-					deleteLexemeList(list);
-					return NULL;
+					error(LX_LINE_CONTINUATION, fname, lexer->line);
+					return stopLexer(lexer);
 				}
 				test++;
 			}
 			continue;
 		}
 		/* Skip over comments */
-		if ((list->num == 0
-				|| *(list->lexemes[list->num - 1]->image) == '\n')
-				&& !strncmp(start, "OBTW", 4)) {
+		if (lexer->linestart && !strncmp(start, "OBTW", 4)) {
 			start += 4;
 			while (strncmp(start, "TLDR", 4)) {
 				if ((!strncmp(start, "\r\n", 2) && (start += 2))
 						|| (*start == '\r' && start++)
 						|| (*start == '\n' && start++))
-					line++;
+					lexer->line++;
 				else
 					start++;
 			}
@@ -263,9 +200,8 @@ LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
 				start++;
 			if (start == buffer || *start == ',' || *start == '\r' || *start == '\n')
 				continue;
-			error(LX_MULTIPLE_LINE_COMMENT, fname, line);
-			deleteLexemeList(list);
-			return NULL;
+			error(LX_MULTIPLE_LINE_COMMENT, fname, lexer->line);
+			return stopLexer(lexer);
 		}
 		if (!strncmp(start, "BTW", 3)) {
 			start += 3;
@@ -295,9 +231,8 @@ LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
 					&& strncmp(start + len, "'Z", 2)
 					&& strncmp(start + len, "...", 3)
 					&& strncmp(start + len, "\xE2\x80\xA6", 3)) {
-				error(LX_EXPECTED_TOKEN_DELIMITER, fname, line);
-				deleteLexemeList(list);
-				return NULL;
+				error(LX_EXPECTED_TOKEN_DELIMITER, fname, lexer->line);
+				return stopLexer(lexer);
 			}
 		}
 		else {
@@ -310,39 +245,21 @@ LexemeList *scanBuffer(const char *buffer, unsigned int size, const char *fname)
 					&& strncmp(start + len, "\xE2\x80\xA6", 3))
 				len++;
 		}
-		temp = malloc(sizeof(char) * (len + 1));
-		if (!temp) {
-			perror("malloc");
-			deleteLexemeList(list);
-			return NULL;
-		}
-		strncpy(temp, start, len);
-		temp[len] = '\0';
-		Lexeme *lex = createLexeme(temp, fname, line);
-		if (!lex) {
-			free(temp);
-			deleteLexemeList(list);
-			return NULL;
-		}
-		if (!addLexeme(list, lex)) {
-			free(temp);
-			deleteLexeme(lex);
-			deleteLexemeList(list);
-			return NULL;
+		/*
+		 * An ellipsis which does not end a line directly follows the
+		 * previous lexeme, leaving no room to terminate it.  Such a
+		 * lexeme can never form a token, so report it here.
+		 */
+		if (start == lexer->end) {
+			lexer->buffer[start - buffer + len] = '\0';
+			error(TK_UNKNOWN_TOKEN, fname, lexer->line, start);
+			return stopLexer(lexer);
 		}
-		free(temp);
-		start += len;
+		lexer->start = start + len;
+		return storeLexeme(lexer, lex, start, len, lexer->line);
 	}
 	/* Create an end-of-file lexeme */
-	Lexeme *lex = createLexeme("$", fname, line);
-	if (!lex) {
-		deleteLexemeList(list);
-		return NULL;
-	}
-	if (!addLexeme(list, lex)) {
-		deleteLexeme(lex);
-		deleteLexemeList(list);
-		return NULL;
-	}
-	return list;
+	lexer->start = start;
+	lexer->done = 1;
+	return storeLexeme(lexer, lex, "$", 1, lexer->line);
 }
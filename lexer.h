@@ -27,33 +27,32 @@
 /**
  * Stores a lexeme.  A lexeme is a group of contiguous characters, stripped of
  * surrounding whitespace or other lexemes.
+ *
+ * \note Lexemes refer to the characters of the buffer they were scanned from
+ * instead of copying them, so the buffer must outlive them.
  */
 typedef struct {
-	char *image;       /**< The string that identifies the lexeme. */
-	const char *fname; /**< The name of the file containing the lexeme. */
-	unsigned int line; /**< The line number the lexeme occurred on. */
+	const char *image;   /**< The string that identifies the lexeme. */
+	unsigned int length; /**< The number of characters in \a image. */
+	const char *fname;   /**< The name of the file containing the lexeme. */
+	unsigned int line;   /**< The line number the lexeme occurred on. */
 } Lexeme;
 
 /**
- * Stores a list of lexemes.
+ * Stores the state of a lexer scanning a character buffer.  Lexemes are
+ * produced one at a time, as they are requested, instead of all at once.
  */
 typedef struct {
-	unsigned int num; /**< The number of lexemes stored. */
-	Lexeme **lexemes; /**< The array of stored lexemes. */
-} LexemeList;
-
-/**
- * \name Lexeme modifiers
- *
- * Functions for performing helper tasks.
- */
-/**@{*/
-Lexeme *createLexeme(char *, const char *, unsigned int);
-void deleteLexeme(Lexeme *);
-LexemeList *createLexemeList(void);
-Lexeme *addLexeme(LexemeList *, Lexeme*);
-void deleteLexemeList(LexemeList *);
-/**@}*/
+	char *buffer;       /**< The characters being scanned. */
+	unsigned int size;  /**< The number of characters in \a buffer. */
+	const char *start;  /**< The position of the next character to scan. */
+	const char *fname;  /**< The name of the file \a buffer was read from. */
+	unsigned int line;  /**< The line number of the next character to scan. */
+	int linestart;      /**< Whether the previous lexeme ended a line. */
+	int spacing;        /**< Whether whitespace was being skipped. */
+	char *end;          /**< The end of the previous lexeme if it is in \a buffer. */
+	int done;           /**< Whether the end-of-file lexeme has been produced. */
+} Lexer;
 
 /**
  * \name Buffer lexer
@@ -61,7 +60,8 @@ void deleteLexemeList(LexemeList *);
  * Generates lexemes from a character buffer.
  */
 /**@{*/
-LexemeList *scanBuffer(const char *, unsigned int, const char *);
+void initLexer(Lexer *, char *, unsigned int, const char *);
+int scanLexeme(Lexer *, Lexeme *);
 /**@}*/
 
 #endif /* __LEXER_H__ */
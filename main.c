@@ -61,16 +61,44 @@
  *   and floats) for later use.
  *
  *   - \b parser (parser.c, parser.h) - The parser takes the output of the
- *   tokenizer and analyzes it semantically to turn it into a parse tree.
+ *   tokenizer and analyzes it semantically to turn it into a parse tree.  The
+ *   lexer, tokenizer, and parser run together in a single pass:  the parser
+ *   requests tokens as it needs them, which are generated from only as many
+ *   lexemes as are needed, and releases them once each statement is parsed.
+ *
+ *   - \b cache (cache.c, cache.h) - The cache saves the output of the parser
+ *   to a file and loads it back when the same source is run again with the
+ *   \c --cache option, skipping the lexer, tokenizer, and parser.
+ *
+ *   - \b optimizer (optimizer.c, optimizer.h) - The optimizer takes the
+ *   output of the parser and folds expressions made up only of constants into
+ *   the constants they evaluate to, removing the arms of conditional
+ *   statements which can never be executed, and marks the expressions within
+ *   loops whose values cannot change while the loop executes so that they are
+ *   evaluated only once.  It is controlled with the \c -O option.
+ *
+ *   - \b resolver (resolver.c, resolver.h) - The resolver takes the output of
+ *   the parser and annotates its identifiers with the positions of the
+ *   variables they refer to so they can be looked up without comparing names.
  *
  *   - \b interpreter (interpreter.c, interpreter.h) - The interpreter takes the
  *   output of the parser and executes it.
  *
+ *   - \b vm (vm.c, vm.h) - The virtual machine compiles the output of the
+ *   parser to bytecode and executes it.  It is selected with the
+ *   \c --engine=vm option and shares the interpreter's value, scope, and
+ *   casting functions, with the interpreter remaining the reference engine.
+ *
  * Each of these modules is contained within its own C header and source code
- * files of the same name.
+ * files of the same name.  Together they are built as a library, liblci, whose
+ * interface for embedding the interpreter in other programs is declared in
+ * lci.h and implemented in lci.c.
  *
  * To handle the conversion of Unicode code points and normative names to bytes,
- * two additional files, unicode.c and unicode.h are used.
+ * two additional files, unicode.c and unicode.h are used.  Similarly, the values,
+ * scopes, and return objects created during execution are allocated from pools
+ * kept by memory.c and memory.h, and the counts made by the interpreter with
+ * the \c --profile option are kept and reported by profiler.c and profiler.h.
  * 
  * Finally, main.c ties all of these modules together and handles the initial
  * loading of input data for the lexer.
@@ -110,20 +138,81 @@
 #include <stdlib.h>
 #include <getopt.h>
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "lexer.h"
 #include "tokenizer.h"
 #include "parser.h"
+#include "optimizer.h"
+#include "resolver.h"
 #include "interpreter.h"
+#include "vm.h"
+#include "cache.h"
+#include "profiler.h"
+#include "stats.h"
 #include "error.h"
 
-#define READSIZE 512
+#define READSIZE 4096
+
+/**
+ * Defined when files may be run on separate threads with the \c -j option.
+ * Otherwise, the option is accepted but files are run one after another.
+ */
+#if defined(HAVE_PTHREAD) && !defined(NO_THREAD_LOCAL)
+#define PARALLEL_JOBS
+#endif
 
 static char *program_name;
 
-static char *shortopt = "hv";
+/**
+ * Represents an engine for executing parse trees.
+ */
+typedef enum {
+	ENGINE_TREE, /**< The tree-walking interpreter. */
+	ENGINE_VM    /**< The bytecode virtual machine. */
+} Engine;
+
+/**
+ * Stores the options files are run with.
+ */
+typedef struct {
+	Engine engine;   /**< The engine to execute parse trees with. */
+	int cache;       /**< Whether to reuse cached parse trees. */
+	int compileonly; /**< Whether to only save parse trees to the cache. */
+	int level;       /**< The optimization level. */
+	char *cachedir;  /**< The directory to save parse trees in (or NULL). */
+	FILE *profile;   /**< The file to write the call stacks of profiles to (or NULL to not profile). */
+} Options;
+
+#ifdef PARALLEL_JOBS
+/**
+ * Guards the file profiles are written to, which is shared by every job.
+ */
+static pthread_mutex_t ProfileLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static char *shortopt = "hvO:j:";
 static struct option longopt[] = {
 	{ "help", no_argument, NULL, (int)'h' },
 	{ "version", no_argument, NULL, (int)'v' },
+	{ "engine", required_argument, NULL, (int)'e' },
+	{ "pool-stats", no_argument, NULL, (int)'p' },
+	{ "stats", no_argument, NULL, (int)'s' },
+	{ "flush", required_argument, NULL, (int)'f' },
+	{ "cache", no_argument, NULL, (int)'C' },
+	{ "cache-dir", required_argument, NULL, (int)'D' },
+	{ "compile-only", no_argument, NULL, (int)'c' },
+	{ "optimize", required_argument, NULL, (int)'O' },
+	{ "jobs", required_argument, NULL, (int)'j' },
+	{ "profile", required_argument, NULL, (int)'P' },
 	{ 0, 0, 0, 0 }
 };
 
@@ -132,28 +221,615 @@ static void help(void) {
 Usage: %s [FILE] ... \n\
 Interpret FILE(s) as LOLCODE. Let FILE be '-' for stdin.\n\
   -h, --help\t\toutput this help\n\
-  -v, --version\t\tprogram version\n", program_name);
+  -v, --version\t\tprogram version\n\
+      --engine=ENGINE\texecute with ENGINE: tree (default) or vm\n\
+      --pool-stats\tprint memory pool statistics on exit\n\
+      --stats\t\tprint interpreter statistics on exit (when built\n\
+\t\t\twith COLLECT_STATS)\n\
+      --flush=POLICY\tflush output by line, when full, or on exit\n\
+\t\t\t(line, full, or exit)\n\
+      --cache\t\treuse parse trees saved in " CACHE_DIRECTORY "\n\
+      --cache-dir=DIR\treuse parse trees saved in DIR\n\
+      --compile-only\tsave parse trees to the cache without running\n\
+  -O, --optimize=LEVEL\tfold constants and prune unreachable branches at\n\
+\t\t\t1, also evaluate loop invariants once at 2 (the\n\
+\t\t\tdefault), or do neither at 0\n\
+  -j, --jobs=N\t\trun FILEs on N threads, printing the output of\n\
+\t\t\teach in order once it finishes\n\
+      --profile=FILE\tinterpret with the tree engine, reporting the time\n\
+\t\t\tspent on each line and function and writing the\n\
+\t\t\tcollapsed call stacks to FILE\n", program_name);
 }
 
 static void version (char *revision) {
 	fprintf(stderr, "%s %s\n", program_name, revision);
 }
 
-int main(int argc, char **argv)
+/**
+ * Stores the contents of a source file.
+ */
+typedef struct {
+	char *data;    /**< The contents, followed by a null character. */
+	size_t length; /**< The number of characters in the contents. */
+	size_t mapped; /**< The size of the mapping holding \a data (0 if allocated). */
+} Source;
+
+/**
+ * Reads the contents of a file.  Regular files are mapped into memory where
+ * possible, which avoids copying them; other files are read into a buffer which
+ * grows geometrically.
+ *
+ * \param [in] file The file to read.
+ *
+ * \param [out] src The contents of \a file.
+ *
+ * \note Mapped files are mapped privately and may be modified without changing
+ * the file.
+ *
+ * \retval 0 \a file could not be read.
+ *
+ * \retval 1 \a src holds the contents of \a file.
+ */
+static int readSource(FILE *file, Source *src)
+{
+	size_t size = 0;
+	src->data = NULL;
+	src->length = 0;
+	src->mapped = 0;
+#ifdef HAVE_MMAP
+	{
+		struct stat st;
+		long page = sysconf(_SC_PAGESIZE);
+		/*
+		 * The remainder of the last page of a mapping is zero-filled,
+		 * providing the null character following the contents, so only
+		 * files which do not end on a page boundary are mapped.
+		 */
+		if (!fstat(fileno(file), &st) && S_ISREG(st.st_mode)
+				&& st.st_size > 0 && page > 0
+				&& st.st_size % page != 0) {
+			void *mem = mmap(NULL, (size_t)st.st_size,
+					PROT_READ | PROT_WRITE, MAP_PRIVATE,
+					fileno(file), 0);
+			if (mem != MAP_FAILED) {
+				src->data = mem;
+				src->length = (size_t)st.st_size;
+				src->mapped = (size_t)st.st_size;
+				return 1;
+			}
+		}
+	}
+#endif
+	while (!feof(file)) {
+		void *mem = NULL;
+		if (src->length + 1 >= size) {
+			size = size ? size * 2 : READSIZE;
+			mem = realloc(src->data, sizeof(char) * size);
+			if (!mem) {
+				perror("realloc");
+				free(src->data);
+				src->data = NULL;
+				return 0;
+			}
+			src->data = mem;
+		}
+		src->length += fread(src->data + src->length,
+				1,
+				size - src->length - 1,
+				file);
+		if (ferror(file)) {
+			free(src->data);
+			src->data = NULL;
+			return 0;
+		}
+	}
+	src->data[src->length] = '\0';
+	return 1;
+}
+
+/**
+ * Deletes the contents of a file.
+ *
+ * \param [in,out] src The contents to delete.
+ *
+ * \post The memory holding the contents of \a src will be freed or unmapped.
+ */
+static void deleteSource(Source *src)
+{
+#ifdef HAVE_MMAP
+	if (src->mapped) {
+		munmap(src->data, src->mapped);
+		src->data = NULL;
+		return;
+	}
+#endif
+	free(src->data);
+	src->data = NULL;
+}
+
+/**
+ * Gets the exit status of a file which failed to run.
+ *
+ * \return The exit code of the first error reported while running the file,
+ * or 1 if none was reported (such as when memory could not be allocated).
+ */
+static int getFailureStatus(void)
 {
-	unsigned int size = 0;
-	unsigned int length = 0;
+	int status = getErrorCode();
+	return status ? status : 1;
+}
+
+/**
+ * Interprets a parse tree while profiling it.  A flat report of the profile
+ * is written to the error file of the current thread and its call stacks are
+ * appended to \a stacks, even if an error stops the program.
+ *
+ * \param [in] node The parse tree to interpret.
+ *
+ * \param [in] fname The name of the file \a node was parsed from.
+ *
+ * \param [in,out] stacks The file to write the collapsed call stacks to.
+ *
+ * \retval 0 \a node was interpreted without any errors.
+ *
+ * \retval 1 An error occurred while interpreting \a node.
+ */
+static int profileMainNode(MainNode *node,
+                           const char *fname,
+                           FILE *stacks)
+{
+	Profile *profile = createProfile(fname);
+	int status;
+	if (!profile) return 1;
+	setProfile(profile);
+	status = interpretMainNode(node);
+	setProfile(NULL);
+	fflush(getOutputFile());
+	printProfile(profile, getErrorFile());
+#ifdef PARALLEL_JOBS
+	pthread_mutex_lock(&ProfileLock);
+#endif
+	printProfileStacks(profile, stacks);
+	fflush(stacks);
+#ifdef PARALLEL_JOBS
+	pthread_mutex_unlock(&ProfileLock);
+#endif
+	deleteProfile(profile);
+	return status;
+}
+
+/**
+ * Runs a file through the whole pipeline: it is loaded from the cache or
+ * lexed, tokenized, and parsed, then optimized, resolved, and executed.
+ * Output is written to the files set for the current thread with
+ * setOutputFile() and setErrorFile().
+ *
+ * \param [in] path The path of the file to run ("-" for standard input).
+ *
+ * \param [in] opt The options to run the file with.
+ *
+ * \retval 0 The file was run successfully.
+ *
+ * \return The exit status of the error which stopped the file from running.
+ */
+static int runFile(const char *path, const Options *opt)
+{
+	Source src;
 	char *buffer = NULL;
-	LexemeList *lexemes = NULL;
-	Token **tokens = NULL;
+	TokenStream *stream = NULL;
 	MainNode *node = NULL;
-	char *fname = NULL;
+	Program *prog = NULL;
+	char *cachepath = NULL;
+	unsigned long long hash = 0;
+	const char *fname = NULL;
 	FILE *file = NULL;
+
+	clearErrorCode();
+
+	if (!strncmp(path, "-\0", 2)) {
+		file = stdin;
+		fname = "stdin";
+	}
+	else {
+		file = fopen(path, "r");
+		fname = path;
+	}
+
+	if (!file) {
+		error(MN_ERROR_OPENING_FILE, path);
+		return getFailureStatus();
+	}
+
+	if (!readSource(file, &src)) {
+		fclose(file);
+		return getFailureStatus();
+	}
+
+	if (fclose(file) != 0) {
+		error(MN_ERROR_CLOSING_FILE, path);
+		deleteSource(&src);
+		return getFailureStatus();
+	}
+	buffer = src.data;
+
+	/* Parse trees read from stdin are never cached */
+	if (opt->cache && strcmp(fname, "stdin")) {
+		hash = hashSource(buffer, src.length);
+		if (!(cachepath = getCachePath(fname, opt->cachedir)))
+			goto runFileAbort;
+	}
+
+	/* Remove hash bang line if run as a standalone script */
+	if (buffer[0] == '#' && buffer[1] == '!') {
+		unsigned int n;
+		for (n = 0; buffer[n] != '\n' && buffer[n] != '\r'; n++)
+			buffer[n] = ' ';
+	}
+
+	/*
+	 * Remove UTF-8 BOM if present and add it to the output stream
+	 * (we assume here that if a BOM is present, the system will
+	 * also expect the output to include a BOM).
+	 */
+	if (buffer[0] == (char)0xef
+			|| buffer[1] == (char)0xbb
+			|| buffer[2] == (char)0xbf) {
+		buffer[0] = ' ';
+		buffer[1] = ' ';
+		buffer[2] = ' ';
+		fprintf(getOutputFile(), "%c%c%c", 0xef, 0xbb, 0xbf);
+	}
+
+	/* Begin main pipeline */
+	if (cachepath && !opt->compileonly)
+		node = loadMainNode(cachepath, hash, src.length, fname);
+	if (!node) {
+		if (!(stream = createTokenStream(buffer, (unsigned int)src.length, fname)))
+			goto runFileAbort;
+		node = parseMainNode(stream);
+		/* Tokens refer to the source, so it may only be freed after them */
+		deleteTokenStream(stream);
+		if (!node) goto runFileAbort;
+		/* A cache which cannot be written is only an error when asked for */
+		if (cachepath && !saveMainNode(cachepath, node, hash, src.length)
+				&& opt->compileonly) {
+			error(MN_ERROR_WRITING_CACHE, cachepath);
+			goto runFileAbort;
+		}
+	}
+	free(cachepath);
+	cachepath = NULL;
+	deleteSource(&src);
+	if (opt->compileonly) {
+		deleteMainNode(node);
+		return 0;
+	}
+	if (optimizeMainNode(node, opt->level)
+			|| resolveMainNode(node)) {
+		deleteMainNode(node);
+		return getFailureStatus();
+	}
+	if (opt->profile) {
+		if (profileMainNode(node, fname, opt->profile)) {
+			deleteMainNode(node);
+			return getFailureStatus();
+		}
+	}
+	else if (opt->engine == ENGINE_VM) {
+		if (!(prog = compileMainNode(node))
+				|| executeProgram(prog)) {
+			deleteProgram(prog);
+			deleteMainNode(node);
+			return getFailureStatus();
+		}
+		deleteProgram(prog);
+	}
+	else if (interpretMainNode(node)) {
+		deleteMainNode(node);
+		return getFailureStatus();
+	}
+	deleteMainNode(node);
+	/* End main pipeline */
+
+	return 0;
+
+runFileAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	if (node) deleteMainNode(node);
+	if (cachepath) free(cachepath);
+	deleteSource(&src);
+	return getFailureStatus();
+}
+
+/**
+ * Stores the output a file writes while it runs so it may be printed later.
+ */
+typedef struct {
+	FILE *file;    /**< The file the output is written to. */
+#ifdef HAVE_OPEN_MEMSTREAM
+	char *data;    /**< The output written to \a file. */
+	size_t length; /**< The number of characters in \a data. */
+#endif
+} Capture;
+
+/**
+ * Starts capturing output.  Output is kept in memory where possible and in a
+ * temporary file otherwise.
+ *
+ * \param [out] capture The capture to start.
+ *
+ * \retval 0 The output could not be captured.
+ *
+ * \retval 1 Output written to the file of \a capture will be captured.
+ */
+static int openCapture(Capture *capture)
+{
+#ifdef HAVE_OPEN_MEMSTREAM
+	capture->data = NULL;
+	capture->length = 0;
+	capture->file = open_memstream(&capture->data, &capture->length);
+#else
+	capture->file = tmpfile();
+#endif
+	if (!capture->file) {
+#ifdef HAVE_OPEN_MEMSTREAM
+		perror("open_memstream");
+#else
+		perror("tmpfile");
+#endif
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Stops capturing output and writes what was captured to a file.
+ *
+ * \param [in,out] capture The capture to stop.
+ *
+ * \param [in] file The file to write the captured output to.
+ *
+ * \post The file of \a capture will be closed.
+ */
+static void closeCapture(Capture *capture, FILE *file)
+{
+	if (!capture->file) return;
+#ifdef HAVE_OPEN_MEMSTREAM
+	fclose(capture->file);
+	fwrite(capture->data, 1, capture->length, file);
+	free(capture->data);
+	capture->data = NULL;
+#else
+	{
+		char buf[READSIZE];
+		size_t num;
+		rewind(capture->file);
+		while ((num = fread(buf, 1, sizeof(buf), capture->file)) > 0)
+			fwrite(buf, 1, num, file);
+		fclose(capture->file);
+	}
+#endif
+	capture->file = NULL;
+}
+
+/**
+ * Stores a file to be run by a worker thread.
+ */
+typedef struct {
+	const char *path; /**< The path of the file to run. */
+	Capture out;      /**< The output the file writes. */
+	Capture err;      /**< The errors the file reports. */
+	int status;       /**< The exit status of the file. */
+	int done;         /**< Whether the file has finished running. */
+} Job;
+
+/**
+ * Stores the files to be run by a pool of worker threads.  Workers take files
+ * in order and the main thread prints the output of each in the same order.
+ */
+typedef struct {
+	Job *jobs;            /**< The files to run. */
+	unsigned int num;     /**< The number of files in \a jobs. */
+	unsigned int next;    /**< The next file to be taken by a worker. */
+	const Options *opt;   /**< The options to run the files with. */
+	int poolstats;        /**< Whether to print memory pool statistics. */
+	int stats;            /**< Whether to print interpreter statistics. */
+#ifdef PARALLEL_JOBS
+	pthread_mutex_t lock; /**< Guards \a next and the \a done of each job. */
+	pthread_cond_t done;  /**< Signalled when a file finishes running. */
+#endif
+} JobQueue;
+
+/**
+ * Locks a queue of files.
+ *
+ * \param [in,out] queue The queue to lock.
+ */
+static void lockJobQueue(JobQueue *queue)
+{
+#ifdef PARALLEL_JOBS
+	pthread_mutex_lock(&queue->lock);
+#else
+	(void)queue;
+#endif
+}
+
+/**
+ * Unlocks a queue of files.
+ *
+ * \param [in,out] queue The queue to unlock.
+ */
+static void unlockJobQueue(JobQueue *queue)
+{
+#ifdef PARALLEL_JOBS
+	pthread_mutex_unlock(&queue->lock);
+#else
+	(void)queue;
+#endif
+}
+
+/**
+ * Runs files from a queue until none are left.  This is the body of each
+ * worker thread.  Later files run by a worker reuse the objects freed to its
+ * memory pools by earlier ones; the memory of every pool is freed by the main
+ * thread once all of the workers have finished.
+ *
+ * \param [in,out] arg The queue of files to run.
+ *
+ * \return NULL.
+ */
+static void *runJobQueue(void *arg)
+{
+	JobQueue *queue = arg;
+	for (;;) {
+		Job *job = NULL;
+		lockJobQueue(queue);
+		if (queue->next < queue->num)
+			job = &queue->jobs[queue->next++];
+		unlockJobQueue(queue);
+		if (!job) break;
+
+		if (openCapture(&job->out) && openCapture(&job->err)) {
+			setOutputFile(job->out.file);
+			setErrorFile(job->err.file);
+			job->status = runFile(job->path, queue->opt);
+			setOutputFile(NULL);
+			setErrorFile(NULL);
+		}
+		else job->status = 1;
+
+		lockJobQueue(queue);
+		job->done = 1;
+#ifdef PARALLEL_JOBS
+		pthread_cond_broadcast(&queue->done);
+#endif
+		unlockJobQueue(queue);
+	}
+	if (queue->poolstats || queue->stats) {
+		lockJobQueue(queue);
+		if (queue->poolstats) printMemoryPools(stderr);
+		if (queue->stats) printStats(stderr);
+		unlockJobQueue(queue);
+	}
+	/* Share the objects this worker freed before it exits */
+	releaseMemoryPools();
+	return NULL;
+}
+
+/**
+ * Runs files on a pool of worker threads, printing the output and errors of
+ * each file in the order the files are given as soon as it and every file
+ * before it have finished.  A file which fails does not stop the others.
+ *
+ * \param [in] paths The paths of the files to run.
+ *
+ * \param [in] num The number of paths in \a paths.
+ *
+ * \param [in] threads The number of worker threads to use.
+ *
+ * \param [in] opt The options to run the files with.
+ *
+ * \param [in] poolstats Whether to print memory pool statistics.
+ *
+ * \param [in] stats Whether to print interpreter statistics.
+ *
+ * \retval 0 Every file was run successfully.
+ *
+ * \return The exit status of the first file which failed.
+ */
+static int runJobs(char **paths,
+                   unsigned int num,
+                   unsigned int threads,
+                   const Options *opt,
+                   int poolstats,
+                   int stats)
+{
+	JobQueue queue;
+	int status = 0;
+	unsigned int n;
+#ifdef PARALLEL_JOBS
+	pthread_t *workers = NULL;
+	unsigned int started = 0;
+#endif
+	if (num == 0) return 0;
+	queue.jobs = malloc(sizeof(Job) * num);
+	if (!queue.jobs) {
+		perror("malloc");
+		return 1;
+	}
+	for (n = 0; n < num; n++) {
+		queue.jobs[n].path = paths[n];
+		queue.jobs[n].out.file = NULL;
+		queue.jobs[n].err.file = NULL;
+		queue.jobs[n].status = 0;
+		queue.jobs[n].done = 0;
+	}
+	queue.num = num;
+	queue.next = 0;
+	queue.opt = opt;
+	queue.poolstats = poolstats;
+	queue.stats = stats;
+#ifdef PARALLEL_JOBS
+	if (threads > num) threads = num;
+	pthread_mutex_init(&queue.lock, NULL);
+	pthread_cond_init(&queue.done, NULL);
+	workers = malloc(sizeof(pthread_t) * threads);
+	if (workers) {
+		for (started = 0; started < threads; started++)
+			if (pthread_create(&workers[started], NULL, runJobQueue, &queue))
+				break;
+	}
+	/* Run the files on this thread if no workers could be started */
+	if (started == 0) runJobQueue(&queue);
+#else
+	(void)threads;
+	runJobQueue(&queue);
+#endif
+	for (n = 0; n < num; n++) {
+		Job *job = &queue.jobs[n];
+		lockJobQueue(&queue);
+#ifdef PARALLEL_JOBS
+		while (!job->done)
+			pthread_cond_wait(&queue.done, &queue.lock);
+#endif
+		unlockJobQueue(&queue);
+		closeCapture(&job->out, stdout);
+		fflush(stdout);
+		closeCapture(&job->err, stderr);
+		if (job->status && !status) status = job->status;
+	}
+#ifdef PARALLEL_JOBS
+	for (n = 0; n < started; n++)
+		pthread_join(workers[n], NULL);
+	free(workers);
+	pthread_cond_destroy(&queue.done);
+	pthread_mutex_destroy(&queue.lock);
+#endif
+	free(queue.jobs);
+	return status;
+}
+
+int main(int argc, char **argv)
+{
+	Options opt;
+	int poolstats = 0;
+	int stats = 0;
+	int status = 0;
+	long jobs = 0;
+	char *end = NULL;
 	int ch;
 
 	char *revision = "v0.10.5";
 	program_name = argv[0];
 
+	opt.engine = ENGINE_TREE;
+	opt.cache = 0;
+	opt.compileonly = 0;
+	opt.level = OPTIMIZE_DEFAULT;
+	opt.cachedir = NULL;
+	opt.profile = NULL;
+
 	while ((ch = getopt_long(argc, argv, shortopt, longopt, NULL)) != -1) {
 		switch (ch) {
 			default:
@@ -165,93 +841,99 @@ int main(int argc, char **argv)
 			case 'v':
 				version(revision);
 				exit(EXIT_SUCCESS);
+			case 'e':
+				if (!strcmp(optarg, "tree"))
+					opt.engine = ENGINE_TREE;
+				else if (!strcmp(optarg, "vm"))
+					opt.engine = ENGINE_VM;
+				else {
+					help();
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'p':
+				poolstats = 1;
+				break;
+			case 's':
+				stats = 1;
+				break;
+			case 'f':
+				if (!strcmp(optarg, "line"))
+					status = setFlushPolicy(FP_LINE);
+				else if (!strcmp(optarg, "full"))
+					status = setFlushPolicy(FP_FULL);
+				else if (!strcmp(optarg, "exit"))
+					status = setFlushPolicy(FP_EXIT);
+				else {
+					help();
+					exit(EXIT_FAILURE);
+				}
+				if (!status) {
+					perror("setvbuf");
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'C':
+				opt.cache = 1;
+				break;
+			case 'D':
+				opt.cache = 1;
+				opt.cachedir = optarg;
+				break;
+			case 'c':
+				opt.cache = 1;
+				opt.compileonly = 1;
+				break;
+			case 'O':
+				if (optarg[0] < '0' || optarg[0] > '9' || optarg[1]) {
+					help();
+					exit(EXIT_FAILURE);
+				}
+				opt.level = optarg[0] - '0';
+				break;
+			case 'j':
+				jobs = strtol(optarg, &end, 10);
+				if (end == optarg || *end || jobs < 1 || jobs > 1024) {
+					help();
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'P':
+				if (opt.profile) fclose(opt.profile);
+				if (!(opt.profile = fopen(optarg, "w"))) {
+					error(MN_ERROR_OPENING_FILE, optarg);
+					exit(getFailureStatus());
+				}
+				break;
 		}
 	}
 
-	for (; optind < argc; optind++) {
-		size = length = 0;
-		buffer = fname = NULL;
-		lexemes = NULL;
-		tokens = NULL;
-		node = NULL;
-		file = NULL;
-
-		if (!strncmp(argv[optind],"-\0",2)) {
-			file = stdin;
-			fname = "stdin";
-		}
-		else {
-			file = fopen(argv[optind], "r");
-			fname = argv[optind];
-		}
-
-		if (!file) {
-			error(MN_ERROR_OPENING_FILE, argv[optind]);
-			return 1;
-		}
-
-		while (!feof(file)) {
-			size += READSIZE;
-			buffer = realloc(buffer, sizeof(char) * size);
-			length += fread((buffer + size) - READSIZE,
-					1,
-					READSIZE,
-					file);
-		}
-
-		if (fclose(file) != 0) {
-			error(MN_ERROR_CLOSING_FILE, argv[optind]);
-			if (buffer) free(buffer);
-			return 1;
-		}
-		if (!buffer) return 1;
-		buffer[length] = '\0';
-
-		/* Remove hash bang line if run as a standalone script */
-		if (buffer[0] == '#' && buffer[1] == '!') {
-			unsigned int n;
-			for (n = 0; buffer[n] != '\n' && buffer[n] != '\r'; n++)
-				buffer[n] = ' ';
-		}
-
-		/*
-		 * Remove UTF-8 BOM if present and add it to the output stream
-		 * (we assume here that if a BOM is present, the system will
-		 * also expect the output to include a BOM).
-		 */
-		if (buffer[0] == (char)0xef
-				|| buffer[1] == (char)0xbb
-				|| buffer[2] == (char)0xbf) {
-			buffer[0] = ' ';
-			buffer[1] = ' ';
-			buffer[2] = ' ';
-			printf("%c%c%c", 0xef, 0xbb, 0xbf);
-		}
+	if (jobs > 0) {
+		status = runJobs(argv + optind,
+				(unsigned int)(argc - optind),
+				(unsigned int)jobs,
+				&opt,
+				poolstats,
+				stats);
+		deleteMemoryPools();
+		deleteInternTable();
+		if (opt.profile) fclose(opt.profile);
+		return status;
+	}
 
-		/* Begin main pipeline */
-		if (!(lexemes = scanBuffer(buffer, length, fname))) {
-			free(buffer);
-			return 1;
-		}
-		free(buffer);
-		if (!(tokens = tokenizeLexemes(lexemes))) {
-			deleteLexemeList(lexemes);
-			return 1;
-		}
-		deleteLexemeList(lexemes);
-		if (!(node = parseMainNode(tokens))) {
-			deleteTokens(tokens);
-			return 1;
-		}
-		deleteTokens(tokens);
-		if (interpretMainNode(node)) {
-			deleteMainNode(node);
-			return 1;
+	for (; optind < argc; optind++) {
+		if ((status = runFile(argv[optind], &opt))) {
+			if (opt.profile) fclose(opt.profile);
+			return status;
 		}
-		deleteMainNode(node);
-		/* End main pipeline */
-
 	}
 
+	if (poolstats || stats) fflush(stdout);
+	if (poolstats) printMemoryPools(stderr);
+	if (stats) printStats(stderr);
+	deleteMemoryPools();
+	deleteInternTable();
+	if (opt.profile) fclose(opt.profile);
+
 	return 0;
 }
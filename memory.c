@@ -0,0 +1,403 @@
+#include "memory.h"
+#include "stats.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/**
+ * Stores the header of a slab, aligned for any object stored after it.
+ */
+typedef union slab {
+	union slab *next; /**< The next slab allocated. */
+	long long i;      /**< Aligns the slab for integers. */
+	double d;         /**< Aligns the slab for decimals. */
+	void *p;          /**< Aligns the slab for pointers. */
+} Slab;
+
+/**
+ * The list of pools which have been used by this thread.
+ */
+static THREAD_LOCAL MemoryPool *pools = NULL;
+
+/**
+ * Stores the free objects of a size returned by threads which are done with
+ * their pools.
+ */
+typedef struct sparelist {
+	size_t size;            /**< The size of each object. */
+	void *free;             /**< The list of free objects. */
+	struct sparelist *next; /**< The next list of free objects. */
+} SpareList;
+
+/**
+ * The list of slabs allocated by every thread.  Slabs are shared by every
+ * thread, since an object allocated by one thread may be freed by another onto
+ * the free list of its own pool, and are only freed by deleteMemoryPools().
+ */
+static Slab *slabs = NULL;
+
+/**
+ * The free objects returned by releaseMemoryPools(), which any thread may take
+ * before allocating another slab.
+ */
+static SpareList *spares = NULL;
+
+/**
+ * The number of threads whose pools hold free objects in \a slabs.
+ */
+static unsigned int holders = 0;
+
+#ifdef HAVE_PTHREAD
+/**
+ * Guards \a slabs, \a spares, and \a holders.
+ */
+static pthread_mutex_t SlabsLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Locks the list of slabs.
+ */
+static void lockSlabs(void)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&SlabsLock);
+#endif
+}
+
+/**
+ * Unlocks the list of slabs.
+ */
+static void unlockSlabs(void)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&SlabsLock);
+#endif
+}
+
+/**
+ * Adds a pool to the list of pools the first time it is used.
+ *
+ * \param [in,out] pool The pool to add.
+ */
+static void registerMemoryPool(MemoryPool *pool)
+{
+	MemoryPool **tail = &pools;
+	if (pool->registered) return;
+	if (!pools) {
+		lockSlabs();
+		holders++;
+		unlockSlabs();
+	}
+	while (*tail) tail = &(*tail)->next;
+	*tail = pool;
+	pool->next = NULL;
+	pool->registered = 1;
+}
+
+/**
+ * Allocates an object from a pool.
+ *
+ * \param [in,out] pool The pool to allocate from.
+ *
+ * \return An uninitialized object of the size of \a pool.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+void *allocatePoolObject(MemoryPool *pool)
+{
+	void *p = NULL;
+	registerMemoryPool(pool);
+	pool->requests++;
+#ifdef NO_MEMORY_POOLS
+	p = malloc(pool->size);
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	pool->mallocs++;
+#else
+	if (!pool->free) {
+		/* Take the objects other threads are done with first */
+		SpareList *spare = NULL;
+		lockSlabs();
+		for (spare = spares; spare; spare = spare->next) {
+			if (spare->size == pool->size && spare->free) {
+				pool->free = spare->free;
+				spare->free = NULL;
+				break;
+			}
+		}
+		unlockSlabs();
+	}
+	if (!pool->free) {
+		/* Round objects up to keep each of them aligned */
+		size_t size = (pool->size + sizeof(Slab) - 1) / sizeof(Slab) * sizeof(Slab);
+		Slab *slab = malloc(sizeof(Slab) + size * POOL_SLAB_OBJECTS);
+		char *obj = NULL;
+		unsigned int n;
+		if (!slab) {
+			perror("malloc");
+			return NULL;
+		}
+		pool->mallocs++;
+		lockSlabs();
+		slab->next = slabs;
+		slabs = slab;
+		unlockSlabs();
+		/* Thread the new objects onto the free list */
+		obj = (char *)(slab + 1);
+		for (n = 0; n < POOL_SLAB_OBJECTS; n++, obj += size) {
+			*(void **)obj = pool->free;
+			pool->free = obj;
+		}
+	}
+	p = pool->free;
+	pool->free = *(void **)p;
+#endif
+	STAT_ALLOCATE(pool->size);
+	return p;
+}
+
+/**
+ * Returns an object to a pool.
+ *
+ * \param [in,out] pool The pool \a object was allocated from.
+ *
+ * \param [in] object The object to free.
+ *
+ * \post \a object may be handed out again by allocatePoolObject().
+ */
+void freePoolObject(MemoryPool *pool,
+                    void *object)
+{
+	if (!object) return;
+	STAT_FREE(pool->size);
+#ifdef NO_MEMORY_POOLS
+	(void)pool;
+	free(object);
+#else
+	*(void **)object = pool->free;
+	pool->free = object;
+#endif
+}
+
+/**
+ * Counts an object of a pool which was shared instead of being allocated.
+ *
+ * \param [in,out] pool The pool the object would have been allocated from.
+ */
+void countAvoidedAllocation(MemoryPool *pool)
+{
+	registerMemoryPool(pool);
+	pool->requests++;
+}
+
+/**
+ * Prints the number of objects requested from each pool and how many of them
+ * did not need a call to malloc.
+ *
+ * \param [in] file The file to print to.
+ */
+void printMemoryPools(FILE *file)
+{
+	MemoryPool *pool = NULL;
+	unsigned long requests = 0;
+	unsigned long mallocs = 0;
+	fprintf(file, "%-10s %12s %12s %12s\n", "pool", "requested", "malloc'd", "avoided");
+	for (pool = pools; pool; pool = pool->next) {
+		fprintf(file, "%-10s %12lu %12lu %12lu\n",
+				pool->name,
+				pool->requests,
+				pool->mallocs,
+				pool->requests - pool->mallocs);
+		requests += pool->requests;
+		mallocs += pool->mallocs;
+	}
+	fprintf(file, "%-10s %12lu %12lu %12lu\n", "total", requests, mallocs, requests - mallocs);
+}
+
+/**
+ * Returns the free objects of the pools of this thread so that other threads
+ * may allocate them, such as before this thread exits.
+ *
+ * \post The pools of this thread will be empty and their statistics reset.
+ */
+void releaseMemoryPools(void)
+{
+	MemoryPool *pool = pools;
+	if (!pools) return;
+	lockSlabs();
+	while (pool) {
+		MemoryPool *next = pool->next;
+		SpareList *spare = NULL;
+		for (spare = spares; spare; spare = spare->next) {
+			if (spare->size == pool->size) break;
+		}
+		if (!spare && pool->free && (spare = malloc(sizeof(SpareList)))) {
+			spare->size = pool->size;
+			spare->free = NULL;
+			spare->next = spares;
+			spares = spare;
+		}
+		/* Objects which cannot be returned stay in their slabs until deleted */
+		if (spare && pool->free) {
+			void **tail = pool->free;
+			while (*tail) tail = *tail;
+			*tail = spare->free;
+			spare->free = pool->free;
+		}
+		pool->free = NULL;
+		pool->requests = 0;
+		pool->mallocs = 0;
+		pool->registered = 0;
+		pool->next = NULL;
+		pool = next;
+	}
+	pools = NULL;
+	holders--;
+	unlockSlabs();
+}
+
+/**
+ * Deletes the slabs of every pool of every thread once no thread holds any of
+ * their objects.  The pools of this thread are released first; while another
+ * thread has not released its pools with releaseMemoryPools(), the slabs are
+ * kept for it and deleted by a later call.
+ *
+ * \pre No object allocated from any pool is still in use.
+ *
+ * \post The pools of this thread will be empty and their statistics reset.
+ */
+void deleteMemoryPools(void)
+{
+	Slab *slab = NULL;
+	SpareList *spare = NULL;
+	releaseMemoryPools();
+	lockSlabs();
+	if (holders) {
+		unlockSlabs();
+		return;
+	}
+	slab = slabs;
+	while (slab) {
+		Slab *temp = slab->next;
+		free(slab);
+		slab = temp;
+	}
+	slabs = NULL;
+	spare = spares;
+	while (spare) {
+		SpareList *temp = spare->next;
+		free(spare);
+		spare = temp;
+	}
+	spares = NULL;
+	unlockSlabs();
+}
+
+/**
+ * Creates an arena.
+ *
+ * \return An empty arena.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+MemoryArena *createMemoryArena(void)
+{
+	MemoryArena *p = malloc(sizeof(MemoryArena));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->chunks = NULL;
+	p->next = NULL;
+	p->left = 0;
+	return p;
+}
+
+/**
+ * Allocates an object from an arena.
+ *
+ * \param [in,out] arena The arena to allocate from.
+ *
+ * \param [in] size The size of the object.
+ *
+ * \return An uninitialized object of \a size bytes which is freed along with
+ * \a arena.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+void *allocateArenaObject(MemoryArena *arena,
+                          size_t size)
+{
+	Slab *chunk = NULL;
+	void *p = NULL;
+	/* Round objects up to keep each of them aligned */
+	size = (size + sizeof(Slab) - 1) / sizeof(Slab) * sizeof(Slab);
+#ifdef NO_MEMORY_POOLS
+	chunk = malloc(sizeof(Slab) + size);
+	if (!chunk) {
+		perror("malloc");
+		return NULL;
+	}
+	chunk->next = arena->chunks;
+	arena->chunks = chunk;
+	p = chunk + 1;
+#else
+	if (size > arena->left) {
+		/* Give large objects a chunk of their own */
+		if (size > ARENA_CHUNK_SIZE / 4) {
+			chunk = malloc(sizeof(Slab) + size);
+			if (!chunk) {
+				perror("malloc");
+				return NULL;
+			}
+			/* Keep allocating from the newest chunk */
+			if (arena->chunks) {
+				chunk->next = ((Slab *)arena->chunks)->next;
+				((Slab *)arena->chunks)->next = chunk;
+			}
+			else {
+				chunk->next = NULL;
+				arena->chunks = chunk;
+			}
+			return chunk + 1;
+		}
+		chunk = malloc(sizeof(Slab) + ARENA_CHUNK_SIZE);
+		if (!chunk) {
+			perror("malloc");
+			return NULL;
+		}
+		chunk->next = arena->chunks;
+		arena->chunks = chunk;
+		arena->next = (char *)(chunk + 1);
+		arena->left = ARENA_CHUNK_SIZE;
+	}
+	p = arena->next;
+	arena->next += size;
+	arena->left -= size;
+#endif
+	return p;
+}
+
+/**
+ * Deletes an arena.
+ *
+ * \param [in,out] arena The arena to delete.
+ *
+ * \post The memory at \a arena and every object allocated from it will be
+ * freed.
+ */
+void deleteMemoryArena(MemoryArena *arena)
+{
+	Slab *chunk = NULL;
+	if (!arena) return;
+	chunk = arena->chunks;
+	while (chunk) {
+		Slab *temp = chunk->next;
+		free(chunk);
+		chunk = temp;
+	}
+	free(arena);
+}
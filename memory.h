@@ -0,0 +1,96 @@
+/**
+ * Structures and functions for pooling the allocation of small, fixed-size
+ * objects.  Objects are carved out of larger slabs and returned to a free list
+ * when they are deleted, so the frequent creation and deletion of values,
+ * scopes, and return objects during execution rarely reaches malloc.  Arenas
+ * similarly carve objects of any size out of larger chunks for structures,
+ * such as parse trees, whose parts are all freed at the same time.
+ *
+ * Each thread allocates from and frees to its own pools without locking, while
+ * the slabs themselves are shared, so an object may be freed by a different
+ * thread than the one which allocated it.  A thread which is done with its
+ * pools returns their free objects to be shared with releaseMemoryPools().
+ *
+ * Defining \c NO_MEMORY_POOLS passes every allocation directly to malloc and
+ * free, which is useful along with memory-checking tools.
+ *
+ * \file   memory.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __MEMORY_H__
+#define __MEMORY_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "error.h"
+
+/**
+ * The number of objects allocated at a time.
+ */
+#define POOL_SLAB_OBJECTS 64
+
+/**
+ * Stores a pool of objects of a single size.
+ */
+typedef struct memorypool {
+	const char *name;         /**< The name of the objects (for statistics). */
+	size_t size;              /**< The size of each object. */
+	void *free;               /**< The list of free objects. */
+	unsigned long requests;   /**< The number of objects requested. */
+	unsigned long mallocs;    /**< The number of calls made to malloc. */
+	int registered;           /**< Whether the pool is in the list of pools. */
+	struct memorypool *next;  /**< The next pool in the list of pools. */
+} MemoryPool;
+
+/**
+ * Initializes a pool of objects of a type.
+ */
+#define MEMORY_POOL(name, type) { name, sizeof(type), NULL, 0, 0, 0, NULL }
+
+/**
+ * The number of bytes of each chunk of an arena.
+ */
+#define ARENA_CHUNK_SIZE 65536
+
+/**
+ * Stores an arena of objects of any size which are all freed at once.  Objects
+ * are carved out of larger chunks one after another and are never freed
+ * individually.
+ */
+typedef struct {
+	void *chunks; /**< The list of allocated chunks, newest first. */
+	char *next;   /**< The next free byte of the newest chunk. */
+	size_t left;  /**< The number of free bytes left in the newest chunk. */
+} MemoryArena;
+
+/**
+ * \name Memory pool modifiers
+ *
+ * Functions for allocating and freeing pooled objects.
+ */
+/**@{*/
+void *allocatePoolObject(MemoryPool *);
+void freePoolObject(MemoryPool *, void *);
+void countAvoidedAllocation(MemoryPool *);
+void printMemoryPools(FILE *);
+void releaseMemoryPools(void);
+void deleteMemoryPools(void);
+/**@}*/
+
+/**
+ * \name Memory arena modifiers
+ *
+ * Functions for allocating objects from arenas and freeing them all at once.
+ */
+/**@{*/
+MemoryArena *createMemoryArena(void);
+void *allocateArenaObject(MemoryArena *, size_t);
+void deleteMemoryArena(MemoryArena *);
+/**@}*/
+
+#endif /* __MEMORY_H__ */
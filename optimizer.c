@@ -0,0 +1,1233 @@
+#include "optimizer.h"
+#include "intern.h"
+
+static int optimizeExprNode(Optimizer *, ExprNode *);
+static int optimizeStmtNodeList(Optimizer *, StmtNodeList *);
+
+/**
+ * Checks whether an expression is a constant which evaluates to the same
+ * value wherever it occurs.  Strings which interpolate variables or which
+ * could not be templated are not considered constant.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 \a node is not constant.
+ *
+ * \retval 1 \a node is constant.
+ */
+static int isConstantExprNode(ExprNode *node)
+{
+	ConstantNode *c = NULL;
+	unsigned int n;
+	if (node->type != ET_CONSTANT) return 0;
+	c = (ConstantNode *)node->expr;
+	switch (c->type) {
+		case CT_INTEGER:
+		case CT_FLOAT:
+		case CT_BOOLEAN:
+		case CT_NIL:
+			return 1;
+		case CT_STRING:
+			if (!c->tmpl) return 0;
+			for (n = 0; n < c->tmpl->num; n++) {
+				if (c->tmpl->segs[n].type != SG_TEXT) return 0;
+			}
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Checks whether an operation on constants can be evaluated without reporting
+ * an error.
+ *
+ * \param [in] expr The operation to check.
+ *
+ * \retval 0 \a expr may not be folded.
+ *
+ * \retval 1 \a expr may be folded.
+ */
+static int isFoldableOpExprNode(OpExprNode *expr)
+{
+	ConstantNode *divisor = NULL;
+	unsigned int n;
+	for (n = 0; n < expr->args->num; n++) {
+		if (!isConstantExprNode(expr->args->exprs[n])) return 0;
+	}
+	switch (expr->type) {
+		case OP_ADD:
+		case OP_SUB:
+		case OP_MULT:
+		case OP_MAX:
+		case OP_MIN:
+		case OP_DIV:
+		case OP_MOD:
+			/* Nil may not be implicitly cast to a number */
+			for (n = 0; n < expr->args->num; n++) {
+				ConstantNode *c = (ConstantNode *)expr->args->exprs[n]->expr;
+				if (c->type == CT_NIL) return 0;
+			}
+			if (expr->type != OP_DIV && expr->type != OP_MOD) return 1;
+			/*
+			 * Only divisors known to be non-zero are folded.  Integer
+			 * division by -1 may overflow, so it is left to execution
+			 * as well.
+			 */
+			divisor = (ConstantNode *)expr->args->exprs[1]->expr;
+			if (divisor->type == CT_INTEGER)
+				return divisor->data.i != 0 && divisor->data.i != -1;
+			if (divisor->type == CT_FLOAT)
+				return !(fabs(divisor->data.f - 0.0) < FLT_EPSILON);
+			return 0;
+		case OP_AND:
+		case OP_OR:
+		case OP_XOR:
+		case OP_NOT:
+		case OP_EQ:
+		case OP_NEQ:
+			return 1;
+		case OP_CAT:
+			/* Neither nil nor booleans may be implicitly cast to strings */
+			for (n = 0; n < expr->args->num; n++) {
+				ConstantNode *c = (ConstantNode *)expr->args->exprs[n]->expr;
+				if (c->type == CT_NIL || c->type == CT_BOOLEAN) return 0;
+			}
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Checks whether a cast of a constant can be evaluated without reporting an
+ * error and produces a value which can be stored as a constant.
+ *
+ * \param [in] expr The cast to check.
+ *
+ * \retval 0 \a expr may not be folded.
+ *
+ * \retval 1 \a expr may be folded.
+ */
+static int isFoldableCastExprNode(CastExprNode *expr)
+{
+	ConstantNode *c = NULL;
+	if (!isConstantExprNode(expr->target)) return 0;
+	c = (ConstantNode *)expr->target->expr;
+	switch (expr->newtype->type) {
+		case CT_BOOLEAN:
+		case CT_INTEGER:
+		case CT_FLOAT:
+			return 1;
+		case CT_STRING:
+			return c->type != CT_BOOLEAN;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Creates a constant holding a value.
+ *
+ * \param [in] val The value to hold.
+ *
+ * \param [out] c The constant holding \a val, or NULL if \a val cannot be
+ * stored as a constant.
+ *
+ * \note Strings containing colons are not stored as constants because, unlike
+ * string constants, strings produced during execution are decoded each time
+ * they are cast.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a c was set.
+ */
+static int createValueConstantNode(ValueObject *val, ConstantNode **c)
+{
+	char *data = NULL;
+	*c = NULL;
+	switch (getType(val)) {
+		case VT_BOOLEAN:
+			*c = createBooleanConstantNode(getInteger(val));
+			break;
+		case VT_INTEGER:
+			*c = createIntegerConstantNode(getInteger(val));
+			break;
+		case VT_FLOAT:
+			*c = createFloatConstantNode(getFloat(val));
+			break;
+		case VT_STRING:
+			if (memchr(getString(val), ':', getStringLength(val))) return 1;
+			data = internStringLength(getString(val), getStringLength(val));
+			if (!data) return 0;
+			*c = createStringConstantNode(data);
+			if (*c && !(*c)->tmpl) {
+				deleteConstantNode(*c);
+				return 0;
+			}
+			break;
+		default:
+			return 1;
+	}
+	return *c != NULL;
+}
+
+/**
+ * Folds an expression made up only of constants into the constant it
+ * evaluates to.
+ *
+ * \param [in,out] node The expression to fold.
+ *
+ * \pre \a node may be evaluated without reporting an error.
+ *
+ * \post If its value can be stored as a constant, \a node will be replaced
+ * by a constant.
+ *
+ * \retval 0 An error occurred while folding \a node.
+ *
+ * \retval 1 \a node was folded or left unchanged.
+ */
+static int foldExprNode(ExprNode *node)
+{
+	ConstantNode *c = NULL;
+	/* Constants do not refer to any scope */
+	ValueObject *val = interpretExprNode(node, NULL);
+	if (!val) return 0;
+	if (!createValueConstantNode(val, &c)) {
+		deleteValueObject(val);
+		return 0;
+	}
+	deleteValueObject(val);
+	if (!c) return 1;
+	if (node->type == ET_OP)
+		deleteOpExprNode((OpExprNode *)node->expr);
+	else
+		deleteCastExprNode((CastExprNode *)node->expr);
+	node->type = ET_CONSTANT;
+	node->expr = c;
+	return 1;
+}
+
+/**
+ * Optimizes the expressions within an identifier.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] id The identifier to optimize.
+ *
+ * \retval 0 An error occurred while optimizing \a id.
+ *
+ * \retval 1 \a id was optimized.
+ */
+static int optimizeIdentifierNode(Optimizer *o,
+                                  IdentifierNode *id)
+{
+	IdentifierNode *node = NULL;
+	for (node = id; node; node = node->slot) {
+		if (node->type == IT_INDIRECT
+				&& !optimizeExprNode(o, node->id))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Optimizes a list of expressions.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] list The expressions to optimize.
+ *
+ * \retval 0 An error occurred while optimizing \a list.
+ *
+ * \retval 1 \a list was optimized.
+ */
+static int optimizeExprNodeList(Optimizer *o,
+                                ExprNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!optimizeExprNode(o, list->exprs[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Optimizes an expression, folding any part of it made up only of constants.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] node The expression to optimize.
+ *
+ * \retval 0 An error occurred while optimizing \a node.
+ *
+ * \retval 1 \a node was optimized.
+ */
+static int optimizeExprNode(Optimizer *o,
+                            ExprNode *node)
+{
+	switch (node->type) {
+		case ET_CAST: {
+			CastExprNode *expr = (CastExprNode *)node->expr;
+			if (!optimizeExprNode(o, expr->target)) return 0;
+			if (isFoldableCastExprNode(expr)) return foldExprNode(node);
+			return 1;
+		}
+		case ET_IDENTIFIER:
+			return optimizeIdentifierNode(o, node->expr);
+		case ET_FUNCCALL: {
+			FuncCallExprNode *expr = (FuncCallExprNode *)node->expr;
+			if (!optimizeIdentifierNode(o, expr->scope)) return 0;
+			if (!optimizeIdentifierNode(o, expr->name)) return 0;
+			return optimizeExprNodeList(o, expr->args);
+		}
+		case ET_OP: {
+			OpExprNode *expr = (OpExprNode *)node->expr;
+			if (!optimizeExprNodeList(o, expr->args)) return 0;
+			if (isFoldableOpExprNode(expr)) return foldExprNode(node);
+			return 1;
+		}
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Optimizes a block of code.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] node The block of code to optimize.
+ *
+ * \retval 0 An error occurred while optimizing \a node.
+ *
+ * \retval 1 \a node was optimized.
+ */
+static int optimizeBlockNode(Optimizer *o,
+                             BlockNode *node)
+{
+	return optimizeStmtNodeList(o, node->stmts);
+}
+
+/**
+ * Optimizes a list of blocks of code.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] list The blocks of code to optimize.
+ *
+ * \retval 0 An error occurred while optimizing \a list.
+ *
+ * \retval 1 \a list was optimized.
+ */
+static int optimizeBlockNodeList(Optimizer *o,
+                                 BlockNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!optimizeBlockNode(o, list->blocks[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Removes a guard and its block of code from the lists of a conditional
+ * statement.
+ *
+ * \param [in,out] guards The guards to remove from.
+ *
+ * \param [in,out] blocks The blocks of code to remove from.
+ *
+ * \param [in] n The index of the guard to remove.
+ *
+ * \post The guard and block of code at index \a n will be deleted and the
+ * remaining ones moved down to take their places.
+ */
+static void removeGuard(ExprNodeList *guards,
+                        BlockNodeList *blocks,
+                        unsigned int n)
+{
+	deleteExprNode(guards->exprs[n]);
+	deleteBlockNode(blocks->blocks[n]);
+	memmove(guards->exprs + n, guards->exprs + n + 1,
+			sizeof(ExprNode *) * (guards->num - n - 1));
+	memmove(blocks->blocks + n, blocks->blocks + n + 1,
+			sizeof(BlockNode *) * (blocks->num - n - 1));
+	guards->num--;
+	blocks->num--;
+}
+
+/**
+ * Gets the truth value of a constant.
+ *
+ * \param [in] node The constant to get the truth value of.
+ *
+ * \param [out] truth The truth value of \a node.
+ *
+ * \pre isConstantExprNode() is true for \a node.
+ *
+ * \retval 0 An error occurred while evaluating \a node.
+ *
+ * \retval 1 \a truth was set successfully.
+ */
+static int getConstantTruth(ExprNode *node,
+                            int *truth)
+{
+	ValueObject *val = interpretExprNode(node, NULL);
+	int status;
+	if (!val) return 0;
+	status = getBooleanValue(val, NULL, truth);
+	deleteValueObject(val);
+	return status;
+}
+
+/**
+ * Removes the arms of an if/then/else statement which can never be executed.
+ *
+ * \param [in,out] stmt The statement to prune.
+ *
+ * \param [in] it The constant value of the \ref impvar "implicit variable"
+ * when \a stmt is executed, or NULL if it is not known.
+ *
+ * \param [out] empty Whether no arm of \a stmt can be executed.
+ *
+ * \retval 0 An error occurred while pruning \a stmt.
+ *
+ * \retval 1 \a stmt was pruned.
+ */
+static int pruneIfThenElseStmtNode(IfThenElseStmtNode *stmt,
+                                   ExprNode *it,
+                                   int *empty)
+{
+	unsigned int n;
+	int truth;
+	*empty = 0;
+	if (!it) return 1;
+	if (!getConstantTruth(it, &truth)) return 0;
+	if (truth) {
+		/* Only the first block can be executed */
+		while (stmt->guards->num > 0)
+			removeGuard(stmt->guards, stmt->blocks, stmt->guards->num - 1);
+		deleteBlockNode(stmt->no);
+		stmt->no = NULL;
+		return 1;
+	}
+	/* The first block is never executed but must still exist */
+	if (stmt->yes->stmts->num > 0) {
+		StmtNodeList *stmts = createStmtNodeList();
+		BlockNode *block = NULL;
+		if (!stmts) return 0;
+		if (!(block = createBlockNode(stmts))) {
+			deleteStmtNodeList(stmts);
+			return 0;
+		}
+		deleteBlockNode(stmt->yes);
+		stmt->yes = block;
+	}
+	for (n = 0; n < stmt->guards->num; ) {
+		if (!isConstantExprNode(stmt->guards->exprs[n])) {
+			n++;
+			continue;
+		}
+		if (!getConstantTruth(stmt->guards->exprs[n], &truth)) return 0;
+		if (!truth) {
+			removeGuard(stmt->guards, stmt->blocks, n);
+			continue;
+		}
+		/* Nothing after a guard which is always true is executed */
+		while (stmt->guards->num > n + 1)
+			removeGuard(stmt->guards, stmt->blocks, stmt->guards->num - 1);
+		deleteBlockNode(stmt->no);
+		stmt->no = NULL;
+		break;
+	}
+	*empty = (stmt->guards->num == 0 && !stmt->no);
+	return 1;
+}
+
+/**
+ * Checks whether the value of the \ref impvar "implicit variable" matches a
+ * switch statement guard, the same way the interpreter does.
+ *
+ * \param [in] it The value of the implicit variable.
+ *
+ * \param [in] guard The value of the guard.
+ *
+ * \retval 0 \a it does not match \a guard.
+ *
+ * \retval 1 \a it matches \a guard.
+ */
+static int isMatchingGuard(ValueObject *it,
+                           ValueObject *guard)
+{
+	if (getType(it) != getType(guard)) return 0;
+	switch (getType(it)) {
+		case VT_BOOLEAN:
+		case VT_INTEGER:
+			return getInteger(it) == getInteger(guard);
+		case VT_FLOAT:
+			return fabs(getFloat(it) - getFloat(guard)) < FLT_EPSILON;
+		case VT_STRING:
+			return isStringEqual(it, guard);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Removes the cases of a switch statement which can never be executed.
+ * Execution begins at the first guard the \ref impvar "implicit variable"
+ * matches, so any guards before it are removed; if no guard matches, only the
+ * default block remains.
+ *
+ * \param [in,out] stmt The statement to prune.
+ *
+ * \param [in] it The constant value of the implicit variable when \a stmt is
+ * executed, or NULL if it is not known.
+ *
+ * \param [out] empty Whether no block of \a stmt can be executed.
+ *
+ * \retval 0 An error occurred while pruning \a stmt.
+ *
+ * \retval 1 \a stmt was pruned.
+ */
+static int pruneSwitchStmtNode(SwitchStmtNode *stmt,
+                               ExprNode *it,
+                               int *empty)
+{
+	ValueObject *use1 = NULL;
+	unsigned int n;
+	*empty = 0;
+	if (!it) return 1;
+	for (n = 0; n < stmt->guards->num; n++) {
+		if (stmt->guards->exprs[n]->type != ET_CONSTANT) return 1;
+	}
+	if (!(use1 = interpretExprNode(it, NULL))) return 0;
+	for (n = 0; n < stmt->guards->num; n++) {
+		ValueObject *use2 = interpretExprNode(stmt->guards->exprs[n], NULL);
+		int done;
+		if (!use2) {
+			deleteValueObject(use1);
+			return 0;
+		}
+		done = isMatchingGuard(use1, use2);
+		deleteValueObject(use2);
+		if (done) break;
+	}
+	deleteValueObject(use1);
+	while (n > 0)
+		removeGuard(stmt->guards, stmt->blocks, --n);
+	/* The default block is only reached when no guard matches */
+	if (stmt->guards->num > 0) {
+		deleteBlockNode(stmt->def);
+		stmt->def = NULL;
+	}
+	*empty = (stmt->guards->num == 0 && !stmt->def);
+	/* The remaining guards have moved */
+	return indexSwitchStmtNode(stmt);
+}
+
+/**
+ * Adds a variable to the variables a loop may change.
+ *
+ * \param [in,out] fx The variables the loop may change.
+ *
+ * \param [in] id The variable which may change.  For an array slot, the array
+ * is the variable which changes.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a id was added to \a fx.
+ */
+static int addLoopEffect(LoopEffects *fx,
+                         IdentifierNode *id)
+{
+	IdentifierNode *node = NULL;
+	void *mem = NULL;
+	/* Computed names and the scope of the calling object may be anything */
+	for (node = id; node; node = node->slot) {
+		if (node->type != IT_DIRECT) {
+			fx->unknown = 1;
+			return 1;
+		}
+	}
+	if (!strcmp(id->id, "ME")) {
+		fx->unknown = 1;
+		return 1;
+	}
+	mem = realloc(fx->names, sizeof(char *) * (fx->num + 1));
+	if (!mem) {
+		perror("realloc");
+		return 0;
+	}
+	fx->names = mem;
+	fx->names[fx->num++] = id->id;
+	return 1;
+}
+
+/**
+ * Checks whether a loop may change a variable.
+ *
+ * \param [in] fx The variables the loop may change.
+ *
+ * \param [in] name The interned name of the variable to check.
+ *
+ * \retval 0 The loop does not change \a name.
+ *
+ * \retval 1 The loop may change \a name.
+ */
+static int isLoopEffect(LoopEffects *fx,
+                        char *name)
+{
+	unsigned int n;
+	for (n = 0; n < fx->num; n++) {
+		if (fx->names[n] == name) return 1;
+	}
+	return 0;
+}
+
+static void scanExprEffects(LoopEffects *, ExprNode *);
+
+/**
+ * Finds the effects of evaluating the names within an identifier read by a
+ * loop.
+ *
+ * \param [in,out] fx The variables the loop may change.
+ *
+ * \param [in] id The identifier to scan.
+ */
+static void scanIdentifierEffects(LoopEffects *fx,
+                                  IdentifierNode *id)
+{
+	for (; id; id = id->slot) {
+		if (id->type == IT_INDIRECT) scanExprEffects(fx, id->id);
+	}
+}
+
+/**
+ * Finds the effects of evaluating an expression within a loop.  Evaluating an
+ * expression only changes variables by calling a function.
+ *
+ * \param [in,out] fx The variables the loop may change.
+ *
+ * \param [in] node The expression to scan.
+ */
+static void scanExprEffects(LoopEffects *fx,
+                            ExprNode *node)
+{
+	OpExprNode *op = NULL;
+	unsigned int n;
+	switch (node->type) {
+		case ET_CAST:
+			scanExprEffects(fx, ((CastExprNode *)node->expr)->target);
+			break;
+		case ET_IDENTIFIER:
+			scanIdentifierEffects(fx, node->expr);
+			break;
+		case ET_FUNCCALL:
+			/* Functions may change any variable of their callers */
+			fx->unknown = 1;
+			break;
+		case ET_OP:
+			op = (OpExprNode *)node->expr;
+			for (n = 0; n < op->args->num; n++)
+				scanExprEffects(fx, op->args->exprs[n]);
+			break;
+		case ET_INVARIANT:
+			scanExprEffects(fx, ((InvariantExprNode *)node->expr)->expr);
+			break;
+		default:
+			break;
+	}
+}
+
+static int scanStmtNodeListEffects(LoopEffects *, StmtNodeList *);
+
+/**
+ * Finds the variables a statement within a loop may change.
+ *
+ * \param [in,out] fx The variables the loop may change.
+ *
+ * \param [in] node The statement to scan.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The effects of \a node were added to \a fx.
+ */
+static int scanStmtEffects(LoopEffects *fx,
+                           StmtNode *node)
+{
+	unsigned int n;
+	switch (node->type) {
+		case ST_CAST:
+			return addLoopEffect(fx, ((CastStmtNode *)node->stmt)->target);
+		case ST_PRINT: {
+			PrintStmtNode *stmt = (PrintStmtNode *)node->stmt;
+			for (n = 0; n < stmt->args->num; n++)
+				scanExprEffects(fx, stmt->args->exprs[n]);
+			return 1;
+		}
+		case ST_INPUT:
+			return addLoopEffect(fx, ((InputStmtNode *)node->stmt)->target);
+		case ST_ASSIGNMENT: {
+			AssignmentStmtNode *stmt = (AssignmentStmtNode *)node->stmt;
+			scanExprEffects(fx, stmt->expr);
+			return addLoopEffect(fx, stmt->target);
+		}
+		case ST_DECLARATION: {
+			DeclarationStmtNode *stmt = (DeclarationStmtNode *)node->stmt;
+			if (stmt->expr) scanExprEffects(fx, stmt->expr);
+			/* A declaration in an array changes the array */
+			if (stmt->parent) scanIdentifierEffects(fx, stmt->parent);
+			if (!addLoopEffect(fx, stmt->scope)) return 0;
+			return addLoopEffect(fx, stmt->target);
+		}
+		case ST_IFTHENELSE: {
+			IfThenElseStmtNode *stmt = (IfThenElseStmtNode *)node->stmt;
+			for (n = 0; n < stmt->guards->num; n++)
+				scanExprEffects(fx, stmt->guards->exprs[n]);
+			if (!scanStmtNodeListEffects(fx, stmt->yes->stmts)) return 0;
+			for (n = 0; n < stmt->blocks->num; n++) {
+				if (!scanStmtNodeListEffects(fx, stmt->blocks->blocks[n]->stmts))
+					return 0;
+			}
+			return !stmt->no || scanStmtNodeListEffects(fx, stmt->no->stmts);
+		}
+		case ST_SWITCH: {
+			SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+			for (n = 0; n < stmt->blocks->num; n++) {
+				if (!scanStmtNodeListEffects(fx, stmt->blocks->blocks[n]->stmts))
+					return 0;
+			}
+			return !stmt->def || scanStmtNodeListEffects(fx, stmt->def->stmts);
+		}
+		case ST_RETURN:
+			scanExprEffects(fx, ((ReturnStmtNode *)node->stmt)->value);
+			return 1;
+		case ST_LOOP: {
+			LoopStmtNode *stmt = (LoopStmtNode *)node->stmt;
+			if (stmt->var && !addLoopEffect(fx, stmt->var)) return 0;
+			if (stmt->guard) scanExprEffects(fx, stmt->guard);
+			if (stmt->update) scanExprEffects(fx, stmt->update);
+			return !stmt->body || scanStmtNodeListEffects(fx, stmt->body->stmts);
+		}
+		case ST_DEALLOCATION:
+			return addLoopEffect(fx, ((DeallocationStmtNode *)node->stmt)->target);
+		case ST_FUNCDEF: {
+			/* The body is not executed unless the function is called */
+			FuncDefStmtNode *stmt = (FuncDefStmtNode *)node->stmt;
+			if (!addLoopEffect(fx, stmt->scope)) return 0;
+			return addLoopEffect(fx, stmt->name);
+		}
+		case ST_EXPR:
+			scanExprEffects(fx, node->stmt);
+			return 1;
+		case ST_ALTARRAYDEF: {
+			/* The body is executed in the array, but may change any variable */
+			AltArrayDefStmtNode *stmt = (AltArrayDefStmtNode *)node->stmt;
+			if (stmt->parent) scanIdentifierEffects(fx, stmt->parent);
+			if (!addLoopEffect(fx, stmt->name)) return 0;
+			return scanStmtNodeListEffects(fx, stmt->body->stmts);
+		}
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Finds the variables a list of statements within a loop may change.
+ *
+ * \param [in,out] fx The variables the loop may change.
+ *
+ * \param [in] list The statements to scan.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The effects of \a list were added to \a fx.
+ */
+static int scanStmtNodeListEffects(LoopEffects *fx,
+                                   StmtNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!scanStmtEffects(fx, list->stmts[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Checks whether a variable may be read by a loop invariant.
+ *
+ * \param [in] fx The variables the loop may change.
+ *
+ * \param [in] id The variable to check.
+ *
+ * \retval 0 \a id may not be read by a loop invariant.
+ *
+ * \retval 1 \a id may be read by a loop invariant.
+ */
+static int isInvariantIdentifierNode(LoopEffects *fx,
+                                     IdentifierNode *id)
+{
+	if (id->type != IT_DIRECT || id->slot) return 0;
+	if (!strcmp(id->id, "I") || !strcmp(id->id, "ME")) return 0;
+	return !isLoopEffect(fx, id->id);
+}
+
+/**
+ * Checks whether the value of an expression within a loop cannot change while
+ * the loop executes.  Such an expression may only read variables the loop does
+ * not change.  Strings containing colons are not invariant, as their values
+ * are interpolated again whenever they are cast.
+ *
+ * \param [in] fx The variables the loop may change.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 The value of \a node may change.
+ *
+ * \retval 1 The value of \a node cannot change.
+ */
+static int isInvariantExprNode(LoopEffects *fx,
+                               ExprNode *node)
+{
+	ConstantNode *c = NULL;
+	OpExprNode *op = NULL;
+	unsigned int n;
+	switch (node->type) {
+		case ET_CAST:
+			return isInvariantExprNode(fx, ((CastExprNode *)node->expr)->target);
+		case ET_CONSTANT:
+			c = (ConstantNode *)node->expr;
+			if (c->type != CT_STRING) return 1;
+			if (!c->tmpl) return 0;
+			for (n = 0; n < c->tmpl->num; n++) {
+				TemplateSegment *seg = &c->tmpl->segs[n];
+				if (seg->type == SG_IMPVAR) return 0;
+				if (seg->type == SG_TEXT && memchr(seg->text, ':', seg->length))
+					return 0;
+				if (seg->type == SG_VARIABLE
+						&& !isInvariantIdentifierNode(fx, seg->id))
+					return 0;
+			}
+			return 1;
+		case ET_IDENTIFIER:
+			return isInvariantIdentifierNode(fx, node->expr);
+		case ET_OP:
+			op = (OpExprNode *)node->expr;
+			for (n = 0; n < op->args->num; n++) {
+				if (!isInvariantExprNode(fx, op->args->exprs[n])) return 0;
+			}
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Checks whether evaluating an invariant expression once per loop saves more
+ * than it costs, that is, whether it casts, concatenates, or performs more
+ * than one operation.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 \a node is cheaper to evaluate each time.
+ *
+ * \retval 1 \a node is cheaper to evaluate once.
+ */
+static int isCostlyExprNode(ExprNode *node)
+{
+	OpExprNode *op = NULL;
+	unsigned int n;
+	if (node->type == ET_CAST) return 1;
+	if (node->type != ET_OP) return 0;
+	op = (OpExprNode *)node->expr;
+	if (op->type == OP_CAT) return 1;
+	for (n = 0; n < op->args->num; n++) {
+		ExprType type = op->args->exprs[n]->type;
+		if (type == ET_CAST || type == ET_OP) return 1;
+	}
+	return 0;
+}
+
+/**
+ * Marks an expression as a loop invariant, adding a hidden variable to its
+ * loop to hold its value.
+ *
+ * \param [in,out] o The optimizer state.
+ *
+ * \param [in,out] stmt The loop \a node is invariant in.
+ *
+ * \param [in,out] node The expression to mark.
+ *
+ * \post \a node will be a loop invariant expression containing its previous
+ * contents.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a node was marked.
+ */
+static int markInvariantExprNode(Optimizer *o,
+                                 LoopStmtNode *stmt,
+                                 ExprNode *node)
+{
+	IdentifierNode *decl = NULL;
+	IdentifierNode *use = NULL;
+	InvariantExprNode *expr = NULL;
+	char name[32];
+	char *id = NULL;
+	/* Hidden names cannot be written in source code */
+	sprintf(name, "!invariant%u", ++o->invariants);
+	if (!(id = internString(name))) return 0;
+	decl = createIdentifierNode(IT_DIRECT, id, NULL, stmt->name->fname, stmt->name->line);
+	if (!decl) return 0;
+	if (!stmt->invariants && !(stmt->invariants = createIdentifierNodeList())) {
+		deleteIdentifierNode(decl);
+		return 0;
+	}
+	if (!addIdentifierNode(stmt->invariants, decl)) {
+		deleteIdentifierNode(decl);
+		return 0;
+	}
+	/* The resolver annotates the use and the declaration differently */
+	use = createIdentifierNode(IT_DIRECT, id, NULL, stmt->name->fname, stmt->name->line);
+	if (!use) return 0;
+	if (!(expr = createInvariantExprNode(NULL, use))) {
+		deleteIdentifierNode(use);
+		return 0;
+	}
+	if (!(expr->expr = createExprNode(node->type, node->expr))) {
+		deleteInvariantExprNode(expr);
+		return 0;
+	}
+	node->type = ET_INVARIANT;
+	node->expr = expr;
+	return 1;
+}
+
+/**
+ * Marks the largest invariant parts of an expression within a loop which are
+ * worth evaluating only once.
+ *
+ * \param [in,out] o The optimizer state.
+ *
+ * \param [in] fx The variables the loop may change.
+ *
+ * \param [in,out] stmt The loop \a node is in.
+ *
+ * \param [in,out] node The expression to mark the invariants of.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The invariants of \a node were marked.
+ */
+static int hoistExprNode(Optimizer *o,
+                         LoopEffects *fx,
+                         LoopStmtNode *stmt,
+                         ExprNode *node)
+{
+	OpExprNode *op = NULL;
+	unsigned int n;
+	if ((node->type == ET_CAST || node->type == ET_OP)
+			&& isInvariantExprNode(fx, node)) {
+		if (!isCostlyExprNode(node)) return 1;
+		return markInvariantExprNode(o, stmt, node);
+	}
+	switch (node->type) {
+		case ET_CAST:
+			return hoistExprNode(o, fx, stmt, ((CastExprNode *)node->expr)->target);
+		case ET_OP:
+			op = (OpExprNode *)node->expr;
+			for (n = 0; n < op->args->num; n++) {
+				if (!hoistExprNode(o, fx, stmt, op->args->exprs[n])) return 0;
+			}
+			return 1;
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Marks the invariants of the expressions within a list of statements in a
+ * loop.  Nested loops mark their own invariants, and the bodies of functions
+ * and arrays are left as they are.
+ *
+ * \param [in,out] o The optimizer state.
+ *
+ * \param [in] fx The variables the loop may change.
+ *
+ * \param [in,out] stmt The loop \a list is in.
+ *
+ * \param [in,out] list The statements to mark the invariants of.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The invariants of \a list were marked.
+ */
+static int hoistStmtNodeList(Optimizer *o,
+                             LoopEffects *fx,
+                             LoopStmtNode *stmt,
+                             StmtNodeList *list)
+{
+	unsigned int n, m;
+	for (n = 0; n < list->num; n++) {
+		StmtNode *node = list->stmts[n];
+		switch (node->type) {
+			case ST_PRINT: {
+				ExprNodeList *args = ((PrintStmtNode *)node->stmt)->args;
+				for (m = 0; m < args->num; m++) {
+					if (!hoistExprNode(o, fx, stmt, args->exprs[m])) return 0;
+				}
+				break;
+			}
+			case ST_ASSIGNMENT:
+				if (!hoistExprNode(o, fx, stmt, ((AssignmentStmtNode *)node->stmt)->expr))
+					return 0;
+				break;
+			case ST_DECLARATION: {
+				DeclarationStmtNode *decl = (DeclarationStmtNode *)node->stmt;
+				if (decl->expr && !hoistExprNode(o, fx, stmt, decl->expr))
+					return 0;
+				break;
+			}
+			case ST_IFTHENELSE: {
+				IfThenElseStmtNode *cond = (IfThenElseStmtNode *)node->stmt;
+				for (m = 0; m < cond->guards->num; m++) {
+					if (!hoistExprNode(o, fx, stmt, cond->guards->exprs[m]))
+						return 0;
+				}
+				if (!hoistStmtNodeList(o, fx, stmt, cond->yes->stmts)) return 0;
+				for (m = 0; m < cond->blocks->num; m++) {
+					if (!hoistStmtNodeList(o, fx, stmt, cond->blocks->blocks[m]->stmts))
+						return 0;
+				}
+				if (cond->no && !hoistStmtNodeList(o, fx, stmt, cond->no->stmts))
+					return 0;
+				break;
+			}
+			case ST_SWITCH: {
+				SwitchStmtNode *sw = (SwitchStmtNode *)node->stmt;
+				for (m = 0; m < sw->blocks->num; m++) {
+					if (!hoistStmtNodeList(o, fx, stmt, sw->blocks->blocks[m]->stmts))
+						return 0;
+				}
+				if (sw->def && !hoistStmtNodeList(o, fx, stmt, sw->def->stmts))
+					return 0;
+				break;
+			}
+			case ST_RETURN:
+				if (!hoistExprNode(o, fx, stmt, ((ReturnStmtNode *)node->stmt)->value))
+					return 0;
+				break;
+			case ST_EXPR:
+				if (!hoistExprNode(o, fx, stmt, node->stmt)) return 0;
+				break;
+			default:
+				break;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Marks the expressions within a loop whose values cannot change while the
+ * loop executes and which are worth evaluating only once.  Nothing is marked
+ * in a loop which calls a function or changes a variable whose name is
+ * computed, as either may change any variable.
+ *
+ * \param [in,out] o The optimizer state.
+ *
+ * \param [in,out] stmt The loop to mark the invariants of.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The invariants of \a stmt were marked.
+ */
+static int hoistLoopStmtNode(Optimizer *o,
+                             LoopStmtNode *stmt)
+{
+	LoopEffects fx;
+	int status = 1;
+	fx.names = NULL;
+	fx.num = 0;
+	fx.unknown = 0;
+	if (stmt->var && !addLoopEffect(&fx, stmt->var)) status = 0;
+	if (stmt->guard) scanExprEffects(&fx, stmt->guard);
+	if (stmt->update) scanExprEffects(&fx, stmt->update);
+	if (status && stmt->body && !scanStmtNodeListEffects(&fx, stmt->body->stmts))
+		status = 0;
+	if (status && !fx.unknown) {
+		if (stmt->guard && !hoistExprNode(o, &fx, stmt, stmt->guard))
+			status = 0;
+		else if (stmt->body && !hoistStmtNodeList(o, &fx, stmt, stmt->body->stmts))
+			status = 0;
+	}
+	free(fx.names);
+	return status;
+}
+
+/**
+ * Optimizes a statement.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] node The statement to optimize.
+ *
+ * \param [in] it The constant value of the \ref impvar "implicit variable"
+ * when \a node is executed, or NULL if it is not known.
+ *
+ * \param [out] empty Whether \a node has no effect and may be removed.
+ *
+ * \retval 0 An error occurred while optimizing \a node.
+ *
+ * \retval 1 \a node was optimized.
+ */
+static int optimizeStmtNode(Optimizer *o,
+                            StmtNode *node,
+                            ExprNode *it,
+                            int *empty)
+{
+	*empty = 0;
+	switch (node->type) {
+		case ST_CAST:
+			return optimizeIdentifierNode(o, ((CastStmtNode *)node->stmt)->target);
+		case ST_PRINT:
+			return optimizeExprNodeList(o, ((PrintStmtNode *)node->stmt)->args);
+		case ST_INPUT:
+			return optimizeIdentifierNode(o, ((InputStmtNode *)node->stmt)->target);
+		case ST_ASSIGNMENT: {
+			AssignmentStmtNode *stmt = (AssignmentStmtNode *)node->stmt;
+			if (!optimizeIdentifierNode(o, stmt->target)) return 0;
+			return optimizeExprNode(o, stmt->expr);
+		}
+		case ST_DECLARATION: {
+			DeclarationStmtNode *stmt = (DeclarationStmtNode *)node->stmt;
+			if (!optimizeIdentifierNode(o, stmt->scope)) return 0;
+			if (!optimizeIdentifierNode(o, stmt->target)) return 0;
+			if (stmt->expr && !optimizeExprNode(o, stmt->expr)) return 0;
+			if (stmt->parent && !optimizeIdentifierNode(o, stmt->parent)) return 0;
+			return 1;
+		}
+		case ST_IFTHENELSE: {
+			IfThenElseStmtNode *stmt = (IfThenElseStmtNode *)node->stmt;
+			if (!optimizeExprNodeList(o, stmt->guards)) return 0;
+			if (!pruneIfThenElseStmtNode(stmt, it, empty)) return 0;
+			if (!optimizeBlockNode(o, stmt->yes)) return 0;
+			if (!optimizeBlockNodeList(o, stmt->blocks)) return 0;
+			if (stmt->no && !optimizeBlockNode(o, stmt->no)) return 0;
+			return 1;
+		}
+		case ST_SWITCH: {
+			SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+			if (!pruneSwitchStmtNode(stmt, it, empty)) return 0;
+			if (!optimizeBlockNodeList(o, stmt->blocks)) return 0;
+			if (stmt->def && !optimizeBlockNode(o, stmt->def)) return 0;
+			return 1;
+		}
+		case ST_RETURN:
+			return optimizeExprNode(o, ((ReturnStmtNode *)node->stmt)->value);
+		case ST_LOOP: {
+			LoopStmtNode *stmt = (LoopStmtNode *)node->stmt;
+			if (stmt->guard && !optimizeExprNode(o, stmt->guard)) return 0;
+			if (stmt->update && !optimizeExprNode(o, stmt->update)) return 0;
+			if (stmt->body && !optimizeBlockNode(o, stmt->body)) return 0;
+			/* Nested loops are optimized first */
+			if (o->level >= 2) return hoistLoopStmtNode(o, stmt);
+			return 1;
+		}
+		case ST_DEALLOCATION:
+			return optimizeIdentifierNode(o, ((DeallocationStmtNode *)node->stmt)->target);
+		case ST_FUNCDEF: {
+			FuncDefStmtNode *stmt = (FuncDefStmtNode *)node->stmt;
+			if (!optimizeIdentifierNode(o, stmt->scope)) return 0;
+			if (!optimizeIdentifierNode(o, stmt->name)) return 0;
+			return optimizeBlockNode(o, stmt->body);
+		}
+		case ST_EXPR:
+			return optimizeExprNode(o, node->stmt);
+		case ST_ALTARRAYDEF: {
+			AltArrayDefStmtNode *stmt = (AltArrayDefStmtNode *)node->stmt;
+			if (stmt->parent && !optimizeIdentifierNode(o, stmt->parent)) return 0;
+			return optimizeBlockNode(o, stmt->body);
+		}
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Optimizes a list of statements.  The value of the \ref impvar "implicit
+ * variable" is known after an expression statement whose expression is
+ * constant, allowing the conditional statement following it to be pruned.
+ *
+ * \param [in] o The optimizer state.
+ *
+ * \param [in,out] list The statements to optimize.
+ *
+ * \post Any conditional statement which can have no effect will be removed
+ * from \a list.
+ *
+ * \retval 0 An error occurred while optimizing \a list.
+ *
+ * \retval 1 \a list was optimized.
+ */
+static int optimizeStmtNodeList(Optimizer *o,
+                                StmtNodeList *list)
+{
+	ExprNode *it = NULL;
+	unsigned int n;
+	for (n = 0; n < list->num; ) {
+		StmtNode *stmt = list->stmts[n];
+		int empty;
+		if (!optimizeStmtNode(o, stmt, it, &empty)) return 0;
+		if (empty) {
+			deleteStmtNode(stmt);
+			memmove(list->stmts + n, list->stmts + n + 1,
+					sizeof(StmtNode *) * (list->num - n - 1));
+			list->num--;
+			continue;
+		}
+		/* Any other statement may change the implicit variable */
+		if (stmt->type == ST_EXPR && isConstantExprNode(stmt->stmt))
+			it = stmt->stmt;
+		else
+			it = NULL;
+		n++;
+	}
+	return 1;
+}
+
+/**
+ * Optimizes a main block of code.  At level 0, nothing is done; at level 1
+ * and above, expressions made up only of constants are folded and arms of
+ * conditional statements which can never be executed are removed; at level 2
+ * and above, loop invariants are marked as well.
+ *
+ * \param [in,out] main The main block of code to optimize.
+ *
+ * \param [in] level The optimization level.
+ *
+ * \pre \a main contains a block of code created by parseMainNode().
+ *
+ * \post \a main will execute the same way it did before it was optimized.
+ *
+ * \retval 0 \a main was optimized without any errors.
+ *
+ * \retval 1 An error occurred while optimizing \a main.
+ */
+int optimizeMainNode(MainNode *main,
+                     int level)
+{
+	Optimizer o;
+	int status;
+	if (!main) return 1;
+	if (level < 1) return 0;
+	o.arena = main->arena;
+	o.level = level;
+	o.invariants = 0;
+	/* Nodes are replaced from the arena the parse tree was built in */
+	setNodeArena(o.arena);
+	status = optimizeBlockNode(&o, main->block);
+	setNodeArena(NULL);
+	return !status;
+}
@@ -0,0 +1,62 @@
+/**
+ * Structures and functions for optimizing a parse tree.  The optimizer folds
+ * expressions made up only of constants into the constants they evaluate to
+ * and removes the arms of conditional statements which can never be
+ * executed.  It also marks the expressions within loops whose values cannot
+ * change while the loop executes, so that they are evaluated only once each
+ * time the loop executes.  This stage runs after parsing and before resolving.
+ *
+ * Expressions are folded by evaluating them with the interpreter itself, so a
+ * folded expression has exactly the value it would have during execution.
+ * Expressions whose evaluation would report an error, such as a division by
+ * zero, are left in place to report it only if they are executed.  Likewise,
+ * loop invariants are evaluated where they occur, the first time they are
+ * reached, rather than before the loop begins.
+ *
+ * \file   optimizer.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __OPTIMIZER_H__
+#define __OPTIMIZER_H__
+
+#include "parser.h"
+#include "interpreter.h"
+#include "memory.h"
+
+/**
+ * The optimization level used unless another is requested.
+ */
+#define OPTIMIZE_DEFAULT 2
+
+/**
+ * Stores the state of the optimizer while it traverses a parse tree.
+ */
+typedef struct {
+	MemoryArena *arena;      /**< The arena the parse tree is allocated from. */
+	int level;               /**< The optimization level. */
+	unsigned int invariants; /**< The number of loop invariants marked so far, used to name their hidden variables. */
+} Optimizer;
+
+/**
+ * Stores the variables a loop may change while it executes.
+ */
+typedef struct {
+	char **names;     /**< The interned names of the variables the loop may change. */
+	unsigned int num; /**< The number of names in \a names. */
+	int unknown;      /**< Whether the loop may change variables which cannot be named before execution, such as by calling a function. */
+} LoopEffects;
+
+/**
+ * \name Optimizers
+ *
+ * Functions for simplifying parse trees.
+ */
+/**@{*/
+int optimizeMainNode(MainNode *, int);
+/**@}*/
+
+#endif /* __OPTIMIZER_H__ */
@@ -1,7 +1,9 @@
 #include "parser.h"
+#include "unicode.h"
+#include "intern.h"
 
 #ifdef DEBUG
-static unsigned int shiftwidth = 0;
+static THREAD_LOCAL unsigned int shiftwidth = 0;
 void shiftout(void) { shiftwidth += 4; }
 void shiftin(void) { shiftwidth -= 4; }
 void debug(const char *info)
@@ -13,6 +15,93 @@ void debug(const char *info)
 }
 #endif
 
+/**
+ * The arena parse tree nodes are allocated from while a program is parsed.
+ * Outside of parsing, nodes are allocated with malloc.
+ */
+static THREAD_LOCAL MemoryArena *NodeArena = NULL;
+
+/**
+ * The smallest number of elements the arrays of parse tree lists have space
+ * for.  This must be a power of two.
+ */
+#define NODE_ARRAY_MIN 4
+
+/**
+ * Sets the arena parse tree nodes are allocated from.  This allows parse trees
+ * to be built outside of the parser in the same way the parser builds them.
+ *
+ * \param [in] arena The arena to allocate nodes from (NULL to use malloc).
+ */
+void setNodeArena(MemoryArena *arena)
+{
+	NodeArena = arena;
+}
+
+/**
+ * Allocates memory for part of a parse tree.
+ *
+ * \param [in] size The number of bytes to allocate.
+ *
+ * \return A pointer to \a size bytes of uninitialized memory.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static void *allocateNode(size_t size)
+{
+	if (NodeArena) return allocateArenaObject(NodeArena, size);
+	return malloc(size);
+}
+
+/**
+ * Frees memory allocated for part of a parse tree.
+ *
+ * \param [in] p The memory to free.
+ *
+ * \note Memory allocated while parsing is only freed once the arena it was
+ * allocated from is deleted.
+ */
+static void freeNode(void *p)
+{
+	if (!NodeArena) free(p);
+}
+
+/**
+ * Makes space for another element at the end of an array of a parse tree
+ * list.  Arrays double in size when they are full so that adding an element
+ * takes constant time on average.
+ *
+ * \param [in,out] array The array to add space to.
+ *
+ * \param [in] num The number of elements in \a array.
+ *
+ * \param [in] width The size of each element of \a array.
+ *
+ * \return A pointer to an array with space for more than \a num elements
+ * whose first \a num elements are those of \a array.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static void *growNodeArray(void *array,
+                           unsigned int num,
+                           size_t width)
+{
+	unsigned int max;
+	void *mem = NULL;
+	/* Arrays are full when they hold a power of two elements */
+	if (num != 0 && (num < NODE_ARRAY_MIN || (num & (num - 1))))
+		return array;
+	max = num ? num * 2 : NODE_ARRAY_MIN;
+	if (NodeArena) {
+		mem = allocateArenaObject(NodeArena, width * max);
+		if (mem && num) memcpy(mem, array, width * num);
+		return mem;
+	}
+	mem = realloc(array, width * max);
+	if (!mem) perror("realloc");
+	return mem;
+}
+
 /**
  * Creates the main code block of a program.
  *
@@ -24,12 +113,13 @@ void debug(const char *info)
  */
 MainNode *createMainNode(BlockNode *block)
 {
-	MainNode *p = malloc(sizeof(MainNode));
+	MainNode *p = allocateNode(sizeof(MainNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->block = block;
+	p->arena = NULL;
 	return p;
 }
 
@@ -38,13 +128,19 @@ MainNode *createMainNode(BlockNode *block)
  *
  * \param [in,out] node The main code block to delete.
  *
- * \post The memory at \a node and all of its members will be freed.
+ * \post The memory at \a node and all of its members will be freed.  If
+ * \a node was allocated from an arena, the arena is freed in one step instead
+ * of visiting each of its members.
  */
 void deleteMainNode(MainNode *node)
 {
 	if (!node) return;
+	if (node->arena) {
+		deleteMemoryArena(node->arena);
+		return;
+	}
 	deleteBlockNode(node->block);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -58,7 +154,7 @@ void deleteMainNode(MainNode *node)
  */
 BlockNode *createBlockNode(StmtNodeList *stmts)
 {
-	BlockNode *p = malloc(sizeof(BlockNode));
+	BlockNode *p = allocateNode(sizeof(BlockNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -78,7 +174,7 @@ void deleteBlockNode(BlockNode *node)
 {
 	if (!node) return;
 	deleteStmtNodeList(node->stmts);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -90,7 +186,7 @@ void deleteBlockNode(BlockNode *node)
  */
 BlockNodeList *createBlockNodeList(void)
 {
-	BlockNodeList *p = malloc(sizeof(BlockNodeList));
+	BlockNodeList *p = allocateNode(sizeof(BlockNodeList));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -117,11 +213,8 @@ int addBlockNode(BlockNodeList *list,
                  BlockNode *node)
 {
 	unsigned int newsize = list->num + 1;
-	void *mem = realloc(list->blocks, sizeof(BlockNode *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return 0;
-	}
+	void *mem = growNodeArray(list->blocks, list->num, sizeof(BlockNode *));
+	if (!mem) return 0;
 	list->blocks = mem;
 	list->blocks[list->num] = node;
 	list->num = newsize;
@@ -141,8 +234,8 @@ void deleteBlockNodeList(BlockNodeList *list)
 	if (!list) return;
 	for (n = 0; n < list->num; n++)
 		deleteBlockNode(list->blocks[n]);
-	free(list->blocks);
-	free(list);
+	freeNode(list->blocks);
+	freeNode(list);
 }
 
 /**
@@ -157,13 +250,14 @@ void deleteBlockNodeList(BlockNodeList *list)
  */
 ConstantNode *createBooleanConstantNode(int data)
 {
-	ConstantNode *p = malloc(sizeof(ConstantNode));
+	ConstantNode *p = allocateNode(sizeof(ConstantNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->type = CT_BOOLEAN;
 	p->data.i = (data != 0);
+	p->tmpl = NULL;
 	return p;
 }
 
@@ -178,13 +272,14 @@ ConstantNode *createBooleanConstantNode(int data)
  */
 ConstantNode *createIntegerConstantNode(long long data)
 {
-	ConstantNode *p = malloc(sizeof(ConstantNode));
+	ConstantNode *p = allocateNode(sizeof(ConstantNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->type = CT_INTEGER;
 	p->data.i = data;
+	p->tmpl = NULL;
 	return p;
 }
 
@@ -199,13 +294,14 @@ ConstantNode *createIntegerConstantNode(long long data)
  */
 ConstantNode *createFloatConstantNode(float data)
 {
-	ConstantNode *p = malloc(sizeof(ConstantNode));
+	ConstantNode *p = allocateNode(sizeof(ConstantNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->type = CT_FLOAT;
 	p->data.f = data;
+	p->tmpl = NULL;
 	return p;
 }
 
@@ -220,13 +316,15 @@ ConstantNode *createFloatConstantNode(float data)
  */
 ConstantNode *createStringConstantNode(char *data)
 {
-	ConstantNode *p = malloc(sizeof(ConstantNode));
+	ConstantNode *p = allocateNode(sizeof(ConstantNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->type = CT_STRING;
 	p->data.s = data;
+	/* Strings which cannot be templated are interpolated when cast */
+	p->tmpl = createStringTemplate(data);
 	return p;
 }
 
@@ -240,8 +338,214 @@ ConstantNode *createStringConstantNode(char *data)
 void deleteConstantNode(ConstantNode *node)
 {
 	if (!node) return;
-	if (node->type == CT_STRING) free(node->data.s);
-	free(node);
+	/* String data is interned, so only its template is deleted */
+	if (node->type == CT_STRING) deleteStringTemplate(node->tmpl);
+	freeNode(node);
+}
+
+/**
+ * Adds a segment to a string template.
+ *
+ * \param [in,out] tmpl The string template to add the segment to.
+ *
+ * \param [in] type The type of the segment.
+ *
+ * \param [in] text The literal text to intern (for SG_TEXT).
+ *
+ * \param [in] length The length of \a text.
+ *
+ * \param [in] id The variable to interpolate (for SG_VARIABLE).
+ *
+ * \post The segment will be added to the end of \a tmpl and, if it was added,
+ * \a id will be owned by \a tmpl.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The segment was added to \a tmpl.
+ */
+static int addTemplateSegment(StringTemplate *tmpl,
+                              SegmentType type,
+                              const char *text,
+                              size_t length,
+                              IdentifierNode *id)
+{
+	unsigned int newsize = tmpl->num + 1;
+	TemplateSegment *seg = NULL;
+	void *mem = growNodeArray(tmpl->segs, tmpl->num, sizeof(TemplateSegment));
+	if (!mem) return 0;
+	tmpl->segs = mem;
+	seg = &tmpl->segs[tmpl->num];
+	seg->type = type;
+	seg->text = NULL;
+	seg->length = 0;
+	seg->id = id;
+	if (type == SG_TEXT) {
+		seg->text = internStringLength(text, length);
+		if (!seg->text) return 0;
+		seg->length = length;
+		tmpl->length += length;
+	}
+	tmpl->num = newsize;
+	return 1;
+}
+
+/**
+ * Creates a string template by decoding the escape sequences of a string
+ * constant and separating the variables it interpolates from its literal
+ * text.  This performs the work of interpolating a string once, leaving only
+ * the variable lookups to be done each time the string is cast.
+ *
+ * \param [in] data The string constant to create a template of.
+ *
+ * \note Templates are not created for strings containing malformed escape
+ * sequences so that they continue to report their errors when cast.
+ *
+ * \return A pointer to a string template equivalent to \a data.
+ *
+ * \retval NULL Memory allocation failed or \a data contains a malformed escape
+ * sequence.
+ */
+StringTemplate *createStringTemplate(const char *data)
+{
+	StringTemplate *p = NULL;
+	char *text = NULL;
+	char *image = NULL;
+	IdentifierNode *id = NULL;
+	size_t a = 0, b = 0;
+	p = allocateNode(sizeof(StringTemplate));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->num = 0;
+	p->segs = NULL;
+	p->length = 0;
+	p->plain = (strchr(data, ':') == NULL);
+	/* Decoded escape sequences are never longer than their encodings */
+	text = allocateNode(sizeof(char) * (strlen(data) + 1));
+	if (!text) {
+		perror("malloc");
+		goto createStringTemplateAbort;
+	}
+	while (data[b] != '\0') {
+		if (data[b] != ':') {
+			text[a++] = data[b++];
+			continue;
+		}
+		switch (data[b + 1]) {
+			case ')':
+				text[a++] = '\n';
+				b += 2;
+				break;
+			case '>':
+				text[a++] = '\t';
+				b += 2;
+				break;
+			case 'o':
+				text[a++] = '\a';
+				b += 2;
+				break;
+			case '"':
+				text[a++] = '"';
+				b += 2;
+				break;
+			case ':':
+				text[a++] = ':';
+				b += 2;
+				break;
+			case '(':
+			case '[': {
+				const char *start = data + b + 2;
+				const char *end = strchr(start, data[b + 1] == '(' ? ')' : ']');
+				long codepoint = -1;
+				size_t len, n;
+				if (!end) goto createStringTemplateAbort;
+				len = (size_t)(end - start);
+				image = allocateNode(sizeof(char) * (len + 1));
+				if (!image) {
+					perror("malloc");
+					goto createStringTemplateAbort;
+				}
+				strncpy(image, start, len);
+				image[len] = '\0';
+				if (data[b + 1] == '[')
+					codepoint = lookupNormativeName(image);
+				else if (len > 0 && len <= 6) {
+					for (n = 0; n < len; n++)
+						if (!isxdigit((unsigned char)image[n])) break;
+					if (n == len) codepoint = strtol(image, NULL, 16);
+				}
+				freeNode(image);
+				image = NULL;
+				if (codepoint <= 0 || codepoint > 0x10FFFF)
+					goto createStringTemplateAbort;
+				a += convertCodePointToUTF8((unsigned long)codepoint, text + a);
+				b += len + 3;
+				break;
+			}
+			case '{': {
+				const char *start = data + b + 2;
+				const char *end = strchr(start, '}');
+				size_t len;
+				if (!end) goto createStringTemplateAbort;
+				len = (size_t)(end - start);
+				if (a > 0 && !addTemplateSegment(p, SG_TEXT, text, a, NULL))
+					goto createStringTemplateAbort;
+				a = 0;
+				if (len == 2 && !strncmp(start, "IT", 2)) {
+					if (!addTemplateSegment(p, SG_IMPVAR, NULL, 0, NULL))
+						goto createStringTemplateAbort;
+				}
+				else {
+					char *name = internStringLength(start, len);
+					if (!name) goto createStringTemplateAbort;
+					id = createIdentifierNode(IT_DIRECT, name, NULL, NULL, 0);
+					if (!id) goto createStringTemplateAbort;
+					if (!addTemplateSegment(p, SG_VARIABLE, NULL, 0, id))
+						goto createStringTemplateAbort;
+					id = NULL;
+				}
+				b += len + 3;
+				break;
+			}
+			default:
+				text[a++] = data[b++];
+				break;
+		}
+	}
+	if (a > 0 && !addTemplateSegment(p, SG_TEXT, text, a, NULL))
+		goto createStringTemplateAbort;
+	freeNode(text);
+	return p;
+
+createStringTemplateAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	if (id) deleteIdentifierNode(id);
+	if (image) freeNode(image);
+	if (text) freeNode(text);
+	deleteStringTemplate(p);
+
+	return NULL;
+}
+
+/**
+ * Deletes a string template.
+ *
+ * \param [in,out] tmpl The string template to delete.
+ *
+ * \post The memory at \a tmpl and all of its members will be freed.
+ */
+void deleteStringTemplate(StringTemplate *tmpl)
+{
+	unsigned int n;
+	if (!tmpl) return;
+	/* The text of segments is interned */
+	for (n = 0; n < tmpl->num; n++) {
+		if (tmpl->segs[n].id) deleteIdentifierNode(tmpl->segs[n].id);
+	}
+	freeNode(tmpl->segs);
+	freeNode(tmpl);
 }
 
 /**
@@ -267,7 +571,7 @@ IdentifierNode *createIdentifierNode(IdentifierType type,
                                      const char *fname,
                                      unsigned int line)
 {
-	IdentifierNode *p = malloc(sizeof(IdentifierNode));
+	IdentifierNode *p = allocateNode(sizeof(IdentifierNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -276,13 +580,15 @@ IdentifierNode *createIdentifierNode(IdentifierType type,
 	p->id = id;
 	p->slot = slot;
 	if (fname) {
-		p->fname = malloc(sizeof(char) * (strlen(fname) + 1));
+		p->fname = allocateNode(sizeof(char) * (strlen(fname) + 1));
 		strcpy(p->fname, fname);
 	}
 	else {
 		p->fname = NULL;
 	}
 	p->line = line;
+	p->depth = -1;
+	p->index = 0;
 	return p;
 }
 
@@ -298,7 +604,7 @@ void deleteIdentifierNode(IdentifierNode *node)
 	if (!node) return;
 	switch (node->type) {
 		case IT_DIRECT: {
-			free(node->id);
+			/* Direct identifier names are interned */
 			break;
 		}
 		case IT_INDIRECT: {
@@ -310,8 +616,8 @@ void deleteIdentifierNode(IdentifierNode *node)
 			break;
 	}
 	if (node->slot) deleteIdentifierNode(node->slot);
-	if (node->fname) free(node->fname);
-	free(node);
+	if (node->fname) freeNode(node->fname);
+	freeNode(node);
 }
 
 /**
@@ -323,7 +629,7 @@ void deleteIdentifierNode(IdentifierNode *node)
  */
 IdentifierNodeList *createIdentifierNodeList(void)
 {
-	IdentifierNodeList *p = malloc(sizeof(IdentifierNodeList));
+	IdentifierNodeList *p = allocateNode(sizeof(IdentifierNodeList));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -351,11 +657,8 @@ int addIdentifierNode(IdentifierNodeList *list,
                       IdentifierNode *node)
 {
 	unsigned int newsize = list->num + 1;
-	void *mem = realloc(list->ids, sizeof(IdentifierNode *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return 0;
-	}
+	void *mem = growNodeArray(list->ids, list->num, sizeof(IdentifierNode *));
+	if (!mem) return 0;
 	list->ids = mem;
 	list->ids[list->num] = node;
 	list->num = newsize;
@@ -375,8 +678,8 @@ void deleteIdentifierNodeList(IdentifierNodeList *list)
 	if (!list) return;
 	for (n = 0; n < list->num; n++)
 		deleteIdentifierNode(list->ids[n]);
-	free(list->ids);
-	free(list);
+	freeNode(list->ids);
+	freeNode(list);
 }
 
 /**
@@ -390,7 +693,7 @@ void deleteIdentifierNodeList(IdentifierNodeList *list)
  */
 TypeNode *createTypeNode(ConstantType type)
 {
-	TypeNode *p = malloc(sizeof(TypeNode));
+	TypeNode *p = allocateNode(sizeof(TypeNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -409,7 +712,7 @@ TypeNode *createTypeNode(ConstantType type)
 void deleteTypeNode(TypeNode *node)
 {
 	if (!node) return;
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -426,12 +729,13 @@ void deleteTypeNode(TypeNode *node)
 StmtNode *createStmtNode(StmtType type,
                          void *stmt)
 {
-	StmtNode *p = malloc(sizeof(StmtNode));
+	StmtNode *p = allocateNode(sizeof(StmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->type = type;
+	p->line = 0;
 	p->stmt = stmt;
 	return p;
 }
@@ -518,7 +822,7 @@ void deleteStmtNode(StmtNode *node)
 			error(PR_UNKNOWN_STATEMENT_TYPE);
 			break;
 	}
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -530,7 +834,7 @@ void deleteStmtNode(StmtNode *node)
  */
 StmtNodeList *createStmtNodeList(void)
 {
-	StmtNodeList *p = malloc(sizeof(StmtNodeList));
+	StmtNodeList *p = allocateNode(sizeof(StmtNodeList));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -557,11 +861,8 @@ int addStmtNode(StmtNodeList *list,
                 StmtNode *node)
 {
 	unsigned int newsize = list->num + 1;
-	void *mem = realloc(list->stmts, sizeof(StmtNode *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return 0;
-	}
+	void *mem = growNodeArray(list->stmts, list->num, sizeof(StmtNode *));
+	if (!mem) return 0;
 	list->stmts = mem;
 	list->stmts[list->num] = node;
 	list->num = newsize;
@@ -581,8 +882,8 @@ void deleteStmtNodeList(StmtNodeList *list)
 	if (!list) return;
 	for (n = 0; n < list->num; n++)
 		deleteStmtNode(list->stmts[n]);
-	free(list->stmts);
-	free(list);
+	freeNode(list->stmts);
+	freeNode(list);
 }
 
 /**
@@ -599,7 +900,7 @@ void deleteStmtNodeList(StmtNodeList *list)
 CastStmtNode *createCastStmtNode(IdentifierNode *target,
                                  TypeNode *newtype)
 {
-	CastStmtNode *p = malloc(sizeof(CastStmtNode));
+	CastStmtNode *p = allocateNode(sizeof(CastStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -621,7 +922,7 @@ void deleteCastStmtNode(CastStmtNode *node)
 	if (!node) return;
 	deleteIdentifierNode(node->target);
 	deleteTypeNode(node->newtype);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -641,7 +942,7 @@ PrintStmtNode *createPrintStmtNode(ExprNodeList *args,
                                    FILE *file,
                                    int nonl)
 {
-	PrintStmtNode *p = malloc(sizeof(PrintStmtNode));
+	PrintStmtNode *p = allocateNode(sizeof(PrintStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -663,7 +964,7 @@ void deletePrintStmtNode(PrintStmtNode *node)
 {
 	if (!node) return;
 	deleteExprNodeList(node->args);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -677,7 +978,7 @@ void deletePrintStmtNode(PrintStmtNode *node)
  */
 InputStmtNode *createInputStmtNode(IdentifierNode *target)
 {
-	InputStmtNode *p = malloc(sizeof(InputStmtNode));
+	InputStmtNode *p = allocateNode(sizeof(InputStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -697,7 +998,7 @@ void deleteInputStmtNode(InputStmtNode *node)
 {
 	if (!node) return;
 	deleteIdentifierNode(node->target);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -714,7 +1015,7 @@ void deleteInputStmtNode(InputStmtNode *node)
 AssignmentStmtNode *createAssignmentStmtNode(IdentifierNode *target,
                                              ExprNode *expr)
 {
-	AssignmentStmtNode *p = malloc(sizeof(AssignmentStmtNode));
+	AssignmentStmtNode *p = allocateNode(sizeof(AssignmentStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -736,7 +1037,7 @@ void deleteAssignmentStmtNode(AssignmentStmtNode *node)
 	if (!node) return;
 	deleteIdentifierNode(node->target);
 	deleteExprNode(node->expr);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -762,7 +1063,7 @@ DeclarationStmtNode *createDeclarationStmtNode(IdentifierNode *scope,
                                                TypeNode *type,
                                                IdentifierNode *parent)
 {
-	DeclarationStmtNode *p = malloc(sizeof(DeclarationStmtNode));
+	DeclarationStmtNode *p = allocateNode(sizeof(DeclarationStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -790,7 +1091,7 @@ void deleteDeclarationStmtNode(DeclarationStmtNode *node)
 	deleteExprNode(node->expr);
 	deleteTypeNode(node->type);
 	deleteIdentifierNode(node->parent);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -817,7 +1118,7 @@ IfThenElseStmtNode *createIfThenElseStmtNode(BlockNode *yes,
                                              ExprNodeList *guards,
                                              BlockNodeList *blocks)
 {
-	IfThenElseStmtNode *p = malloc(sizeof(IfThenElseStmtNode));
+	IfThenElseStmtNode *p = allocateNode(sizeof(IfThenElseStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -843,7 +1144,7 @@ void deleteIfThenElseStmtNode(IfThenElseStmtNode *node)
 	deleteBlockNode(node->no);
 	deleteExprNodeList(node->guards);
 	deleteBlockNodeList(node->blocks);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -866,7 +1167,7 @@ SwitchStmtNode *createSwitchStmtNode(ExprNodeList *guards,
                                      BlockNodeList *blocks,
                                      BlockNode *def)
 {
-	SwitchStmtNode *p = malloc(sizeof(SwitchStmtNode));
+	SwitchStmtNode *p = allocateNode(sizeof(SwitchStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -874,6 +1175,13 @@ SwitchStmtNode *createSwitchStmtNode(ExprNodeList *guards,
 	p->guards = guards;
 	p->blocks = blocks;
 	p->def = def;
+	p->table = NULL;
+	p->size = 0;
+	p->floats = 0;
+	if (!indexSwitchStmtNode(p)) {
+		freeNode(p);
+		return NULL;
+	}
 	return p;
 }
 
@@ -890,7 +1198,92 @@ void deleteSwitchStmtNode(SwitchStmtNode *node)
 	deleteExprNodeList(node->guards);
 	deleteBlockNodeList(node->blocks);
 	deleteBlockNode(node->def);
-	free(node);
+	freeNode(node->table);
+	freeNode(node);
+}
+
+/**
+ * Hashes the value of a switch statement guard.
+ *
+ * \param [in] type The type of the value.
+ *
+ * \param [in] i The value (for \c CT_BOOLEAN and \c CT_INTEGER).
+ *
+ * \param [in] s The characters of the value (for \c CT_STRING).
+ *
+ * \param [in] len The number of characters in \a s.
+ *
+ * \return The hash of the value.
+ */
+unsigned int hashSwitchKey(ConstantType type,
+                           long long i,
+                           const char *s,
+                           size_t len)
+{
+	unsigned int hash = 2166136261u ^ (unsigned int)type;
+	size_t n;
+	if (type != CT_STRING) {
+		unsigned long long u = (unsigned long long)i * 0x9E3779B97F4A7C15ull;
+		return hash ^ (unsigned int)(u >> 32);
+	}
+	for (n = 0; n < len; n++) {
+		hash ^= (unsigned char)s[n];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Builds the jump table of a switch statement from its guards.  This must be
+ * called again whenever the guards change.
+ *
+ * \param [in,out] stmt The switch statement to build the jump table of.
+ *
+ * \note No table is built unless every guard is a constant, leaving each
+ * guard to be tested in order.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The jump table was built successfully.
+ */
+int indexSwitchStmtNode(SwitchStmtNode *stmt)
+{
+	unsigned int n;
+	unsigned int size = 4;
+	freeNode(stmt->table);
+	stmt->table = NULL;
+	stmt->size = 0;
+	stmt->floats = 0;
+	if (!stmt->guards || stmt->guards->num == 0) return 1;
+	for (n = 0; n < stmt->guards->num; n++)
+		if (stmt->guards->exprs[n]->type != ET_CONSTANT) return 1;
+	/* Keep the table at most half full */
+	while (size < stmt->guards->num * 2) size *= 2;
+	stmt->table = allocateNode(sizeof(SwitchEntry) * size);
+	if (!stmt->table) {
+		perror("malloc");
+		return 0;
+	}
+	stmt->size = size;
+	for (n = 0; n < size; n++) stmt->table[n].guard = NULL;
+	for (n = 0; n < stmt->guards->num; n++) {
+		ConstantNode *c = stmt->guards->exprs[n]->expr;
+		unsigned int h;
+		if (c->type == CT_FLOAT) {
+			stmt->floats++;
+			continue;
+		}
+		if (c->type != CT_BOOLEAN && c->type != CT_INTEGER
+				&& c->type != CT_STRING)
+			continue;
+		h = hashSwitchKey(c->type, c->data.i, c->data.s,
+				c->type == CT_STRING ? strlen(c->data.s) : 0);
+		h &= size - 1;
+		while (stmt->table[h].guard) h = (h + 1) & (size - 1);
+		stmt->table[h].guard = c;
+		stmt->table[h].index = n;
+	}
+	return 1;
 }
 
 /**
@@ -904,12 +1297,13 @@ void deleteSwitchStmtNode(SwitchStmtNode *node)
  */
 ReturnStmtNode *createReturnStmtNode(ExprNode *value)
 {
-	ReturnStmtNode *p = malloc(sizeof(ReturnStmtNode));
+	ReturnStmtNode *p = allocateNode(sizeof(ReturnStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
 	}
 	p->value = value;
+	p->func = NULL;
 	return p;
 }
 
@@ -924,7 +1318,7 @@ void deleteReturnStmtNode(ReturnStmtNode *node)
 {
 	if (!node) return;
 	deleteExprNode(node->value);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -950,7 +1344,7 @@ LoopStmtNode *createLoopStmtNode(IdentifierNode *name,
                                  ExprNode *update,
                                  BlockNode *body)
 {
-	LoopStmtNode *p = malloc(sizeof(LoopStmtNode));
+	LoopStmtNode *p = allocateNode(sizeof(LoopStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -960,6 +1354,11 @@ LoopStmtNode *createLoopStmtNode(IdentifierNode *name,
 	p->guard = guard;
 	p->update = update;
 	p->body = body;
+	p->step = 0;
+	p->cmp = LC_NONE;
+	p->limit = NULL;
+	p->declares = 1;
+	p->invariants = NULL;
 	return p;
 }
 
@@ -978,7 +1377,8 @@ void deleteLoopStmtNode(LoopStmtNode *node)
 	deleteExprNode(node->guard);
 	deleteExprNode(node->update);
 	deleteBlockNode(node->body);
-	free(node);
+	deleteIdentifierNodeList(node->invariants);
+	freeNode(node);
 }
 
 /**
@@ -992,7 +1392,7 @@ void deleteLoopStmtNode(LoopStmtNode *node)
  */
 DeallocationStmtNode *createDeallocationStmtNode(IdentifierNode *target)
 {
-	DeallocationStmtNode *p = malloc(sizeof(DeallocationStmtNode));
+	DeallocationStmtNode *p = allocateNode(sizeof(DeallocationStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1012,7 +1412,7 @@ void deleteDeallocationStmtNode(DeallocationStmtNode *node)
 {
 	if (!node) return;
 	deleteIdentifierNode(node->target);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -1036,7 +1436,7 @@ FuncDefStmtNode *createFuncDefStmtNode(IdentifierNode *scope,
                                        IdentifierNodeList *args,
                                        BlockNode *body)
 {
-	FuncDefStmtNode *p = malloc(sizeof(FuncDefStmtNode));
+	FuncDefStmtNode *p = allocateNode(sizeof(FuncDefStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1045,6 +1445,11 @@ FuncDefStmtNode *createFuncDefStmtNode(IdentifierNode *scope,
 	p->name = name;
 	p->args = args;
 	p->body = body;
+	p->locals = args->num;
+	p->names = NULL;
+	p->numnames = 0;
+	p->created = 0;
+	p->computed = 1;
 	return p;
 }
 
@@ -1062,7 +1467,8 @@ void deleteFuncDefStmtNode(FuncDefStmtNode *node)
 	deleteIdentifierNode(node->name);
 	deleteIdentifierNodeList(node->args);
 	deleteBlockNode(node->body);
-	free(node);
+	freeNode(node->names);
+	freeNode(node);
 }
 
 /**
@@ -1083,7 +1489,7 @@ AltArrayDefStmtNode *createAltArrayDefStmtNode(IdentifierNode *name,
                                                BlockNode *body,
                                                IdentifierNode *parent)
 {
-	AltArrayDefStmtNode *p = malloc(sizeof(AltArrayDefStmtNode));
+	AltArrayDefStmtNode *p = allocateNode(sizeof(AltArrayDefStmtNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1106,7 +1512,7 @@ void deleteAltArrayDefStmtNode(AltArrayDefStmtNode *node)
 	if (!node) return;
 	deleteIdentifierNode(node->name);
 	deleteBlockNode(node->body);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -1123,7 +1529,7 @@ void deleteAltArrayDefStmtNode(AltArrayDefStmtNode *node)
 ExprNode *createExprNode(ExprType type,
                          void *expr)
 {
-	ExprNode *p = malloc(sizeof(ExprNode));
+	ExprNode *p = allocateNode(sizeof(ExprNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1161,11 +1567,14 @@ void deleteExprNode(ExprNode *node)
 			break;
 		case ET_IMPVAR:
 			break; /* This expression type does not have any content */
+		case ET_INVARIANT:
+			deleteInvariantExprNode((InvariantExprNode *)node->expr);
+			break;
 		default:
 			error(PR_UNKNOWN_EXPRESSION_TYPE);
 			break;
 	}
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -1177,7 +1586,7 @@ void deleteExprNode(ExprNode *node)
  */
 ExprNodeList *createExprNodeList(void)
 {
-	ExprNodeList *p = malloc(sizeof(ExprNodeList));
+	ExprNodeList *p = allocateNode(sizeof(ExprNodeList));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1204,11 +1613,8 @@ int addExprNode(ExprNodeList *list,
                 ExprNode *node)
 {
 	unsigned int newsize = list->num + 1;
-	void *mem = realloc(list->exprs, sizeof(ExprNode *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return 0;
-	}
+	void *mem = growNodeArray(list->exprs, list->num, sizeof(ExprNode *));
+	if (!mem) return 0;
 	list->exprs = mem;
 	list->exprs[list->num] = node;
 	list->num = newsize;
@@ -1228,8 +1634,8 @@ void deleteExprNodeList(ExprNodeList *list)
 	if (!list) return;
 	for (n = 0; n < list->num; n++)
 		deleteExprNode(list->exprs[n]);
-	free(list->exprs);
-	free(list);
+	freeNode(list->exprs);
+	freeNode(list);
 }
 
 /**
@@ -1246,7 +1652,7 @@ void deleteExprNodeList(ExprNodeList *list)
 CastExprNode *createCastExprNode(ExprNode *target,
                                  TypeNode *newtype)
 {
-	CastExprNode *p = malloc(sizeof(CastExprNode));
+	CastExprNode *p = allocateNode(sizeof(CastExprNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1268,7 +1674,7 @@ void deleteCastExprNode(CastExprNode *node)
 	if (!node) return;
 	deleteExprNode(node->target);
 	deleteTypeNode(node->newtype);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -1288,7 +1694,7 @@ FuncCallExprNode *createFuncCallExprNode(IdentifierNode *scope,
                                          IdentifierNode *name,
                                          ExprNodeList *args)
 {
-	FuncCallExprNode *p = malloc(sizeof(FuncCallExprNode));
+	FuncCallExprNode *p = allocateNode(sizeof(FuncCallExprNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1296,6 +1702,7 @@ FuncCallExprNode *createFuncCallExprNode(IdentifierNode *scope,
 	p->scope = scope;
 	p->name = name;
 	p->args = args;
+	p->index = -1;
 	return p;
 }
 
@@ -1312,7 +1719,7 @@ void deleteFuncCallExprNode(FuncCallExprNode *node)
 	deleteIdentifierNode(node->scope);
 	deleteIdentifierNode(node->name);
 	deleteExprNodeList(node->args);
-	free(node);
+	freeNode(node);
 }
 
 /**
@@ -1329,7 +1736,7 @@ void deleteFuncCallExprNode(FuncCallExprNode *node)
 OpExprNode *createOpExprNode(OpType type,
                              ExprNodeList *args)
 {
-	OpExprNode *p = malloc(sizeof(OpExprNode));
+	OpExprNode *p = allocateNode(sizeof(OpExprNode));
 	if (!p) {
 		perror("malloc");
 		return NULL;
@@ -1350,14 +1757,69 @@ void deleteOpExprNode(OpExprNode *node)
 {
 	if (!node) return;
 	deleteExprNodeList(node->args);
-	free(node);
+	freeNode(node);
+}
+
+/**
+ * Creates a loop invariant expression.
+ *
+ * \param [in] expr The invariant expression.
+ *
+ * \param [in] id The hidden variable to hold the value of \a expr in.
+ *
+ * \return A pointer to a loop invariant expression with the desired
+ * properties.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+InvariantExprNode *createInvariantExprNode(ExprNode *expr,
+                                           IdentifierNode *id)
+{
+	InvariantExprNode *p = allocateNode(sizeof(InvariantExprNode));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->expr = expr;
+	p->id = id;
+	return p;
+}
+
+/**
+ * Deletes a loop invariant expression.
+ *
+ * \param [in,out] node The loop invariant expression to delete.
+ *
+ * \post The memory at \a node and all of its members will be freed.
+ */
+void deleteInvariantExprNode(InvariantExprNode *node)
+{
+	if (!node) return;
+	deleteExprNode(node->expr);
+	deleteIdentifierNode(node->id);
+	freeNode(node);
 }
 
 /**
- * Checks if a type of token is at a position in a token list, and if so,
+ * Gets the token at a position in a token stream.
+ *
+ * \param [in] tokens The position in a token stream to get the token at.
+ *
+ * \return A pointer to the token at \a tokens.  If the token stream failed or
+ * ended before \a tokens, this is the stream's failure token, which no parsing
+ * function accepts.
+ */
+Token *getToken(TokenPosition tokens)
+{
+	Token *token = getStreamToken(tokens.stream, tokens.index);
+	return token ? token : &tokens.stream->failure;
+}
+
+/**
+ * Checks if a type of token is at a position in a token stream, and if so,
  * advances the position.
  *
- * \param [in,out] tokenp The position in a token list to check.
+ * \param [in,out] tokenp The position in a token stream to check.
  *
  * \param [in] token The type of token to check for.
  *
@@ -1368,21 +1830,20 @@ void deleteOpExprNode(OpExprNode *node)
  *
  * \retval 1 The type of \a tokenp is not \a token.
  */
-int acceptToken(Token ***tokenp,
+int acceptToken(TokenPosition *tokenp,
                 TokenType token)
 {
-	Token **tokens = *tokenp;
-	if (!(*tokens)) return 0;
-	if ((*tokens)->type != token) return 0;
-	tokens++;
+	TokenPosition tokens = *tokenp;
+	if (getToken(tokens)->type != token) return 0;
+	tokens.index++;
 	*tokenp = tokens;
 	return 1;
 }
 
 /**
- * Checks if a type of token is at a position in a token list.
+ * Checks if a type of token is at a position in a token stream.
  *
- * \param [in] tokenp The position in a token list to check.
+ * \param [in] tokenp The position in a token stream to check.
  *
  * \param [in] token The type of token to check for.
  *
@@ -1392,18 +1853,17 @@ int acceptToken(Token ***tokenp,
  *
  * \retval 1 The type of \a tokenp is not \a token.
  */
-int peekToken(Token ***tokenp,
+int peekToken(TokenPosition *tokenp,
               TokenType token)
 {
-	Token **tokens = *tokenp;
-	if ((*tokens)->type != token) return 0;
+	if (getToken(*tokenp)->type != token) return 0;
 	return 1;
 }
 
 /**
- * Checks if a type of token is after a position in a token list.
+ * Checks if a type of token is after a position in a token stream.
  *
- * \param [in] tokenp The position in a token list to check after.
+ * \param [in] tokenp The position in a token stream to check after.
  *
  * \param [in] token The type of token to check for.
  *
@@ -1413,14 +1873,34 @@ int peekToken(Token ***tokenp,
  *
  * \retval 1 The type of the token after \a tokenp is not \a token.
  */
-int nextToken(Token ***tokenp,
+int nextToken(TokenPosition *tokenp,
          TokenType token)
 {
-	Token **tokens = *tokenp;
-	if ((*(tokens + 1))->type != token) return 0;
+	TokenPosition next = { tokenp->stream, tokenp->index + 1 };
+	if (getToken(next)->type != token) return 0;
 	return 1;
 }
 
+/**
+ * Checks whether generating the tokens of a token stream fails.  Tokens are
+ * generated as they are parsed, so the rest of the stream is generated first:
+ * an error generating a later token is reported by the time this returns and
+ * takes the place of any parser error, as it would if the whole file were
+ * tokenized before parsing.
+ *
+ * \param [in,out] stream The token stream to check.
+ *
+ * \retval 0 Every token of \a stream was generated.
+ *
+ * \retval 1 Generating a token of \a stream failed.
+ */
+static int hasStreamFailed(TokenStream *stream)
+{
+	while (!stream->done)
+		getStreamToken(stream, stream->end);
+	return stream->failed;
+}
+
 /**
  * A simple wrapper around the global error printing function tailored to
  * general parser errors.
@@ -1430,13 +1910,10 @@ int nextToken(Token ***tokenp,
  * \param [in] tokens The tokens being parsed when the error occurred.
  */
 void parser_error(ErrorType type,
-                  Token **tokens)
+                  TokenPosition tokens)
 {
-	if (!(*tokens)) {
-		error(PR_UNHANDLED_STRING);
-	} else {
-		error(type, (*tokens)->fname, (*tokens)->line, (*tokens)->image);
-	}
+	if (hasStreamFailed(tokens.stream)) return;
+	error(type, getToken(tokens)->fname, getToken(tokens)->line, getToken(tokens)->image);
 }
 
 /**
@@ -1448,13 +1925,14 @@ void parser_error(ErrorType type,
  * \param [in] tokens The tokens being parsed when the error occurred.
  */
 void parser_error_expected_token(TokenType token,
-                                 Token **tokens)
+                                 TokenPosition tokens)
 {
+	if (hasStreamFailed(tokens.stream)) return;
 	error(PR_EXPECTED_TOKEN,
-			(*tokens)->fname,
-			(*tokens)->line,
+			getToken(tokens)->fname,
+			getToken(tokens)->line,
 			keywords[token],
-			(*tokens)->image);
+			getToken(tokens)->image);
 }
 
 /**
@@ -1469,20 +1947,21 @@ void parser_error_expected_token(TokenType token,
  */
 void parser_error_expected_either_token(TokenType token1,
                                         TokenType token2,
-                                        Token **tokens)
+                                        TokenPosition tokens)
 {
+	if (hasStreamFailed(tokens.stream)) return;
 	error(PR_EXPECTED_TOKEN,
-			(*tokens)->fname,
-			(*tokens)->line,
+			getToken(tokens)->fname,
+			getToken(tokens)->line,
 			keywords[token1],
 			keywords[token2],
-			(*tokens)->image);
+			getToken(tokens)->image);
 }
 
 /**
  * Parses tokens into a constant.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1490,14 +1969,14 @@ void parser_error_expected_either_token(TokenType token1,
  *
  * \retval NULL Unable to parse.
  */
-ConstantNode *parseConstantNode(Token ***tokenp)
+ConstantNode *parseConstantNode(TokenPosition *tokenp)
 {
 	ConstantNode *ret = NULL;
 	char *data = NULL;
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	shiftout();
@@ -1509,7 +1988,7 @@ ConstantNode *parseConstantNode(Token ***tokenp)
 		debug("CT_BOOLEAN");
 #endif
 		/* Create the ConstantNode structure */
-		ret = createBooleanConstantNode((*tokens)->data.i);
+		ret = createBooleanConstantNode(getToken(tokens)->data.i);
 		if (!ret) goto parseConstantNodeAbort;
 
 		/* This should succeed; it was checked for above */
@@ -1525,7 +2004,7 @@ ConstantNode *parseConstantNode(Token ***tokenp)
 		debug("CT_INTEGER");
 #endif
 		/* Create the ConstantNode structure */
-		ret = createIntegerConstantNode((*tokens)->data.i);
+		ret = createIntegerConstantNode(getToken(tokens)->data.i);
 		if (!ret) goto parseConstantNodeAbort;
 
 		/* This should succeed; it was checked for above */
@@ -1541,7 +2020,7 @@ ConstantNode *parseConstantNode(Token ***tokenp)
 		debug("CT_FLOAT");
 #endif
 		/* Create the ConstantNode structure */
-		ret = createFloatConstantNode((*tokens)->data.f);
+		ret = createFloatConstantNode(getToken(tokens)->data.f);
 		if (!ret) goto parseConstantNodeAbort;
 
 		/* This should succeed; it was checked for above */
@@ -1553,21 +2032,15 @@ ConstantNode *parseConstantNode(Token ***tokenp)
 	}
 	/* String */
 	else if (peekToken(&tokens, TT_STRING)) {
-		size_t len = strlen((*tokens)->image);
-		data = malloc(sizeof(char) * (len - 1));
-		if (!data) {
-			perror("malloc");
-			goto parseConstantNodeAbort;
-		}
-		strncpy(data, (*tokens)->image + 1, len - 2);
-		data[len - 2] = '\0';
+		size_t len = strlen(getToken(tokens)->image);
+		data = internStringLength(getToken(tokens)->image + 1, len - 2);
+		if (!data) goto parseConstantNodeAbort;
 #ifdef DEBUG
 		debug("CT_STRING");
 #endif
 		/* Create the ConstantNode structure */
 		ret = createStringConstantNode(data);
 		if (!ret) goto parseConstantNodeAbort;
-		data = NULL;
 
 		/* This should succeed; it was checked for above */
 		status = acceptToken(&tokens, TT_STRING);
@@ -1592,7 +2065,6 @@ ConstantNode *parseConstantNode(Token ***tokenp)
 parseConstantNodeAbort: /* Exception handling */
 
 	/* Clean up any allocated structures */
-	if (data) free(data);
 	if (ret) deleteConstantNode(ret);
 
 	return NULL;
@@ -1601,7 +2073,7 @@ parseConstantNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a type.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1609,12 +2081,12 @@ parseConstantNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-TypeNode *parseTypeNode(Token ***tokenp)
+TypeNode *parseTypeNode(TokenPosition *tokenp)
 {
 	TypeNode *ret = NULL;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	shiftout();
@@ -1692,7 +2164,7 @@ parseTypeNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an identifier.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1700,7 +2172,7 @@ parseTypeNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-IdentifierNode *parseIdentifierNode(Token ***tokenp)
+IdentifierNode *parseIdentifierNode(TokenPosition *tokenp)
 {
 	IdentifierType type;
 	void *data = NULL;
@@ -1708,9 +2180,6 @@ IdentifierNode *parseIdentifierNode(Token ***tokenp)
 	const char *fname = NULL;
 	unsigned int line;
 
-	/* For direct identifier */
-	char *temp = NULL;
-
 	/* For indirect identifier */
 	ExprNode *expr = NULL;
 
@@ -1718,14 +2187,14 @@ IdentifierNode *parseIdentifierNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	shiftout();
 #endif
 
-	fname = (*tokens)->fname;
-	line = (*tokens)->line;
+	fname = getToken(tokens)->fname;
+	line = getToken(tokens)->line;
 
 	/* Direct identifier */
 	if (peekToken(&tokens, TT_IDENTIFIER)) {
@@ -1733,11 +2202,9 @@ IdentifierNode *parseIdentifierNode(Token ***tokenp)
 #ifdef DEBUG
 		debug("IT_DIRECT");
 #endif
-		/* Copy the token image */
-		temp = malloc(sizeof(char) * (strlen((*tokens)->image) + 1));
-		if (!temp) goto parseIdentifierNodeAbort;
-		strcpy(temp, (*tokens)->image);
-		data = temp;
+		/* Intern the token image */
+		data = internString(getToken(tokens)->image);
+		if (!data) goto parseIdentifierNodeAbort;
 
 		/* This should succeed; it was checked for above */
 		status = acceptToken(&tokens, TT_IDENTIFIER);
@@ -1758,6 +2225,7 @@ IdentifierNode *parseIdentifierNode(Token ***tokenp)
 	}
 	else {
 		parser_error(PR_EXPECTED_IDENTIFIER, tokens);
+		goto parseIdentifierNodeAbort;
 	}
 
 	/* Check if there is a slot access */
@@ -1787,9 +2255,6 @@ parseIdentifierNodeAbort: /* Exception handling */
 		/* For indirect identifier */
 		if (expr) deleteExprNode(expr);
 
-		/* For direct identifier */
-		if (temp) free(temp);
-
 		if (slot) deleteIdentifierNode(slot);
 	}
 
@@ -1799,7 +2264,7 @@ parseIdentifierNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a cast expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1807,7 +2272,7 @@ parseIdentifierNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseCastExprNode(Token ***tokenp)
+ExprNode *parseCastExprNode(TokenPosition *tokenp)
 {
 	ExprNode *target = NULL;
 	TypeNode *newtype = NULL;
@@ -1816,7 +2281,7 @@ ExprNode *parseCastExprNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ET_CAST");
@@ -1869,7 +2334,7 @@ parseCastExprNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a constant expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1877,13 +2342,13 @@ parseCastExprNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseConstantExprNode(Token ***tokenp)
+ExprNode *parseConstantExprNode(TokenPosition *tokenp)
 {
 	ConstantNode *node = NULL;
 	ExprNode *ret = NULL;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ET_CONSTANT");
@@ -1916,7 +2381,7 @@ parseConstantExprNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an identifier expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -1924,13 +2389,13 @@ parseConstantExprNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseIdentifierExprNode(Token ***tokenp)
+ExprNode *parseIdentifierExprNode(TokenPosition *tokenp)
 {
 	IdentifierNode *node = NULL;
 	ExprNode *ret = NULL;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ET_IDENTIFIER");
@@ -1963,7 +2428,7 @@ parseIdentifierExprNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a function call expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a Tokenp will point to the next unparsed token.
  *
@@ -1971,7 +2436,7 @@ parseIdentifierExprNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseFuncCallExprNode(Token ***tokenp)
+ExprNode *parseFuncCallExprNode(TokenPosition *tokenp)
 {
 	IdentifierNode *scope = NULL;
 	IdentifierNode *name = NULL;
@@ -1982,7 +2447,7 @@ ExprNode *parseFuncCallExprNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ET_FUNCCALL");
@@ -2069,7 +2534,7 @@ parseFuncCallExprNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an operation expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2077,7 +2542,7 @@ parseFuncCallExprNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseOpExprNode(Token ***tokenp)
+ExprNode *parseOpExprNode(TokenPosition *tokenp)
 {
 	enum ArityType {
 		AT_UNARY,
@@ -2093,7 +2558,7 @@ ExprNode *parseOpExprNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 	/* Unary operations */
 	if (acceptToken(&tokens, TT_NOT)) {
@@ -2301,7 +2766,7 @@ parseOpExprNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an expression.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2309,9 +2774,9 @@ parseOpExprNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-ExprNode *parseExprNode(Token ***tokenp)
+ExprNode *parseExprNode(TokenPosition *tokenp)
 {
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 	ExprNode *ret = NULL;
 
 #ifdef DEBUG
@@ -2395,7 +2860,7 @@ ExprNode *parseExprNode(Token ***tokenp)
 /**
  * Parses tokens into a cast statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2403,7 +2868,7 @@ ExprNode *parseExprNode(Token ***tokenp)
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseCastStmtNode(Token ***tokenp)
+StmtNode *parseCastStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *target = NULL;
 	TypeNode *newtype = NULL;
@@ -2412,7 +2877,7 @@ StmtNode *parseCastStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_CAST");
@@ -2469,7 +2934,7 @@ parseCastStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a print statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2477,7 +2942,7 @@ parseCastStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parsePrintStmtNode(Token ***tokenp)
+StmtNode *parsePrintStmtNode(TokenPosition *tokenp)
 {
 	ExprNode *arg = NULL;
 	ExprNodeList *args = NULL;
@@ -2488,7 +2953,7 @@ StmtNode *parsePrintStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_PRINT");
@@ -2566,7 +3031,7 @@ parsePrintStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an input statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2574,7 +3039,7 @@ parsePrintStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseInputStmtNode(Token ***tokenp)
+StmtNode *parseInputStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *target = NULL;
 	InputStmtNode *stmt = NULL;
@@ -2582,7 +3047,7 @@ StmtNode *parseInputStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_INPUT");
@@ -2634,7 +3099,7 @@ parseInputStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an assignment statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2642,7 +3107,7 @@ parseInputStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL unable to parse.
  */ 
-StmtNode *parseAssignmentStmtNode(Token ***tokenp)
+StmtNode *parseAssignmentStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *target = NULL;
 	ExprNode *expr = NULL;
@@ -2651,7 +3116,7 @@ StmtNode *parseAssignmentStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_ASSIGNMENT");
@@ -2707,7 +3172,7 @@ parseAssignmentStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a declaration statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2715,7 +3180,7 @@ parseAssignmentStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseDeclarationStmtNode(Token ***tokenp)
+StmtNode *parseDeclarationStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *scope = NULL;
 	IdentifierNode *target = NULL;
@@ -2727,7 +3192,7 @@ StmtNode *parseDeclarationStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_DECLARATION");
@@ -2806,7 +3271,7 @@ parseDeclarationStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an if/then/else statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2814,7 +3279,7 @@ parseDeclarationStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseIfThenElseStmtNode(Token ***tokenp)
+StmtNode *parseIfThenElseStmtNode(TokenPosition *tokenp)
 {
 	BlockNode *yes = NULL;
 	ExprNodeList *guards = NULL;
@@ -2827,7 +3292,7 @@ StmtNode *parseIfThenElseStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_CONDITIONAL");
@@ -2959,7 +3424,7 @@ parseIfThenElseStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a switch statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -2967,7 +3432,7 @@ parseIfThenElseStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseSwitchStmtNode(Token ***tokenp)
+StmtNode *parseSwitchStmtNode(TokenPosition *tokenp)
 {
 	ExprNodeList *guards = NULL;
 	BlockNodeList *blocks = NULL;
@@ -2980,7 +3445,7 @@ StmtNode *parseSwitchStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_SWITCH");
@@ -3133,7 +3598,7 @@ parseSwitchStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a break statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3141,13 +3606,13 @@ parseSwitchStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseBreakStmtNode(Token ***tokenp)
+StmtNode *parseBreakStmtNode(TokenPosition *tokenp)
 {
 	StmtNode *ret = NULL;
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_BREAK");
@@ -3186,7 +3651,7 @@ parseBreakStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a return statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3194,7 +3659,7 @@ parseBreakStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseReturnStmtNode(Token ***tokenp)
+StmtNode *parseReturnStmtNode(TokenPosition *tokenp)
 {
 	ExprNode *value = NULL;
 	ReturnStmtNode *stmt = NULL;
@@ -3202,7 +3667,7 @@ StmtNode *parseReturnStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_RETURN");
@@ -3253,7 +3718,7 @@ parseReturnStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a loop statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3261,7 +3726,7 @@ parseReturnStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseLoopStmtNode(Token ***tokenp)
+StmtNode *parseLoopStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *name1 = NULL;
 	IdentifierNode *var = NULL;
@@ -3272,7 +3737,6 @@ StmtNode *parseLoopStmtNode(Token ***tokenp)
 	IdentifierNode *name2 = NULL;
 	LoopStmtNode *stmt = NULL;
 	ExprNodeList *args = NULL;
-	char *id = NULL;
 
 	/* For increment and decrement loops */
 	IdentifierNode *varcopy = NULL;
@@ -3296,7 +3760,7 @@ StmtNode *parseLoopStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_LOOP");
@@ -3357,12 +3821,8 @@ StmtNode *parseLoopStmtNode(Token ***tokenp)
 		shiftin();
 #endif
 		/* Make a copy of the variable for use as a function argument */
-		id = malloc(sizeof(char) * (strlen(var->id) + 1));
-		if (!id) goto parseLoopStmtNodeAbort;
-		strcpy(id, var->id);
-		varcopy = createIdentifierNode(IT_DIRECT, id, NULL, var->fname, var->line);
+		varcopy = createIdentifierNode(IT_DIRECT, var->id, NULL, var->fname, var->line);
 		if (!varcopy) goto parseLoopStmtNodeAbort;
-		id = NULL;
 
 		/* Package the variable into an identifier expression */
 		arg1 = createExprNode(ET_IDENTIFIER, varcopy);
@@ -3446,12 +3906,8 @@ StmtNode *parseLoopStmtNode(Token ***tokenp)
 		arg = NULL;
 
 		/* Copy the identifier to make it the loop variable */
-		id = malloc(sizeof(char) * (strlen(temp->id) + 1));
-		if (!id) goto parseLoopStmtNodeAbort;
-		strcpy(id, temp->id);
-		var = createIdentifierNode(IT_DIRECT, id, NULL, temp->fname, temp->line);
+		var = createIdentifierNode(IT_DIRECT, temp->id, NULL, temp->fname, temp->line);
 		if (!var) goto parseLoopStmtNodeAbort;
-		id = NULL;
 
 		/* Check for unary function */
 		status = acceptToken(&tokens, TT_MKAY);
@@ -3576,7 +4032,6 @@ parseLoopStmtNodeAbort: /* Exception handling */
 		if (update) deleteExprNode(update);
 		if (var) deleteIdentifierNode(var);
 		if (name1) deleteIdentifierNode(name1);
-		if (id) free(id);
 
 		/* For increment and decrement loops */
 		if (op) deleteOpExprNode(op);
@@ -3603,7 +4058,7 @@ parseLoopStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a deallocation statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3611,7 +4066,7 @@ parseLoopStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseDeallocationStmtNode(Token ***tokenp)
+StmtNode *parseDeallocationStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *target = NULL;
 	DeallocationStmtNode *stmt = NULL;
@@ -3619,7 +4074,7 @@ StmtNode *parseDeallocationStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_DEALLOCATION");
@@ -3671,7 +4126,7 @@ parseDeallocationStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a function definition statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3679,7 +4134,7 @@ parseDeallocationStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseFuncDefStmtNode(Token ***tokenp)
+StmtNode *parseFuncDefStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *scope = NULL;
 	IdentifierNode *name = NULL;
@@ -3691,7 +4146,7 @@ StmtNode *parseFuncDefStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_FUNCDEF");
@@ -3797,7 +4252,7 @@ parseFuncDefStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into an alternate array definition statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3805,7 +4260,7 @@ parseFuncDefStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseAltArrayDefStmtNode(Token ***tokenp)
+StmtNode *parseAltArrayDefStmtNode(TokenPosition *tokenp)
 {
 	IdentifierNode *name = NULL;
 	BlockNode *body = NULL;
@@ -3815,7 +4270,7 @@ StmtNode *parseAltArrayDefStmtNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	debug("ST_ALTARRAYDEF");
@@ -3895,7 +4350,7 @@ parseAltArrayDefStmtNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a statement.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -3903,13 +4358,14 @@ parseAltArrayDefStmtNodeAbort: /* Exception handling */
  *
  * \retval NULL Unable to parse.
  */
-StmtNode *parseStmtNode(Token ***tokenp)
+StmtNode *parseStmtNode(TokenPosition *tokenp)
 {
 	StmtNode *ret = NULL;
 	ExprNode *expr = NULL;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
+	unsigned int line = getToken(tokens) ? getToken(tokens)->line : 0;
 
 #ifdef DEBUG
 	shiftout();
@@ -4040,10 +4496,16 @@ StmtNode *parseStmtNode(Token ***tokenp)
 		/* Since we're successful, update the token stream */
 		*tokenp = tokens;
 	}
-	else {
+	/*
+	 * An expression which failed to parse has already reported why, so
+	 * only report a missing statement if nothing else has.
+	 */
+	else if (!getErrorCode()) {
 		parser_error(PR_EXPECTED_STATEMENT, tokens);
 	}
 
+	if (ret) ret->line = line;
+
 #ifdef DEBUG
 	shiftin();
 #endif
@@ -4054,7 +4516,7 @@ StmtNode *parseStmtNode(Token ***tokenp)
 /**
  * Parses tokens into a code block.
  *
- * \param [in] tokenp The position in a token list to start parsing at.
+ * \param [in] tokenp The position in a token stream to start parsing at.
  *
  * \post \a tokenp will point to the next unparsed token.
  *
@@ -4062,7 +4524,7 @@ StmtNode *parseStmtNode(Token ***tokenp)
  *
  * \retval NULL Unable to parse.
  */
-BlockNode *parseBlockNode(Token ***tokenp)
+BlockNode *parseBlockNode(TokenPosition *tokenp)
 {
 	StmtNodeList *stmts = NULL;
 	StmtNode *stmt = NULL;
@@ -4070,7 +4532,7 @@ BlockNode *parseBlockNode(Token ***tokenp)
 	int status;
 
 	/* Work from a copy of the token stream in case something goes wrong */
-	Token **tokens = *tokenp;
+	TokenPosition tokens = *tokenp;
 
 #ifdef DEBUG
 	shiftout();
@@ -4100,6 +4562,12 @@ BlockNode *parseBlockNode(Token ***tokenp)
 		status = addStmtNode(stmts, stmt);
 		if (!status) goto parseBlockNodeAbort;
 		stmt = NULL;
+
+		/*
+		 * Statements are never reparsed once they have been parsed, so
+		 * the tokens before the next one are no longer needed.
+		 */
+		releaseStreamTokens(tokens.stream, tokens.index);
 	}
 
 #ifdef DEBUG
@@ -4130,20 +4598,30 @@ parseBlockNodeAbort: /* Exception handling */
 /**
  * Parses tokens into a main code block.
  *
- * \param [in] tokens The position in a token list to start parsing at.
+ * \param [in,out] stream The stream of tokens to parse.
  *
- * \post \a tokenp will point to the next unparsed token.
+ * \post The tokens of each statement parsed will have been released from
+ * \a stream.
  *
  * \return A pointer to a main node block.
  *
  * \retval NULL Unable to parse.
  */
-MainNode *parseMainNode(Token **tokens)
+MainNode *parseMainNode(TokenStream *stream)
 {
 	BlockNode *block = NULL;
 	MainNode *_main = NULL;
 	int status;
 
+	/* Start at the first token in the stream */
+	TokenPosition tokens;
+	tokens.stream = stream;
+	tokens.index = 0;
+
+	/* Allocate the parse tree from a single arena */
+	NodeArena = createMemoryArena();
+	if (!NodeArena) return NULL;
+
 	/* All programs must start with the HAI token */
 	status = acceptToken(&tokens, TT_HAI);
 	if (!status) {
@@ -4152,7 +4630,7 @@ MainNode *parseMainNode(Token **tokens)
 	}
 
 	/* Accept any version */
-	tokens++;
+	tokens.index++;
 
 #ifdef DEBUG
 	debug("ET_MAINBLOCK");
@@ -4180,13 +4658,17 @@ MainNode *parseMainNode(Token **tokens)
 	_main = createMainNode(block);
 	if (!_main) goto parseMainNodeAbort;
 
+	/* The parse tree is deleted along with its arena */
+	_main->arena = NodeArena;
+	NodeArena = NULL;
+
 	return _main;
 
 parseMainNodeAbort: /* In case something goes wrong... */
 
 	/* Clean up any allocated structures */
-	if (_main) deleteMainNode(_main);
-	else if (block) deleteBlockNode(block);
+	deleteMemoryArena(NodeArena);
+	NodeArena = NULL;
 
 	return NULL;
 }
@@ -209,9 +209,18 @@
 #include <float.h>
 
 #include "tokenizer.h"
+#include "memory.h"
 
 #undef DEBUG
 
+/**
+ * Stores a position in a token stream.
+ */
+typedef struct {
+	TokenStream *stream; /**< The stream of tokens being parsed. */
+	unsigned long index; /**< The index of the token within \a stream. */
+} TokenPosition;
+
 /**
  * Represents a statement type.
  */
@@ -236,8 +245,9 @@ typedef enum {
  * Stores statement data.
  */
 typedef struct {
-	StmtType type; /**< The type of statement in \a node. */
-	void *stmt;    /**< The statement. */
+	StmtType type;     /**< The type of statement in \a node. */
+	unsigned int line; /**< The line number the statement starts on (0 if unknown). */
+	void *stmt;        /**< The statement. */
 } StmtNode;
 
 /**
@@ -257,7 +267,8 @@ typedef enum {
 	ET_IDENTIFIER, /**< Identifier expression. */
 	ET_FUNCCALL,   /**< Function call expression. */
 	ET_OP,         /**< Operation expression. */
-	ET_IMPVAR      /**< \ref impvar "Implicit variable". */
+	ET_IMPVAR,     /**< \ref impvar "Implicit variable". */
+	ET_INVARIANT   /**< Loop invariant expression. */
 } ExprType;
 
 /**
@@ -293,6 +304,8 @@ typedef struct identifiernode {
 	char *fname;                 /**< The original file name. */
 	unsigned int line;           /**< The original line number. */
 	struct identifiernode *slot; /**< The slot to access. */
+	int depth;                   /**< The number of scopes up to the resolved variable (-1 if unresolved). */
+	unsigned int index;          /**< The index of the resolved variable in its scope. */
 } IdentifierNode;
 
 /**
@@ -339,22 +352,63 @@ typedef union {
 	char *s;     /**< String data. */
 } ConstantData;
 
+/**
+ * Represents the type of a string template segment.
+ */
+typedef enum {
+	SG_TEXT,     /**< Literal text with its escape sequences decoded. */
+	SG_VARIABLE, /**< A variable to interpolate. */
+	SG_IMPVAR    /**< The implicit variable to interpolate. */
+} SegmentType;
+
+/**
+ * Stores a string template segment.
+ */
+typedef struct {
+	SegmentType type;   /**< The type of segment. */
+	char *text;         /**< The literal text (for SG_TEXT). */
+	size_t length;      /**< The length of \a text. */
+	IdentifierNode *id; /**< The variable to interpolate (for SG_VARIABLE). */
+} TemplateSegment;
+
+/**
+ * Stores a string constant split into literal text and interpolated
+ * variables.  A string without variables is stored as a single text segment
+ * (or no segments if it is empty).
+ */
+typedef struct stringtemplate {
+	unsigned int num;       /**< The number of segments. */
+	TemplateSegment *segs;  /**< The segments, in order. */
+	size_t length;          /**< The total length of the literal text. */
+	int plain;              /**< Whether the string contains no escape sequences. */
+} StringTemplate;
+
 /**
  * Stores a constant.
  */
 typedef struct {
-	ConstantType type; /**< The type of constant in \a data. */
-	ConstantData data; /**< The constant. */
+	ConstantType type;     /**< The type of constant in \a data. */
+	ConstantData data;     /**< The constant. */
+	StringTemplate *tmpl;  /**< The template of string data (NULL if it could not be built). */
 } ConstantNode;
 
 /**
  * Stores a function definition statement.
+ *
+ * \note The \a names, \a numnames, \a created, and \a computed fields are
+ * filled in by resolveMainNode() to decide whether a call in tail position
+ * may reuse the scope of the function (see canReuseFuncScope()).
  */
 typedef struct {
 	IdentifierNode *scope;    /**< The scope of the function. */
 	IdentifierNode *name;     /**< The name of the function. */
 	IdentifierNodeList *args; /**< The names of the function arguments. */
 	BlockNode *body;          /**< The body of the function. */
+	unsigned int locals;      /**< The number of variables the body creates in its own scope, including its arguments. */
+	char **names;             /**< The interned names of the variables a call may create in its scope or scopes nested in it, starting with the arguments. */
+	unsigned int numnames;    /**< The number of names in \a names. */
+	unsigned int created;     /**< The number of leading names in \a names created before the body looks up any other variable. */
+	int computed;             /**< Whether a call may create variables whose names are computed during execution. */
 } FuncDefStmtNode;
 
 /**
@@ -371,9 +425,13 @@ typedef struct {
  *
  * \note This could be represented with just a BlockNode, but it seems
  * significant enough to merit its own structure.
+ *
+ * \note A parse tree created by parseMainNode() is allocated from \a arena and
+ * is deleted along with it.
  */
 typedef struct {
-	BlockNode *block; /**< The first block of code to execute. */
+	BlockNode *block;    /**< The first block of code to execute. */
+	MemoryArena *arena;  /**< The arena the parse tree was allocated from. */
 } MainNode;
 
 /**
@@ -447,37 +505,82 @@ typedef struct {
 	BlockNodeList *blocks; /**< The code to execute if a guard is true. */
 } IfThenElseStmtNode;
 
+/**
+ * Stores an entry of the jump table of a switch statement.
+ */
+typedef struct {
+	ConstantNode *guard; /**< The guard (NULL if the entry is empty). */
+	unsigned int index;  /**< The position of \a guard and its block. */
+} SwitchEntry;
+
 /**
  * Stores a switch statement.  This statement compares the value of the \ref
  * impvar "implicit variable" to each of the \a guards and executes the
  * respective block of code in \a blocks if they match.  If no matches are
  * found, the optional default block of code, \a def, is executed.
+ *
+ * Guards are unique constants, so all but \c NUMBAR guards, which match
+ * within an epsilon, are also stored in a hash table, \a table, to find the
+ * block to start at without testing each guard.
  */
 typedef struct {
 	ExprNodeList *guards;  /**< The expressions to evaluate. */
 	BlockNodeList *blocks; /**< The blocks of code to execute. */
 	BlockNode *def;        /**< An optional default block of code. */
+	SwitchEntry *table;    /**< The hashed guards (NULL if each guard must be tested). */
+	unsigned int size;     /**< The number of entries in \a table, a power of two. */
+	unsigned int floats;   /**< The number of \c NUMBAR guards, which are not hashed. */
 } SwitchStmtNode;
 
 /**
  * Stores a return statement.  This statement signals that control should be
  * returned to the caller with a status value.
+ *
+ * \note The \a func field is filled in by resolveMainNode() when \a value is
+ * a call in tail position of a function whose variables are all known, so
+ * that the call may reuse the scope of that function.
  */
 typedef struct {
-	ExprNode *value; /**< The value to return. */
+	ExprNode *value;       /**< The value to return. */
+	FuncDefStmtNode *func; /**< The function whose scope a call in \a value may reuse (NULL if none). */
 } ReturnStmtNode;
 
+/**
+ * Represents the way the guard of a counting loop compares its variable to
+ * its limit in order for the loop to continue.
+ */
+typedef enum {
+	LC_NONE, /**< The guard is not a simple comparison. */
+	LC_EQ,   /**< The variable equals the limit. */
+	LC_NEQ,  /**< The variable does not equal the limit. */
+	LC_LT,   /**< The variable is less than the limit. */
+	LC_LTE,  /**< The variable is less than or equal to the limit. */
+	LC_GT,   /**< The variable is greater than the limit. */
+	LC_GTE   /**< The variable is greater than or equal to the limit. */
+} LoopComparison;
+
 /**
  * Stores a loop statement.  This statement repeatedly executes its \a body
  * while \a guard evaluates to true, executing \a update at the end of each
  * cycle.
+ *
+ * \note The \a step, \a cmp, \a limit, and \a declares fields describe
+ * loops which count with \c UPPIN or \c NERFIN and are filled in by
+ * resolveMainNode() so that such loops may be executed without evaluating
+ * \a update and \a guard in the general way.  The \a invariants field is
+ * filled in by optimizeMainNode() for loops containing InvariantExprNodes.
  */
 typedef struct {
-	IdentifierNode *name; /**< The name of the loop. */
-	IdentifierNode *var;  /**< The variable to be updated. */
-	ExprNode *guard;      /**< The expression to determine continuation. */
-	ExprNode *update;     /**< The expression to update \a var with. */
-	BlockNode *body;      /**< The code to execute at each iteration. */
+	IdentifierNode *name;           /**< The name of the loop. */
+	IdentifierNode *var;            /**< The variable to be updated. */
+	ExprNode *guard;                /**< The expression to determine continuation. */
+	ExprNode *update;               /**< The expression to update \a var with. */
+	BlockNode *body;                /**< The code to execute at each iteration. */
+	int step;                       /**< The amount \a update adds to \a var (0 if it is not a count). */
+	LoopComparison cmp;             /**< How \a guard compares \a var to \a limit. */
+	ExprNode *limit;                /**< The part of \a guard \a var is compared to. */
+	int declares;                   /**< Whether \a body may declare variables in its own scope. */
+	IdentifierNodeList *invariants; /**< The hidden variables holding the values of the invariants of the loop, created after \a var (NULL if none). */
 } LoopStmtNode;
 
 /**
@@ -497,14 +600,33 @@ typedef struct {
 	TypeNode *newtype; /**< The type to cast \a target to. */
 } CastExprNode;
 
+/**
+ * Stores a loop invariant expression.  This expression evaluates an
+ * expression whose value does not change while a loop executes the first time
+ * it is needed during each execution of the loop, and evaluates to the same
+ * value from then on, which the loop holds in a hidden variable.
+ *
+ * \note Loop invariant expressions are created by optimizeMainNode() and are
+ * never written to the cache.
+ */
+typedef struct {
+	ExprNode *expr;     /**< The invariant expression. */
+	IdentifierNode *id; /**< The hidden variable holding the value of \a expr. */
+} InvariantExprNode;
+
 /**
  * Stores a function call expression.  This expression calls a named function
  * and evaluates to the return value of that function.
+ *
+ * \note The \a index field is filled in by resolveMainNode() for functions
+ * which can only ever be found in the outermost scope, so that calling them
+ * need not search every scope in between.
  */
 typedef struct {
 	IdentifierNode *scope; /**< The scope to call the function in. */
 	IdentifierNode *name;  /**< The name of the function to call. */
 	ExprNodeList *args;    /**< The arguments to supply the function. */
+	int index;             /**< The position of the function in the outermost scope (-1 if not known). */
 } FuncCallExprNode;
 
 /**
@@ -667,6 +789,8 @@ void deleteIfThenElseStmtNode(IfThenElseStmtNode *);
 /**@{*/
 SwitchStmtNode *createSwitchStmtNode(ExprNodeList *, BlockNodeList *, BlockNode *);
 void deleteSwitchStmtNode(SwitchStmtNode *);
+int indexSwitchStmtNode(SwitchStmtNode *);
+unsigned int hashSwitchKey(ConstantType, long long, const char *, size_t);
 /**@}*/
 
 /**
@@ -762,15 +886,27 @@ OpExprNode *createOpExprNode(OpType, ExprNodeList *);
 void deleteOpExprNode(OpExprNode *);
 /**@}*/
 
+/**
+ * \name InvariantExprNode modifiers
+ *
+ * Functions for creating and deleting InvariantExprNodes.
+ */
+/**@{*/
+InvariantExprNode *createInvariantExprNode(ExprNode *, IdentifierNode *);
+void deleteInvariantExprNode(InvariantExprNode *);
+/**@}*/
+
 /**
  * \name Utilities
  *
  * Functions for performing helper tasks.
  */
 /**@{*/
-int acceptToken(Token ***, TokenType);
-int peekToken(Token ***, TokenType);
-int nextToken(Token ***, TokenType);
+void setNodeArena(MemoryArena *);
+Token *getToken(TokenPosition);
+int acceptToken(TokenPosition *, TokenType);
+int peekToken(TokenPosition *, TokenType);
+int nextToken(TokenPosition *, TokenType);
 /**@}*/
 
 /**
@@ -779,31 +915,31 @@ int nextToken(Token ***, TokenType);
  * Functions for parsing a stream of tokens.
  */
 /**@{*/
-ConstantNode *parseConstantNode(Token ***);
-TypeNode *parseTypeNode(Token ***);
-IdentifierNode *parseIdentifierNode(Token ***);
-ExprNode *parseExprNode(Token ***);
-StmtNode *parseStmtNode(Token ***);
-BlockNode *parseBlockNode(Token ***);
-MainNode *parseMainNode(Token **);
-ExprNode *parseCastExprNode(Token ***);
-ExprNode *parseConstantExprNode(Token ***);
-ExprNode *parseIdentifierExprNode(Token ***);
-ExprNode *parseFuncCallExprNode(Token ***);
-ExprNode *parseOpExprNode(Token ***);
-StmtNode *parseCastStmtNode(Token ***);
-StmtNode *parsePrintStmtNode(Token ***);
-StmtNode *parseInputStmtNode(Token ***);
-StmtNode *parseAssignmentStmtNode(Token ***);
-StmtNode *parseDeclarationStmtNode(Token ***);
-StmtNode *parseIfThenElseStmtNode(Token ***);
-StmtNode *parseSwitchStmtNode(Token ***);
-StmtNode *parseBreakStmtNode(Token ***);
-StmtNode *parseReturnStmtNode(Token ***);
-StmtNode *parseLoopStmtNode(Token ***);
-StmtNode *parseDeallocationStmtNode(Token ***);
-StmtNode *parseFuncDefStmtNode(Token ***);
-StmtNode *parseAltArrayDefStmtNode(Token ***);
+ConstantNode *parseConstantNode(TokenPosition *);
+TypeNode *parseTypeNode(TokenPosition *);
+IdentifierNode *parseIdentifierNode(TokenPosition *);
+ExprNode *parseExprNode(TokenPosition *);
+StmtNode *parseStmtNode(TokenPosition *);
+BlockNode *parseBlockNode(TokenPosition *);
+MainNode *parseMainNode(TokenStream *);
+ExprNode *parseCastExprNode(TokenPosition *);
+ExprNode *parseConstantExprNode(TokenPosition *);
+ExprNode *parseIdentifierExprNode(TokenPosition *);
+ExprNode *parseFuncCallExprNode(TokenPosition *);
+ExprNode *parseOpExprNode(TokenPosition *);
+StmtNode *parseCastStmtNode(TokenPosition *);
+StmtNode *parsePrintStmtNode(TokenPosition *);
+StmtNode *parseInputStmtNode(TokenPosition *);
+StmtNode *parseAssignmentStmtNode(TokenPosition *);
+StmtNode *parseDeclarationStmtNode(TokenPosition *);
+StmtNode *parseIfThenElseStmtNode(TokenPosition *);
+StmtNode *parseSwitchStmtNode(TokenPosition *);
+StmtNode *parseBreakStmtNode(TokenPosition *);
+StmtNode *parseReturnStmtNode(TokenPosition *);
+StmtNode *parseLoopStmtNode(TokenPosition *);
+StmtNode *parseDeallocationStmtNode(TokenPosition *);
+StmtNode *parseFuncDefStmtNode(TokenPosition *);
+StmtNode *parseAltArrayDefStmtNode(TokenPosition *);
 /**@}*/
 
 /**
@@ -819,4 +955,14 @@ ConstantNode *createStringConstantNode(char *);
 void deleteConstantNode(ConstantNode *);
 /**@}*/
 
+/**
+ * \name StringTemplate modifiers
+ *
+ * Functions for creating and deleting StringTemplate.
+ */
+/**@{*/
+StringTemplate *createStringTemplate(const char *);
+void deleteStringTemplate(StringTemplate *);
+/**@}*/
+
 #endif /* __PARSER_H__ */
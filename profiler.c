@@ -0,0 +1,449 @@
+#include "profiler.h"
+
+#include <string.h>
+#include <time.h>
+
+/**
+ * Gets the current time.
+ *
+ * \return A number of nanoseconds since some fixed point in the past.
+ */
+static unsigned long long getProfileTime(void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (unsigned long long)now.tv_sec * 1000000000ull
+			+ (unsigned long long)now.tv_nsec;
+#else
+	return (unsigned long long)((double)clock() * 1e9 / CLOCKS_PER_SEC);
+#endif
+}
+
+/**
+ * Charges the time since the last count to the line and function being
+ * executed.
+ *
+ * \param [in,out] p The profile to update.
+ */
+static void chargeProfile(Profile *p)
+{
+	unsigned long long now = getProfileTime();
+	unsigned long long elapsed = now - p->last;
+	p->lines[p->line].self += elapsed;
+	p->frame->self += elapsed;
+	if (p->frame->func) p->frame->func->self += elapsed;
+	p->last = now;
+}
+
+/**
+ * Creates a frame.
+ *
+ * \param [in] func The function called (NULL for the main block).
+ *
+ * \param [in] parent The frame the call is made from (NULL for the main
+ * block).
+ *
+ * \return A pointer to a frame with no counts.
+ *
+ * \retval NULL malloc was unable to allocate memory.
+ */
+static ProfileFrame *createProfileFrame(ProfileFunction *func,
+                                        ProfileFrame *parent)
+{
+	ProfileFrame *p = malloc(sizeof(ProfileFrame));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->func = func;
+	p->self = 0;
+	p->parent = parent;
+	p->children = NULL;
+	p->next = NULL;
+	return p;
+}
+
+/**
+ * Creates a profile.  The time between its creation and the first statement
+ * executed is not charged to any line.
+ *
+ * \param [in] fname The name of the file being profiled.
+ *
+ * \return A pointer to an empty profile.
+ *
+ * \retval NULL malloc was unable to allocate memory.
+ */
+Profile *createProfile(const char *fname)
+{
+	Profile *p = malloc(sizeof(Profile));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->fname = malloc(sizeof(char) * (strlen(fname) + 1));
+	if (!p->fname) {
+		perror("malloc");
+		free(p);
+		return NULL;
+	}
+	strcpy(p->fname, fname);
+	/* Line 0 holds the time not spent in any statement */
+	p->size = 64;
+	p->lines = calloc(p->size, sizeof(ProfileLine));
+	if (!p->lines) {
+		perror("calloc");
+		free(p->fname);
+		free(p);
+		return NULL;
+	}
+	p->line = 0;
+	p->funcs = NULL;
+	p->root = createProfileFrame(NULL, NULL);
+	if (!p->root) {
+		free(p->lines);
+		free(p->fname);
+		free(p);
+		return NULL;
+	}
+	p->frame = p->root;
+	p->start = p->last = getProfileTime();
+	return p;
+}
+
+/**
+ * Deletes a profile.
+ *
+ * \param [in,out] p The profile to delete.
+ *
+ * \post The memory at \a p and all of its members will be freed.
+ */
+void deleteProfile(Profile *p)
+{
+	ProfileFrame *frame = NULL;
+	if (!p) return;
+	/* Free the frames without recursing, as call stacks may be deep */
+	frame = p->root;
+	while (frame) {
+		ProfileFrame *child = frame->children;
+		if (child) {
+			frame->children = child->next;
+			frame = child;
+		}
+		else {
+			ProfileFrame *parent = frame->parent;
+			free(frame);
+			frame = parent;
+		}
+	}
+	while (p->funcs) {
+		ProfileFunction *next = p->funcs->next;
+		free(p->funcs);
+		p->funcs = next;
+	}
+	free(p->lines);
+	free(p->fname);
+	free(p);
+}
+
+/**
+ * Starts counting a statement.
+ *
+ * \param [in,out] p The profile to update.
+ *
+ * \param [in] line The line the statement starts on.
+ *
+ * \param [out] prev The line which was being executed before, to be passed
+ * to leaveProfileLine() once the statement finishes.
+ *
+ * \return Whether the statement could be counted.
+ *
+ * \retval 0 realloc was unable to allocate memory.
+ *
+ * \retval 1 The statement was counted.
+ */
+int enterProfileLine(Profile *p,
+                     unsigned int line,
+                     unsigned int *prev)
+{
+	chargeProfile(p);
+	if (line >= p->size) {
+		unsigned int size = p->size;
+		ProfileLine *mem = NULL;
+		while (size <= line) size *= 2;
+		mem = realloc(p->lines, sizeof(ProfileLine) * size);
+		if (!mem) {
+			perror("realloc");
+			return 0;
+		}
+		memset(mem + p->size, 0, sizeof(ProfileLine) * (size - p->size));
+		p->lines = mem;
+		p->size = size;
+	}
+	*prev = p->line;
+	p->line = line;
+	p->lines[line].count++;
+	return 1;
+}
+
+/**
+ * Stops counting a statement.
+ *
+ * \param [in,out] p The profile to update.
+ *
+ * \param [in] prev The line set by the matching call to enterProfileLine().
+ */
+void leaveProfileLine(Profile *p,
+                      unsigned int prev)
+{
+	chargeProfile(p);
+	p->line = prev;
+}
+
+/**
+ * Starts counting a call to a function.
+ *
+ * \param [in,out] p The profile to update.
+ *
+ * \param [in] func The definition of the function called.
+ *
+ * \return Whether the call could be counted.
+ *
+ * \retval 0 malloc was unable to allocate memory.
+ *
+ * \retval 1 The call was counted.
+ */
+int enterProfileFunction(Profile *p,
+                         FuncDefStmtNode *func)
+{
+	ProfileFrame *frame = NULL;
+	ProfileFunction *f = NULL;
+	chargeProfile(p);
+	for (frame = p->frame->children; frame; frame = frame->next)
+		if (frame->func->func == func) break;
+	if (!frame) {
+		for (f = p->funcs; f; f = f->next)
+			if (f->func == func) break;
+		if (!f) {
+			f = malloc(sizeof(ProfileFunction));
+			if (!f) {
+				perror("malloc");
+				return 0;
+			}
+			f->func = func;
+			f->calls = 0;
+			f->self = 0;
+			f->total = 0;
+			f->start = 0;
+			f->depth = 0;
+			f->next = p->funcs;
+			p->funcs = f;
+		}
+		frame = createProfileFrame(f, p->frame);
+		if (!frame) return 0;
+		frame->next = p->frame->children;
+		p->frame->children = frame;
+	}
+	f = frame->func;
+	f->calls++;
+	if (f->depth++ == 0) f->start = p->last;
+	p->frame = frame;
+	return 1;
+}
+
+/**
+ * Stops counting the call made by the matching call to
+ * enterProfileFunction().
+ *
+ * \param [in,out] p The profile to update.
+ */
+void leaveProfileFunction(Profile *p)
+{
+	ProfileFunction *f = NULL;
+	chargeProfile(p);
+	f = p->frame->func;
+	if (--f->depth == 0) f->total += p->last - f->start;
+	p->frame = p->frame->parent;
+}
+
+/**
+ * Prints the name of a function.  Functions defined in an object are prefixed
+ * by the name of the object.
+ *
+ * \param [in] func The function to print the name of.
+ *
+ * \param [in] file The file to print to.
+ */
+static void printProfileFunctionName(ProfileFunction *func,
+                                     FILE *file)
+{
+	IdentifierNode *scope = func->func->scope;
+	IdentifierNode *name = func->func->name;
+	if (scope->type == IT_DIRECT && strcmp(scope->id, "I"))
+		fprintf(file, "%s'Z ", (char *)scope->id);
+	fprintf(file, "%s:%u",
+			name->type == IT_DIRECT ? (char *)name->id : "SRS",
+			name->line);
+}
+
+/**
+ * Orders functions by decreasing self time, for use with qsort().
+ *
+ * \param [in] a A pointer to the first function.
+ *
+ * \param [in] b A pointer to the second function.
+ *
+ * \return A negative number, zero, or a positive number if the function at
+ * \a a should come before, with, or after the one at \a b.
+ */
+static int compareProfileFunctions(const void *a,
+                                   const void *b)
+{
+	const ProfileFunction *x = *(ProfileFunction *const *)a;
+	const ProfileFunction *y = *(ProfileFunction *const *)b;
+	if (x->self != y->self) return x->self < y->self ? 1 : -1;
+	if (x->func->name->line != y->func->name->line)
+		return x->func->name->line < y->func->name->line ? -1 : 1;
+	return 0;
+}
+
+/**
+ * Stores a line being reported.
+ */
+typedef struct {
+	unsigned int line;         /**< The line number. */
+	const ProfileLine *counts; /**< The counts of the line. */
+} ProfileLineEntry;
+
+/**
+ * Orders lines by decreasing self time, for use with qsort().
+ *
+ * \param [in] a A pointer to the first line.
+ *
+ * \param [in] b A pointer to the second line.
+ *
+ * \return A negative number, zero, or a positive number if the line at \a a
+ * should come before, with, or after the one at \a b.
+ */
+static int compareProfileLines(const void *a,
+                               const void *b)
+{
+	const ProfileLineEntry *x = a;
+	const ProfileLineEntry *y = b;
+	if (x->counts->self != y->counts->self)
+		return x->counts->self < y->counts->self ? 1 : -1;
+	return x->line < y->line ? -1 : (x->line > y->line ? 1 : 0);
+}
+
+/**
+ * Prints a flat report of a profile: every function which was called and
+ * every line which was executed, in order of decreasing self time.
+ *
+ * \param [in] p The profile to report.
+ *
+ * \param [in] file The file to print to.
+ */
+void printProfile(Profile *p,
+                  FILE *file)
+{
+	ProfileFunction **funcs = NULL;
+	ProfileFunction *f = NULL;
+	ProfileLineEntry *lines = NULL;
+	unsigned int numfuncs = 0;
+	unsigned int numlines = 0;
+	unsigned int n;
+	for (f = p->funcs; f; f = f->next) numfuncs++;
+	for (n = 1; n < p->size; n++)
+		if (p->lines[n].count) numlines++;
+	if (numfuncs && !(funcs = malloc(sizeof(ProfileFunction *) * numfuncs))) {
+		perror("malloc");
+		return;
+	}
+	if (numlines && !(lines = malloc(sizeof(ProfileLineEntry) * numlines))) {
+		perror("malloc");
+		free(funcs);
+		return;
+	}
+	for (n = 0, f = p->funcs; f; f = f->next) funcs[n++] = f;
+	for (n = 1, numlines = 0; n < p->size; n++) {
+		if (!p->lines[n].count) continue;
+		lines[numlines].line = n;
+		lines[numlines++].counts = &p->lines[n];
+	}
+	if (numfuncs)
+		qsort(funcs, numfuncs, sizeof(ProfileFunction *), compareProfileFunctions);
+	if (numlines)
+		qsort(lines, numlines, sizeof(ProfileLineEntry), compareProfileLines);
+
+	fprintf(file, "Profile of %s: %.3f ms\n\n", p->fname,
+			(double)(p->last - p->start) / 1e6);
+	fprintf(file, "%12s %12s %12s  %s\n", "calls", "self ms", "total ms", "function");
+	fprintf(file, "%12u %12.3f %12.3f  %s\n", 1, (double)p->root->self / 1e6,
+			(double)(p->last - p->start) / 1e6, "(main)");
+	for (n = 0; n < numfuncs; n++) {
+		fprintf(file, "%12llu %12.3f %12.3f  ", funcs[n]->calls,
+				(double)funcs[n]->self / 1e6,
+				(double)funcs[n]->total / 1e6);
+		printProfileFunctionName(funcs[n], file);
+		fputc('\n', file);
+	}
+	fprintf(file, "\n%12s %12s %12s\n", "line", "count", "self ms");
+	for (n = 0; n < numlines; n++)
+		fprintf(file, "%12u %12llu %12.3f\n", lines[n].line,
+				lines[n].counts->count,
+				(double)lines[n].counts->self / 1e6);
+	free(lines);
+	free(funcs);
+}
+
+/**
+ * Prints the call stack leading to a frame, from the outermost call inwards
+ * and separated by semicolons.
+ *
+ * \param [in] p The profile containing \a frame.
+ *
+ * \param [in] frame The frame to print the stack of.
+ *
+ * \param [in] file The file to print to.
+ */
+static void printProfileStack(Profile *p,
+                              ProfileFrame *frame,
+                              FILE *file)
+{
+	if (!frame->parent) {
+		fputs(p->fname, file);
+		return;
+	}
+	printProfileStack(p, frame->parent, file);
+	fputc(';', file);
+	printProfileFunctionName(frame->func, file);
+}
+
+/**
+ * Prints a profile as collapsed call stacks.  Each line holds a call stack,
+ * starting from the main block (named after the file being profiled), and
+ * the self time of its innermost call in microseconds.  Stacks with less than
+ * a microsecond of self time are left out.
+ *
+ * \param [in] p The profile to report.
+ *
+ * \param [in] file The file to print to.
+ */
+void printProfileStacks(Profile *p,
+                        FILE *file)
+{
+	ProfileFrame *frame = p->root;
+	while (frame) {
+		if (frame->self >= 1000) {
+			printProfileStack(p, frame, file);
+			fprintf(file, " %llu\n", frame->self / 1000);
+		}
+		/* Visit the frames depth first */
+		if (frame->children)
+			frame = frame->children;
+		else {
+			while (frame && !frame->next) frame = frame->parent;
+			if (frame) frame = frame->next;
+		}
+	}
+}
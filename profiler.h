@@ -0,0 +1,96 @@
+/**
+ * Structures and functions for profiling programs.  While a profile is active,
+ * the interpreter counts how many times each line of the program is executed
+ * and how many times each function is called, and charges the time between
+ * two consecutive statements to the innermost line and function executing at
+ * the time.  The times of a line or function therefore do not include the
+ * time spent in the statements and functions it runs (its \e self time);
+ * functions additionally record their \e total time, from the start of their
+ * outermost call to its end.
+ *
+ * Profiles are reported either as a flat list of the most expensive functions
+ * and lines, or as collapsed call stacks, one stack and its self time per
+ * line, which may be turned into a flame graph by tools such as
+ * flamegraph.pl.
+ *
+ * \file   profiler.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parser.h"
+
+/**
+ * Stores the counts of a line.
+ */
+typedef struct {
+	unsigned long long count; /**< The number of statements executed on the line. */
+	unsigned long long self;  /**< The time spent on the line, in nanoseconds. */
+} ProfileLine;
+
+/**
+ * Stores the counts of a function.
+ */
+typedef struct profilefunction {
+	FuncDefStmtNode *func;        /**< The definition of the function. */
+	unsigned long long calls;     /**< The number of calls made to the function. */
+	unsigned long long self;      /**< The time spent in the function's own statements, in nanoseconds. */
+	unsigned long long total;     /**< The time spent in the function and those it calls, in nanoseconds. */
+	unsigned long long start;     /**< The time the outermost active call started. */
+	unsigned int depth;           /**< The number of active calls. */
+	struct profilefunction *next; /**< The next function of the same profile. */
+} ProfileFunction;
+
+/**
+ * Stores the counts of one call stack.  Each frame is a distinct path of
+ * calls from the main block, so a function called from two places has two
+ * frames.
+ */
+typedef struct profileframe {
+	ProfileFunction *func;         /**< The function called (NULL for the main block). */
+	unsigned long long self;       /**< The time spent in the function's own statements, in nanoseconds. */
+	struct profileframe *parent;   /**< The frame the call was made from (NULL for the main block). */
+	struct profileframe *children; /**< The first frame called from this one. */
+	struct profileframe *next;     /**< The next frame called from \a parent. */
+} ProfileFrame;
+
+/**
+ * Stores the profile of a program.
+ */
+typedef struct {
+	char *fname;              /**< The name of the file being profiled. */
+	ProfileLine *lines;       /**< The counts of each line, by line number. */
+	unsigned int size;        /**< The number of entries in \a lines. */
+	unsigned int line;        /**< The line being executed (0 for none). */
+	ProfileFunction *funcs;   /**< The functions called so far. */
+	ProfileFrame *root;       /**< The frame of the main block. */
+	ProfileFrame *frame;      /**< The frame being executed. */
+	unsigned long long last;  /**< The time the last count was made. */
+	unsigned long long start; /**< The time the profile was created. */
+} Profile;
+
+/**
+ * \name Profile modifiers
+ *
+ * Functions for creating, updating, and reporting profiles.
+ */
+/**@{*/
+Profile *createProfile(const char *);
+void deleteProfile(Profile *);
+int enterProfileLine(Profile *, unsigned int, unsigned int *);
+void leaveProfileLine(Profile *, unsigned int);
+int enterProfileFunction(Profile *, FuncDefStmtNode *);
+void leaveProfileFunction(Profile *);
+void printProfile(Profile *, FILE *);
+void printProfileStacks(Profile *, FILE *);
+/**@}*/
+
+#endif /* __PROFILER_H__ */
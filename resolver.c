@@ -0,0 +1,1262 @@
+#include "resolver.h"
+
+#include <stdint.h>
+
+/**
+ * The number of entries a resolver table starts with once a key is added.
+ */
+#define RESOLVER_TABLE_SIZE 16
+
+static int resolveExprNode(Resolver *, ExprNode *);
+static int resolveStmtNodeList(Resolver *, StmtNodeList *);
+
+/**
+ * Hashes the key of a resolver table entry.  Keys, such as interned names, are
+ * identified by their addresses, so their addresses are hashed.
+ *
+ * \param [in] key The key to hash.
+ *
+ * \return The hash of \a key.
+ */
+static unsigned int hashResolverKey(const void *key)
+{
+	uintptr_t p = (uintptr_t)key;
+	return (unsigned int)((p >> 3) ^ (p >> 17)) * 2654435761u;
+}
+
+/**
+ * Finds the entry of a resolver table holding a key, or the empty entry the
+ * key would be added to.
+ *
+ * \param [in] table The table to search.
+ *
+ * \param [in] key The key to find.
+ *
+ * \pre \a table has at least one empty entry.
+ *
+ * \return The entry holding \a key, or an empty entry if \a table does not
+ * contain \a key.
+ */
+static ResolverEntry *findResolverEntry(const ResolverTable *table,
+                                        const void *key)
+{
+	unsigned int mask = table->size - 1;
+	unsigned int h = hashResolverKey(key) & mask;
+	while (table->entries[h].key && table->entries[h].key != key)
+		h = (h + 1) & mask;
+	return &table->entries[h];
+}
+
+/**
+ * Gets the value stored for a key in a resolver table.
+ *
+ * \param [in] table The table to search.
+ *
+ * \param [in] key The key to find.
+ *
+ * \param [out] value The value stored for \a key, if it is found.
+ *
+ * \retval 0 \a table does not contain \a key.
+ *
+ * \retval 1 \a value was set.
+ */
+static int getResolverValue(const ResolverTable *table,
+                            const void *key,
+                            unsigned int *value)
+{
+	ResolverEntry *entry = NULL;
+	if (!table->size) return 0;
+	entry = findResolverEntry(table, key);
+	if (!entry->key) return 0;
+	*value = entry->value;
+	return 1;
+}
+
+/**
+ * Doubles the number of entries in a resolver table.
+ *
+ * \param [in,out] table The table to grow.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 \a table was grown.
+ */
+static int growResolverTable(ResolverTable *table)
+{
+	ResolverTable grown;
+	unsigned int n;
+	grown.num = table->num;
+	grown.size = table->size ? table->size * 2 : RESOLVER_TABLE_SIZE;
+	grown.entries = calloc(grown.size, sizeof(ResolverEntry));
+	if (!grown.entries) {
+		perror("calloc");
+		return 0;
+	}
+	for (n = 0; n < table->size; n++) {
+		if (table->entries[n].key)
+			*findResolverEntry(&grown, table->entries[n].key) = table->entries[n];
+	}
+	free(table->entries);
+	*table = grown;
+	return 1;
+}
+
+/**
+ * Adds a key to a resolver table unless it is already there.
+ *
+ * \param [in,out] table The table to add to.
+ *
+ * \param [in] key The key to add.
+ *
+ * \param [in] value The value to store if \a key is new.
+ *
+ * \return A pointer to the value stored for \a key, which is \a value if
+ * \a key was not already in \a table.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static unsigned int *addResolverValue(ResolverTable *table,
+                                      const void *key,
+                                      unsigned int value)
+{
+	ResolverEntry *entry = NULL;
+	/* Keep the table at most half full */
+	if ((table->num + 1) * 2 > table->size && !growResolverTable(table))
+		return NULL;
+	entry = findResolverEntry(table, key);
+	if (!entry->key) {
+		entry->key = key;
+		entry->value = value;
+		table->num++;
+	}
+	return &entry->value;
+}
+
+/**
+ * Creates a resolver scope.  While annotating, the scope is dynamic if the
+ * first pass found that variables with unknown names may be created in it.
+ *
+ * \param [in] r The resolver state.
+ *
+ * \param [in] parent The optional enclosing scope.
+ *
+ * \param [in] node The parse tree node the scope is created for.
+ *
+ * \return An empty scope with parent \a parent.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static ResolverScope *createResolverScope(Resolver *r,
+                                          ResolverScope *parent,
+                                          const void *node)
+{
+	unsigned int n;
+	ResolverScope *p = malloc(sizeof(ResolverScope));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->parent = parent;
+	p->node = node;
+	p->numvals = 0;
+	p->names.num = 0;
+	p->names.size = 0;
+	p->names.entries = NULL;
+	p->dynamic = 0;
+	p->known = 0;
+	if (!r->annotate) return p;
+	if (getResolverValue(&r->unnamed, node, &n)) {
+		p->dynamic = 1;
+		p->known = n;
+	}
+	if (r->me && getResolverValue(&r->calls, node, &n)
+			&& (!p->dynamic || n < p->known)) {
+		p->dynamic = 1;
+		p->known = n;
+	}
+	return p;
+}
+
+/**
+ * Deletes a resolver scope.
+ *
+ * \param [in,out] scope The scope to delete.
+ *
+ * \post The memory at \a scope and any of its members will be freed.
+ */
+static void deleteResolverScope(ResolverScope *scope)
+{
+	if (!scope) return;
+	free(scope->names.entries);
+	free(scope);
+}
+
+/**
+ * Checks whether an identifier names the scope currently being executed.
+ *
+ * \param [in] id The identifier to check.
+ *
+ * \retval 0 \a id does not name the current scope.
+ *
+ * \retval 1 \a id names the current scope.
+ */
+static int isCurrentScope(IdentifierNode *id)
+{
+	return id->type == IT_DIRECT && !id->slot && !strcmp(id->id, "I");
+}
+
+/**
+ * Records on the first pass of the resolver that variables whose names are not
+ * known before execution may be created in the current scope from this point
+ * on.  Such variables may shadow any variable found beyond the scope, or one
+ * created in it later under the same name, so identifiers are not annotated
+ * with those positions.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] table The table to record the current scope in.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The scope was recorded.
+ */
+static int shadowCurrentScope(Resolver *r,
+                              ResolverTable *table)
+{
+	if (r->annotate) return 1;
+	return addResolverValue(table, r->scope->node, r->scope->numvals) != NULL;
+}
+
+/**
+ * Records the variables a declaration in another scope may create under
+ * names which are not known before execution.  \c ME names the scope of the
+ * object a function is called on, or, outside of functions, the current
+ * scope.  Functions called through \c I are called on the scope they are
+ * called from, so a variable created through \c ME may also appear in the
+ * scope of code outside of functions which calls a function (see
+ * resolveExprNode()).  A computed scope name may name either.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in] scope The identifier of the scope the declaration is made in.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The declaration was recorded.
+ */
+static int shadowDeclarationScope(Resolver *r,
+                                  IdentifierNode *scope)
+{
+	if (scope->type == IT_INDIRECT) {
+		r->me = 1;
+		return shadowCurrentScope(r, &r->unnamed);
+	}
+	if (!strcmp(scope->id, "ME")) {
+		r->me = 1;
+		if (!r->function) return shadowCurrentScope(r, &r->unnamed);
+	}
+	return 1;
+}
+
+/**
+ * Annotates a direct identifier with the position of the variable it names,
+ * if the variable is known to exist at this point of the parse tree.
+ *
+ * \param [in] r The resolver state.
+ *
+ * \param [in,out] id The identifier to annotate.
+ *
+ * \post If the variable named by \a id is known, \a id will store the number
+ * of scopes up to the variable and its index within that scope.
+ */
+static void annotateIdentifierNode(Resolver *r,
+                                   IdentifierNode *id)
+{
+	ResolverScope *scope = NULL;
+	int depth = 0;
+	if (!r->annotate || id->type != IT_DIRECT) return;
+	/* The special scope identifiers are never stored in a scope */
+	if (!strcmp(id->id, "I") || !strcmp(id->id, "ME")) return;
+	for (scope = r->scope; scope; scope = scope->parent, depth++) {
+		unsigned int n;
+		if (getResolverValue(&scope->names, id->id, &n)) {
+			if (scope->dynamic && n >= scope->known) return;
+			id->depth = depth;
+			id->index = n;
+			return;
+		}
+		if (scope->dynamic) return;
+	}
+}
+
+/**
+ * Resolves an identifier.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] id The identifier to resolve.
+ *
+ * \param [in] lookup Whether \a id is looked up starting from the current
+ * scope (rather than from an array or a newly created scope).
+ *
+ * \retval 0 An error occurred while resolving \a id.
+ *
+ * \retval 1 \a id was resolved.
+ */
+static int resolveIdentifierNode(Resolver *r,
+                                 IdentifierNode *id,
+                                 int lookup)
+{
+	IdentifierNode *node = NULL;
+	if (lookup) annotateIdentifierNode(r, id);
+	/* Indirect names are always evaluated under the current scope */
+	for (node = id; node; node = node->slot) {
+		if (node->type == IT_INDIRECT
+				&& !resolveExprNode(r, node->id))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Counts a declaration of a name, in any scope, on the first pass of the
+ * resolver.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in] id The identifier of the new variable.
+ *
+ * \param [in] index The position of the new variable in the outermost scope
+ * (-1 if it is created elsewhere).
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The declaration was counted.
+ */
+static int countDeclaration(Resolver *r,
+                            IdentifierNode *id,
+                            int index)
+{
+	unsigned int *n = NULL;
+	if (r->annotate) return 1;
+	/* The variable is named by the last identifier */
+	while (id->slot) id = id->slot;
+	if (id->type != IT_DIRECT) {
+		r->computed = 1;
+		return 1;
+	}
+	n = addResolverValue(&r->declpos, id->id, r->numdecls);
+	if (!n) return 0;
+	if (*n < r->numdecls) {
+		r->decls[*n].count++;
+		r->decls[*n].index = -1;
+		return 1;
+	}
+	if (r->numdecls == r->declsize) {
+		unsigned int size = r->declsize ? r->declsize * 2 : RESOLVER_TABLE_SIZE;
+		void *mem = realloc(r->decls, sizeof(ResolverName) * size);
+		if (!mem) {
+			perror("realloc");
+			return 0;
+		}
+		r->decls = mem;
+		r->declsize = size;
+	}
+	r->decls[r->numdecls].name = id->id;
+	r->decls[r->numdecls].count = 1;
+	r->decls[r->numdecls].index = index;
+	r->numdecls++;
+	return 1;
+}
+
+/**
+ * Resolves an identifier naming a new variable in the current scope.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] id The identifier of the new variable.
+ *
+ * \post The name of \a id will be added to the current scope.
+ *
+ * \retval 0 An error occurred while resolving \a id.
+ *
+ * \retval 1 \a id was resolved.
+ */
+static int declareIdentifierNode(Resolver *r,
+                                 IdentifierNode *id)
+{
+	ResolverScope *scope = r->scope;
+	unsigned int *index = NULL;
+	if (!resolveIdentifierNode(r, id, 0)) return 0;
+	/* A name computed during execution may shadow any other name */
+	if (id->type != IT_DIRECT || id->slot) {
+		/* The variable may also be created through ME */
+		if (id->slot) r->me = 1;
+		if (!shadowCurrentScope(r, &r->unnamed)) return 0;
+		return countDeclaration(r, id, -1);
+	}
+	if (!countDeclaration(r, id, scope == r->global ? (int)scope->numvals : -1))
+		return 0;
+	/* Look-ups find the first variable with a name */
+	index = addResolverValue(&scope->names, id->id, scope->numvals);
+	if (!index) return 0;
+	if (r->annotate && !(scope->dynamic && *index >= scope->known)) {
+		id->depth = 0;
+		id->index = *index;
+	}
+	scope->numvals++;
+	return 1;
+}
+
+/**
+ * Annotates a function call with the position of its function in the
+ * outermost scope if that is the only place a variable with its name is ever
+ * declared.  Any variable found before the outermost scope would otherwise
+ * need to have been declared as well, so a call annotated this way finds its
+ * function without searching the scopes in between.
+ *
+ * \param [in] r The resolver state.
+ *
+ * \param [in,out] expr The function call to annotate.
+ */
+static void annotateFuncCallExprNode(Resolver *r,
+                                     FuncCallExprNode *expr)
+{
+	unsigned int n;
+	if (!r->annotate || r->computed || !isCurrentScope(expr->scope)
+			|| expr->name->type != IT_DIRECT || expr->name->slot)
+		return;
+	if (getResolverValue(&r->declpos, expr->name->id, &n)
+			&& r->decls[n].count == 1)
+		expr->index = r->decls[n].index;
+}
+
+/**
+ * Resolves a list of expressions.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] list The expressions to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a list.
+ *
+ * \retval 1 \a list was resolved.
+ */
+static int resolveExprNodeList(Resolver *r,
+                               ExprNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!resolveExprNode(r, list->exprs[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Resolves an expression.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] node The expression to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a node.
+ *
+ * \retval 1 \a node was resolved.
+ */
+static int resolveExprNode(Resolver *r,
+                           ExprNode *node)
+{
+	switch (node->type) {
+		case ET_CAST:
+			return resolveExprNode(r, ((CastExprNode *)node->expr)->target);
+		case ET_IDENTIFIER:
+			return resolveIdentifierNode(r, node->expr, 1);
+		case ET_FUNCCALL: {
+			FuncCallExprNode *expr = (FuncCallExprNode *)node->expr;
+			if (!resolveIdentifierNode(r, expr->scope, 1)) return 0;
+			/* Functions in other scopes are looked up in those scopes */
+			if (!resolveIdentifierNode(r, expr->name, isCurrentScope(expr->scope)))
+				return 0;
+			annotateFuncCallExprNode(r, expr);
+			if (!resolveExprNodeList(r, expr->args)) return 0;
+			/* Outside of functions, ME names the scope calls through I are made from */
+			if (!r->function && (isCurrentScope(expr->scope)
+					|| expr->scope->type == IT_INDIRECT))
+				return shadowCurrentScope(r, &r->calls);
+			return 1;
+		}
+		case ET_OP:
+			return resolveExprNodeList(r, ((OpExprNode *)node->expr)->args);
+		case ET_INVARIANT: {
+			InvariantExprNode *expr = (InvariantExprNode *)node->expr;
+			if (!resolveExprNode(r, expr->expr)) return 0;
+			return resolveIdentifierNode(r, expr->id, 1);
+		}
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Resolves a list of statements executed in a scope which is not nested in
+ * any scope known before execution.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in] args The optional names the scope starts with.
+ *
+ * \param [in,out] list The statements to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a list.
+ *
+ * \retval 1 \a list was resolved.
+ */
+static int resolveCode(Resolver *r,
+                       IdentifierNodeList *args,
+                       StmtNodeList *list)
+{
+	ResolverScope *saved = r->scope;
+	unsigned int n;
+	r->scope = createResolverScope(r, NULL, list);
+	if (!r->scope) goto resolveCodeAbort;
+	if (!saved) r->global = r->scope;
+	for (n = 0; args && n < args->num; n++) {
+		if (!declareIdentifierNode(r, args->ids[n])) goto resolveCodeAbort;
+	}
+	if (!resolveStmtNodeList(r, list)) goto resolveCodeAbort;
+	deleteResolverScope(r->scope);
+	r->scope = saved;
+	return 1;
+
+resolveCodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	deleteResolverScope(r->scope);
+	r->scope = saved;
+
+	return 0;
+}
+
+/**
+ * Resolves a block of code executed in its own nested scope.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] node The block of code to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a node.
+ *
+ * \retval 1 \a node was resolved.
+ */
+static int resolveBlockNode(Resolver *r,
+                            BlockNode *node)
+{
+	ResolverScope *inner = createResolverScope(r, r->scope, node->stmts);
+	int status;
+	if (!inner) return 0;
+	r->scope = inner;
+	status = resolveStmtNodeList(r, node->stmts);
+	r->scope = inner->parent;
+	deleteResolverScope(inner);
+	return status;
+}
+
+/**
+ * Resolves a list of blocks of code.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] list The blocks of code to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a list.
+ *
+ * \retval 1 \a list was resolved.
+ */
+static int resolveBlockNodeList(Resolver *r,
+                                BlockNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!resolveBlockNode(r, list->blocks[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Resolves a declaration statement.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] stmt The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a stmt.
+ *
+ * \retval 1 \a stmt was resolved.
+ */
+static int resolveDeclarationStmtNode(Resolver *r,
+                                      DeclarationStmtNode *stmt)
+{
+	if (!shadowDeclarationScope(r, stmt->scope)) return 0;
+	if (!resolveIdentifierNode(r, stmt->scope, 1)) return 0;
+	if (stmt->expr && !resolveExprNode(r, stmt->expr)) return 0;
+	if (stmt->parent && !resolveIdentifierNode(r, stmt->parent, 1)) return 0;
+	/* Variables in other scopes never shadow resolved variables */
+	if (!isCurrentScope(stmt->scope)) {
+		if (!countDeclaration(r, stmt->target, -1)) return 0;
+		return resolveIdentifierNode(r, stmt->target, 0);
+	}
+	return declareIdentifierNode(r, stmt->target);
+}
+
+/**
+ * Checks whether an expression is the variable of a loop.
+ *
+ * \param [in] stmt The loop statement.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 \a node is not the variable of \a stmt.
+ *
+ * \retval 1 \a node is the variable of \a stmt.
+ */
+static int isLoopVariable(LoopStmtNode *stmt,
+                          ExprNode *node)
+{
+	IdentifierNode *id = NULL;
+	if (node->type != ET_IDENTIFIER) return 0;
+	id = (IdentifierNode *)node->expr;
+	return id->type == IT_DIRECT && !id->slot && id->id == stmt->var->id;
+}
+
+/**
+ * Checks whether an expression may be the limit of a counting loop, that is,
+ * an integer constant, a variable, or a loop invariant, none of which have any
+ * effects when they are evaluated.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \retval 0 \a node may not be a limit.
+ *
+ * \retval 1 \a node may be a limit.
+ */
+static int isLoopLimit(ExprNode *node)
+{
+	if (node->type == ET_CONSTANT)
+		return ((ConstantNode *)node->expr)->type == CT_INTEGER;
+	if (node->type == ET_IDENTIFIER) {
+		IdentifierNode *id = (IdentifierNode *)node->expr;
+		return id->type == IT_DIRECT && !id->slot;
+	}
+	return node->type == ET_INVARIANT;
+}
+
+/**
+ * Describes how a loop may be executed without evaluating its body, guard,
+ * and update in the general way.  A body which does not declare any variables
+ * may reuse a single scope.  A loop which counts its variable up or down by
+ * one may step it in place, and if its guard compares the variable to a limit
+ * with \c BOTH \c SAEM or \c DIFFRINT, directly or through \c BIGGR or
+ * \c SMALLR (as in <tt>TIL BOTH SAEM i AN BIGGR OF i AN 10</tt>), the
+ * comparison may be made on integers directly.
+ *
+ * \param [in,out] stmt The loop statement to describe.
+ *
+ * \post The \a step, \a cmp, \a limit, and \a declares fields of \a stmt
+ * will be set.
+ */
+static void describeLoopStmtNode(LoopStmtNode *stmt)
+{
+	ExprNode *guard = stmt->guard;
+	ExprNode *other = NULL;
+	OpExprNode *op = NULL;
+	LoopComparison cmp;
+	int negate = 0;
+	unsigned int n;
+	stmt->step = 0;
+	stmt->cmp = LC_NONE;
+	stmt->limit = NULL;
+	stmt->declares = 0;
+	for (n = 0; stmt->body && n < stmt->body->stmts->num; n++) {
+		StmtType type = stmt->body->stmts->stmts[n]->type;
+		if (type == ST_DECLARATION || type == ST_FUNCDEF
+				|| type == ST_ALTARRAYDEF)
+			stmt->declares = 1;
+	}
+	/* Only loops created by UPPIN and NERFIN count */
+	if (!stmt->var || stmt->var->type != IT_DIRECT || stmt->var->slot
+			|| !stmt->update || stmt->update->type != ET_OP)
+		return;
+	op = (OpExprNode *)stmt->update->expr;
+	if (op->type == OP_ADD) stmt->step = 1;
+	else if (op->type == OP_SUB) stmt->step = -1;
+	else return;
+	/* TIL negates its guard */
+	if (!guard || guard->type != ET_OP) return;
+	op = (OpExprNode *)guard->expr;
+	if (op->type == OP_NOT) {
+		negate = 1;
+		guard = op->args->exprs[0];
+		if (guard->type != ET_OP) return;
+		op = (OpExprNode *)guard->expr;
+	}
+	if (op->type != OP_EQ && op->type != OP_NEQ) return;
+	if (isLoopVariable(stmt, op->args->exprs[0])) other = op->args->exprs[1];
+	else if (isLoopVariable(stmt, op->args->exprs[1])) other = op->args->exprs[0];
+	else return;
+	if (isLoopLimit(other)) {
+		cmp = (op->type == OP_EQ) ? LC_EQ : LC_NEQ;
+		stmt->limit = other;
+	}
+	else if (other->type == ET_OP) {
+		OpExprNode *bound = (OpExprNode *)other->expr;
+		if (bound->type != OP_MAX && bound->type != OP_MIN) return;
+		if (isLoopVariable(stmt, bound->args->exprs[0])
+				&& isLoopLimit(bound->args->exprs[1]))
+			stmt->limit = bound->args->exprs[1];
+		else if (isLoopVariable(stmt, bound->args->exprs[1])
+				&& isLoopLimit(bound->args->exprs[0]))
+			stmt->limit = bound->args->exprs[0];
+		else return;
+		/* A variable equals the larger of itself and a limit when it is at least the limit */
+		if (bound->type == OP_MAX)
+			cmp = (op->type == OP_EQ) ? LC_GTE : LC_LT;
+		else
+			cmp = (op->type == OP_EQ) ? LC_LTE : LC_GT;
+	}
+	else return;
+	if (negate) {
+		switch (cmp) {
+			case LC_EQ: cmp = LC_NEQ; break;
+			case LC_NEQ: cmp = LC_EQ; break;
+			case LC_LT: cmp = LC_GTE; break;
+			case LC_GTE: cmp = LC_LT; break;
+			case LC_LTE: cmp = LC_GT; break;
+			case LC_GT: cmp = LC_LTE; break;
+			default: return;
+		}
+	}
+	stmt->cmp = cmp;
+}
+
+/**
+ * Resolves a loop statement.  The loop variable, followed by the hidden
+ * variables holding the values of the loop invariants, lives in a scope
+ * enclosing the scope of each iteration.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] stmt The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a stmt.
+ *
+ * \retval 1 \a stmt was resolved.
+ */
+static int resolveLoopStmtNode(Resolver *r,
+                               LoopStmtNode *stmt)
+{
+	ResolverScope *outer = createResolverScope(r, r->scope, stmt);
+	unsigned int n;
+	if (!outer) return 0;
+	describeLoopStmtNode(stmt);
+	r->scope = outer;
+	if (stmt->var && !declareIdentifierNode(r, stmt->var))
+		goto resolveLoopStmtNodeAbort;
+	for (n = 0; stmt->invariants && n < stmt->invariants->num; n++) {
+		if (!declareIdentifierNode(r, stmt->invariants->ids[n]))
+			goto resolveLoopStmtNodeAbort;
+	}
+	if (stmt->guard && !resolveExprNode(r, stmt->guard))
+		goto resolveLoopStmtNodeAbort;
+	if (stmt->update && !resolveExprNode(r, stmt->update))
+		goto resolveLoopStmtNodeAbort;
+	if (stmt->body && !resolveBlockNode(r, stmt->body))
+		goto resolveLoopStmtNodeAbort;
+	r->scope = outer->parent;
+	deleteResolverScope(outer);
+	return 1;
+
+resolveLoopStmtNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	r->scope = outer->parent;
+	deleteResolverScope(outer);
+
+	return 0;
+}
+
+/**
+ * Adds the name of a variable a function may create to the names listed for
+ * it.
+ *
+ * \param [in,out] vars The names listed so far, each stored with its position
+ * in the list.
+ *
+ * \param [in] id The identifier of the variable.
+ *
+ * \param [in,out] computed Set if the name of \a id is computed during
+ * execution.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The name was listed.
+ */
+static int listVariable(ResolverTable *vars,
+                        IdentifierNode *id,
+                        int *computed)
+{
+	if (id->type != IT_DIRECT || id->slot) {
+		*computed = 1;
+		return 1;
+	}
+	return addResolverValue(vars, id->id, vars->num) != NULL;
+}
+
+/**
+ * Lists the names of the variables a list of statements may create in the
+ * scope it is executed in or in any scope nested in it.  Variables created
+ * through \c ME are never created in the scopes of a function.
+ *
+ * \param [in,out] vars The names listed so far, each stored with its position
+ * in the list.
+ *
+ * \param [in] list The statements to list the variables of.
+ *
+ * \param [in,out] computed Set if any variable may be created under a name
+ * computed during execution.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The variables were listed.
+ */
+static int listVariables(ResolverTable *vars,
+                         StmtNodeList *list,
+                         int *computed)
+{
+	unsigned int n, m;
+	for (n = 0; n < list->num; n++) {
+		StmtNode *node = list->stmts[n];
+		IdentifierNode *scope = NULL;
+		IdentifierNode *id = NULL;
+		int status = 1;
+		switch (node->type) {
+			case ST_DECLARATION:
+				scope = ((DeclarationStmtNode *)node->stmt)->scope;
+				id = ((DeclarationStmtNode *)node->stmt)->target;
+				break;
+			case ST_FUNCDEF:
+				scope = ((FuncDefStmtNode *)node->stmt)->scope;
+				id = ((FuncDefStmtNode *)node->stmt)->name;
+				break;
+			case ST_ALTARRAYDEF:
+				status = listVariable(vars, ((AltArrayDefStmtNode *)node->stmt)->name, computed);
+				break;
+			case ST_IFTHENELSE: {
+				IfThenElseStmtNode *stmt = (IfThenElseStmtNode *)node->stmt;
+				status = listVariables(vars, stmt->yes->stmts, computed);
+				for (m = 0; status && m < stmt->blocks->num; m++)
+					status = listVariables(vars, stmt->blocks->blocks[m]->stmts, computed);
+				if (status && stmt->no)
+					status = listVariables(vars, stmt->no->stmts, computed);
+				break;
+			}
+			case ST_SWITCH: {
+				SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+				for (m = 0; status && m < stmt->blocks->num; m++)
+					status = listVariables(vars, stmt->blocks->blocks[m]->stmts, computed);
+				if (status && stmt->def)
+					status = listVariables(vars, stmt->def->stmts, computed);
+				break;
+			}
+			case ST_LOOP: {
+				LoopStmtNode *stmt = (LoopStmtNode *)node->stmt;
+				if (stmt->var) status = listVariable(vars, stmt->var, computed);
+				for (m = 0; status && stmt->invariants && m < stmt->invariants->num; m++)
+					status = listVariable(vars, stmt->invariants->ids[m], computed);
+				if (status && stmt->body)
+					status = listVariables(vars, stmt->body->stmts, computed);
+				break;
+			}
+			default:
+				break;
+		}
+		if (!status) return 0;
+		if (!scope) continue;
+		/* A computed scope name may name the current scope */
+		if (scope->type == IT_INDIRECT) *computed = 1;
+		else if (isCurrentScope(scope) && !listVariable(vars, id, computed))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Checks whether evaluating an expression looks up only variables with names
+ * which have been listed, and calls no functions.
+ *
+ * \param [in] vars The names listed so far.
+ *
+ * \param [in] node The expression to check.
+ *
+ * \note Casting a string containing a colon may interpolate any variable.
+ * Listed variables may hold such strings, which canReuseFuncScope() checks
+ * for, but string constants may not.
+ *
+ * \retval 0 \a node may look up other variables.
+ *
+ * \retval 1 \a node looks up only listed variables.
+ */
+static int looksUpListed(const ResolverTable *vars,
+                         ExprNode *node)
+{
+	unsigned int n, pos;
+	switch (node->type) {
+		case ET_CONSTANT: {
+			ConstantNode *c = (ConstantNode *)node->expr;
+			if (c->type != CT_STRING) return 1;
+			if (!c->tmpl) return 0;
+			for (n = 0; n < c->tmpl->num; n++) {
+				TemplateSegment *seg = &c->tmpl->segs[n];
+				if (seg->type == SG_TEXT && memchr(seg->text, ':', seg->length))
+					return 0;
+				if (seg->type == SG_VARIABLE && (seg->id->type != IT_DIRECT
+						|| seg->id->slot
+						|| !getResolverValue(vars, seg->id->id, &pos)))
+					return 0;
+			}
+			return 1;
+		}
+		case ET_IDENTIFIER: {
+			IdentifierNode *id = (IdentifierNode *)node->expr;
+			if (id->type != IT_DIRECT || id->slot) return 0;
+			return getResolverValue(vars, id->id, &pos);
+		}
+		case ET_IMPVAR:
+			return 1;
+		case ET_CAST:
+			return looksUpListed(vars, ((CastExprNode *)node->expr)->target);
+		case ET_OP: {
+			ExprNodeList *args = ((OpExprNode *)node->expr)->args;
+			for (n = 0; n < args->num; n++) {
+				if (!looksUpListed(vars, args->exprs[n])) return 0;
+			}
+			return 1;
+		}
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Lists the names of the variables a function may create, starting with its
+ * arguments followed by the variables its body declares before looking up any
+ * variable which has not been listed.
+ *
+ * \param [in] r The resolver state.
+ *
+ * \param [in,out] stmt The function definition to list the variables of.
+ *
+ * \post The \a names, \a numnames, \a created, and \a computed fields of
+ * \a stmt will be set.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The variables were listed.
+ */
+static int listFuncDefVariables(Resolver *r,
+                                FuncDefStmtNode *stmt)
+{
+	ResolverTable vars;
+	StmtNodeList *body = stmt->body->stmts;
+	int computed = 0;
+	unsigned int n;
+	vars.num = 0;
+	vars.size = 0;
+	vars.entries = NULL;
+	for (n = 0; n < stmt->args->num; n++) {
+		if (!listVariable(&vars, stmt->args->ids[n], &computed))
+			goto listFuncDefVariablesAbort;
+	}
+	/* Declarations initialized from listed variables create theirs first */
+	for (n = 0; n < body->num && body->stmts[n]->type == ST_DECLARATION; n++) {
+		DeclarationStmtNode *decl = (DeclarationStmtNode *)body->stmts[n]->stmt;
+		if (!isCurrentScope(decl->scope) || decl->target->type != IT_DIRECT
+				|| decl->target->slot || decl->parent
+				|| (decl->expr && !looksUpListed(&vars, decl->expr)))
+			break;
+		if (!listVariable(&vars, decl->target, &computed))
+			goto listFuncDefVariablesAbort;
+	}
+	stmt->created = vars.num;
+	if (!listVariables(&vars, body, &computed))
+		goto listFuncDefVariablesAbort;
+	stmt->numnames = vars.num;
+	stmt->computed = computed;
+	stmt->names = NULL;
+	if (vars.num) {
+		size_t size = sizeof(char *) * vars.num;
+		stmt->names = r->arena ? allocateArenaObject(r->arena, size) : malloc(size);
+		if (!stmt->names) {
+			perror("malloc");
+			goto listFuncDefVariablesAbort;
+		}
+	}
+	for (n = 0; n < vars.size; n++) {
+		if (vars.entries[n].key)
+			stmt->names[vars.entries[n].value] = (char *)vars.entries[n].key;
+	}
+	free(vars.entries);
+	return 1;
+
+listFuncDefVariablesAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	free(vars.entries);
+
+	return 0;
+}
+
+/**
+ * Resolves a return statement.  A call through \c I returned by a function
+ * whose variables are all known is marked as a tail call, which may reuse the
+ * scope of the returning function if the called function creates each of
+ * those variables before looking any of them up (see canReuseFuncScope()).
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] stmt The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a stmt.
+ *
+ * \retval 1 \a stmt was resolved.
+ */
+static int resolveReturnStmtNode(Resolver *r,
+                                 ReturnStmtNode *stmt)
+{
+	stmt->func = NULL;
+	if (r->func && stmt->value->type == ET_FUNCCALL
+			&& isCurrentScope(((FuncCallExprNode *)stmt->value->expr)->scope))
+		stmt->func = r->func;
+	return resolveExprNode(r, stmt->value);
+}
+
+/**
+ * Resolves a function definition statement.  Function bodies are executed in
+ * a scope nested in the scope of their caller, so only the arguments and
+ * variables of the function itself are resolved within them.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] stmt The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a stmt.
+ *
+ * \retval 1 \a stmt was resolved.
+ */
+static int resolveFuncDefStmtNode(Resolver *r,
+                                  FuncDefStmtNode *stmt)
+{
+	FuncDefStmtNode *saved = NULL;
+	unsigned int n;
+	int function = r->function;
+	int status;
+	if (!shadowDeclarationScope(r, stmt->scope)) return 0;
+	if (!resolveIdentifierNode(r, stmt->scope, 1)) return 0;
+	if (isCurrentScope(stmt->scope)) {
+		if (!declareIdentifierNode(r, stmt->name)) return 0;
+	}
+	else {
+		if (!countDeclaration(r, stmt->name, -1)) return 0;
+		if (!resolveIdentifierNode(r, stmt->name, 0)) return 0;
+	}
+	/* Count the variables the body creates in the scope of each call */
+	stmt->locals = stmt->args->num;
+	for (n = 0; n < stmt->body->stmts->num; n++) {
+		StmtNode *node = stmt->body->stmts->stmts[n];
+		if ((node->type == ST_DECLARATION
+				&& isCurrentScope(((DeclarationStmtNode *)node->stmt)->scope))
+				|| (node->type == ST_FUNCDEF
+				&& isCurrentScope(((FuncDefStmtNode *)node->stmt)->scope))
+				|| node->type == ST_ALTARRAYDEF)
+			stmt->locals++;
+	}
+	/* List the variables a call may create once, in the first pass */
+	if (!r->annotate && !listFuncDefVariables(r, stmt)) return 0;
+	saved = r->func;
+	r->func = stmt->computed ? NULL : stmt;
+	r->function = 1;
+	status = resolveCode(r, stmt->args, stmt->body->stmts);
+	r->func = saved;
+	r->function = function;
+	return status;
+}
+
+/**
+ * Resolves an alternate array definition statement.  Array bodies are
+ * executed in the scope of the array, whose parent may be an inherited array.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] stmt The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a stmt.
+ *
+ * \retval 1 \a stmt was resolved.
+ */
+static int resolveAltArrayDefStmtNode(Resolver *r,
+                                      AltArrayDefStmtNode *stmt)
+{
+	FuncDefStmtNode *saved = r->func;
+	int status;
+	if (stmt->parent && !resolveIdentifierNode(r, stmt->parent, 1)) return 0;
+	/* Returns from array bodies do not return from any function */
+	r->func = NULL;
+	status = resolveCode(r, NULL, stmt->body->stmts);
+	r->func = saved;
+	if (!status) return 0;
+	return declareIdentifierNode(r, stmt->name);
+}
+
+/**
+ * Resolves a statement.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] node The statement to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a node.
+ *
+ * \retval 1 \a node was resolved.
+ */
+static int resolveStmtNode(Resolver *r,
+                           StmtNode *node)
+{
+	switch (node->type) {
+		case ST_CAST:
+			return resolveIdentifierNode(r, ((CastStmtNode *)node->stmt)->target, 1);
+		case ST_PRINT:
+			return resolveExprNodeList(r, ((PrintStmtNode *)node->stmt)->args);
+		case ST_INPUT:
+			return resolveIdentifierNode(r, ((InputStmtNode *)node->stmt)->target, 1);
+		case ST_ASSIGNMENT: {
+			AssignmentStmtNode *stmt = (AssignmentStmtNode *)node->stmt;
+			if (!resolveIdentifierNode(r, stmt->target, 1)) return 0;
+			return resolveExprNode(r, stmt->expr);
+		}
+		case ST_DECLARATION:
+			return resolveDeclarationStmtNode(r, node->stmt);
+		case ST_IFTHENELSE: {
+			IfThenElseStmtNode *stmt = (IfThenElseStmtNode *)node->stmt;
+			if (!resolveBlockNode(r, stmt->yes)) return 0;
+			if (!resolveExprNodeList(r, stmt->guards)) return 0;
+			if (!resolveBlockNodeList(r, stmt->blocks)) return 0;
+			if (stmt->no && !resolveBlockNode(r, stmt->no)) return 0;
+			return 1;
+		}
+		case ST_SWITCH: {
+			SwitchStmtNode *stmt = (SwitchStmtNode *)node->stmt;
+			if (!resolveExprNodeList(r, stmt->guards)) return 0;
+			if (!resolveBlockNodeList(r, stmt->blocks)) return 0;
+			if (stmt->def && !resolveBlockNode(r, stmt->def)) return 0;
+			return 1;
+		}
+		case ST_RETURN:
+			return resolveReturnStmtNode(r, node->stmt);
+		case ST_LOOP:
+			return resolveLoopStmtNode(r, node->stmt);
+		case ST_DEALLOCATION:
+			return resolveIdentifierNode(r, ((DeallocationStmtNode *)node->stmt)->target, 1);
+		case ST_FUNCDEF:
+			return resolveFuncDefStmtNode(r, node->stmt);
+		case ST_EXPR:
+			return resolveExprNode(r, node->stmt);
+		case ST_ALTARRAYDEF:
+			return resolveAltArrayDefStmtNode(r, node->stmt);
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Resolves a list of statements.
+ *
+ * \param [in,out] r The resolver state.
+ *
+ * \param [in,out] list The statements to resolve.
+ *
+ * \retval 0 An error occurred while resolving \a list.
+ *
+ * \retval 1 \a list was resolved.
+ */
+static int resolveStmtNodeList(Resolver *r,
+                               StmtNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!resolveStmtNode(r, list->stmts[n])) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Resolves the identifiers of a main block of code.  The first pass counts
+ * declarations and finds the scopes in which variables whose names are only
+ * known during execution may be created, such as through \c SRS or \c ME.
+ * The second pass annotates identifiers, except those which such variables
+ * may shadow, which are looked up by name.
+ *
+ * \param [in,out] main The main block of code to resolve.
+ *
+ * \pre \a main contains a block of code created by parseMainNode().
+ *
+ * \post Direct identifiers whose variables are known will store their
+ * resolved positions.
+ *
+ * \retval 0 \a main was resolved without any errors.
+ *
+ * \retval 1 An error occurred while resolving \a main.
+ */
+int resolveMainNode(MainNode *main)
+{
+	Resolver r;
+	if (!main) return 1;
+	r.arena = main->arena;
+	r.scope = NULL;
+	r.global = NULL;
+	r.func = NULL;
+	r.decls = NULL;
+	r.numdecls = 0;
+	r.declsize = 0;
+	r.declpos.num = 0;
+	r.declpos.size = 0;
+	r.declpos.entries = NULL;
+	r.unnamed.num = 0;
+	r.unnamed.size = 0;
+	r.unnamed.entries = NULL;
+	r.calls.num = 0;
+	r.calls.size = 0;
+	r.calls.entries = NULL;
+	r.function = 0;
+	r.me = 0;
+	r.computed = 0;
+	/* Find scopes with variables that cannot be resolved and count declarations */
+	r.annotate = 0;
+	if (!resolveCode(&r, NULL, main->block->stmts)) goto resolveMainNodeAbort;
+	/* Annotate identifiers */
+	r.annotate = 1;
+	if (!resolveCode(&r, NULL, main->block->stmts)) goto resolveMainNodeAbort;
+	free(r.decls);
+	free(r.declpos.entries);
+	free(r.unnamed.entries);
+	free(r.calls.entries);
+	return 0;
+
+resolveMainNodeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	free(r.decls);
+	free(r.declpos.entries);
+	free(r.unnamed.entries);
+	free(r.calls.entries);
+
+	return 1;
+}
@@ -0,0 +1,95 @@
+/**
+ * Structures and functions for resolving identifiers in a parse tree.  The
+ * resolver mirrors the scopes the interpreter creates while executing a parse
+ * tree and annotates each direct identifier with the position of the variable
+ * it refers to, allowing lookups to index straight into a scope instead of
+ * comparing names.  Identifiers which may find a variable created under a name
+ * only known during execution, such as through \c SRS or \c ME, are left to be
+ * looked up by name.  Calls to functions which can only be found in the
+ * outermost scope are annotated with their positions there.  Loops which count
+ * with \c UPPIN or \c NERFIN are also described so they may be executed without
+ * evaluating their guards and updates in the general way.  Calls returned by
+ * functions whose variables all have known names are marked as tail calls.
+ * This stage runs after parsing and before execution.
+ *
+ * \file   resolver.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __RESOLVER_H__
+#define __RESOLVER_H__
+
+#include "parser.h"
+
+/**
+ * Stores a position by the address of the key it is found by, such as an
+ * interned name.
+ */
+typedef struct {
+	const void *key;    /**< The key (NULL if the entry is empty). */
+	unsigned int value; /**< The position stored for \a key. */
+} ResolverEntry;
+
+/**
+ * Stores positions in an open-addressing hash table keyed on addresses.
+ */
+typedef struct {
+	unsigned int num;       /**< The number of keys in the table. */
+	unsigned int size;      /**< The number of entries, a power of two (0 if none are allocated). */
+	ResolverEntry *entries; /**< The entries of the table. */
+} ResolverTable;
+
+/**
+ * Stores the names a scope is known to contain at some point of a parse tree.
+ */
+typedef struct resolverscope {
+	struct resolverscope *parent; /**< The enclosing scope (NULL if not known statically). */
+	const void *node;             /**< The parse tree node the scope is created for. */
+	unsigned int numvals;         /**< The number of names in the scope. */
+	ResolverTable names;          /**< The position of the first value with each interned name. */
+	int dynamic;                  /**< Whether variables with unknown names may be created in the scope. */
+	unsigned int known;           /**< The number of values created in a dynamic scope before any with an unknown name. */
+} ResolverScope;
+
+/**
+ * Stores the number of times a name is declared anywhere in a parse tree.
+ */
+typedef struct {
+	char *name;         /**< The interned name. */
+	unsigned int count; /**< The number of declarations of the name. */
+	int index;          /**< The position of the name in the outermost scope (-1 if not declared there). */
+} ResolverName;
+
+/**
+ * Stores the state of the resolver while it traverses a parse tree.
+ */
+typedef struct {
+	MemoryArena *arena;    /**< The arena the parse tree was allocated from (NULL if allocated with malloc). */
+	ResolverScope *scope;  /**< The innermost scope being resolved. */
+	ResolverScope *global; /**< The outermost scope. */
+	FuncDefStmtNode *func; /**< The function being resolved, if its scope may be reused by tail calls. */
+	ResolverName *decls;   /**< The names declared anywhere, counted on the first pass. */
+	unsigned int numdecls; /**< The number of names in \a decls. */
+	unsigned int declsize; /**< The number of names there is space for in \a decls. */
+	ResolverTable declpos; /**< The position of each interned name in \a decls. */
+	ResolverTable unnamed; /**< The number of values in each scope, by its node, when one is first created with a computed name. */
+	ResolverTable calls;   /**< The number of values in each scope, by its node, when a call which may create values in it through \c ME is first made. */
+	int annotate;          /**< Whether to annotate identifiers. */
+	int function;          /**< Whether a function body is being resolved. */
+	int me;                /**< Whether any variable may be created through \c ME. */
+	int computed;          /**< Whether any declared name is computed during execution. */
+} Resolver;
+
+/**
+ * \name Resolvers
+ *
+ * Functions for annotating parse trees with resolved identifiers.
+ */
+/**@{*/
+int resolveMainNode(MainNode *);
+/**@}*/
+
+#endif /* __RESOLVER_H__ */
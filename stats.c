@@ -0,0 +1,68 @@
+#include "stats.h"
+
+#ifdef COLLECT_STATS
+
+THREAD_LOCAL Stats ThreadStats;
+
+/**
+ * Counts some bytes of memory as being held, updating the most bytes held at
+ * once.
+ *
+ * \param [in] bytes The number of bytes allocated.
+ */
+void allocateStatBytes(long long bytes)
+{
+	ThreadStats.live += bytes;
+	if (ThreadStats.live > ThreadStats.peak)
+		ThreadStats.peak = ThreadStats.live;
+}
+
+/**
+ * The names of the value types, in the order of ValueType.
+ */
+static const char *StatsTypeNames[STATS_VALUE_TYPES] = {
+	"NUMBR",
+	"NUMBAR",
+	"TROOF",
+	"YARN",
+	"NOOB",
+	"FUNKSHUN",
+	"BUKKIT"
+};
+
+#endif /* COLLECT_STATS */
+
+/**
+ * Prints the counts of this thread.
+ *
+ * \param [in] file The file to print to.
+ */
+void printStats(FILE *file)
+{
+#ifdef COLLECT_STATS
+	const Stats *s = &ThreadStats;
+	unsigned int n;
+	fprintf(file, "%-10s %12s %12s %12s\n", "value", "allocated", "immediate", "freed");
+	for (n = 0; n < STATS_VALUE_TYPES; n++)
+		fprintf(file, "%-10s %12llu %12llu %12llu\n",
+				StatsTypeNames[n],
+				s->created[n],
+				s->immediate[n],
+				s->freed[n]);
+	fprintf(file, "%-32s %12llu\n", "scopes created", s->scopes);
+	fprintf(file, "%-32s %12llu\n", "scope value space grown", s->valuegrowths);
+	fprintf(file, "%-32s %12llu\n", "scope element space grown", s->elemgrowths);
+	fprintf(file, "%-32s %12llu\n", "resolved look-ups", s->resolved);
+	fprintf(file, "%-32s %12llu\n", "look-ups by name", s->lookups);
+	fprintf(file, "%-32s %12llu\n", "names compared", s->comparisons);
+	fprintf(file, "%-32s %12llu\n", "strings interpolated by template", s->templates);
+	fprintf(file, "%-32s %12llu\n", "strings interpolated by scanning", s->scans);
+	fprintf(file, "%-32s %12llu\n", "casts reused", s->casts);
+	fprintf(file, "%-32s %12llu\n", "loop invariants reused", s->invariants);
+	fprintf(file, "%-32s %12llu\n", "references borrowed", s->borrows);
+	fprintf(file, "%-32s %12lld\n", "peak live bytes", s->peak);
+	fprintf(file, "%-32s %12lld\n", "live bytes", s->live);
+#else
+	fprintf(file, "statistics were not compiled in (configure with -DCOLLECT_STATS=ON)\n");
+#endif
+}
@@ -0,0 +1,106 @@
+/**
+ * Structures and macros for counting events on the hot paths of the
+ * interpreter, such as the values and scopes it creates, the names it compares
+ * while looking up variables, and the bytes of memory its values and scopes
+ * hold at once.  The counts are printed with the \c --stats option.
+ *
+ * Counting is only compiled in when \c COLLECT_STATS is defined; otherwise
+ * every counting macro expands to nothing, so the counts cost nothing in
+ * ordinary builds.  Each thread keeps its own counts.
+ *
+ * \file   stats.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "error.h"
+
+/**
+ * The number of value types counted, one for each type of ValueType.
+ */
+#define STATS_VALUE_TYPES 7
+
+/**
+ * Stores the counts of the events of a thread.
+ */
+typedef struct {
+	unsigned long long created[STATS_VALUE_TYPES];   /**< The values allocated, by type. */
+	unsigned long long immediate[STATS_VALUE_TYPES]; /**< The immediate values created, by type, which need no allocation. */
+	unsigned long long freed[STATS_VALUE_TYPES];     /**< The values freed, by type. */
+	unsigned long long scopes;                       /**< The scopes created. */
+	unsigned long long valuegrowths;                 /**< The times createScopeValue() grew the space for the values of a scope. */
+	unsigned long long elemgrowths;                  /**< The times createScopeValue() grew the space for the elements of a scope. */
+	unsigned long long resolved;                     /**< The look-ups made with the positions found by the resolver. */
+	unsigned long long lookups;                      /**< The look-ups of a name in a single scope. */
+	unsigned long long comparisons;                  /**< The names compared during look-ups by name. */
+	unsigned long long templates;                    /**< The strings interpolated with a template built by the parser. */
+	unsigned long long scans;                        /**< The strings interpolated by scanning their characters. */
+	unsigned long long casts;                        /**< The casts whose results were found in the cast cache. */
+	unsigned long long invariants;                   /**< The loop invariants whose values were reused. */
+	unsigned long long borrows;                      /**< The values of variables used in place without taking a reference to them. */
+	long long live;                                  /**< The bytes held by values, scopes, and return objects. */
+	long long peak;                                  /**< The most bytes held at once. */
+} Stats;
+
+#ifdef COLLECT_STATS
+
+/**
+ * The counts of this thread.
+ */
+extern THREAD_LOCAL Stats ThreadStats;
+
+/**
+ * Counts an event.
+ */
+#define STAT_COUNT(counter) (ThreadStats.counter++)
+
+/**
+ * Counts an event by the type of the value it concerns.
+ */
+#define STAT_COUNT_TYPE(counter, type) (ThreadStats.counter[(type)]++)
+
+/**
+ * Adds to the count of the names compared during look-ups.
+ */
+#define STAT_COMPARE(num) (ThreadStats.comparisons += (num))
+
+/**
+ * Counts some bytes of memory as being held.
+ */
+#define STAT_ALLOCATE(bytes) allocateStatBytes((long long)(bytes))
+
+/**
+ * Counts some bytes of memory as no longer being held.
+ */
+#define STAT_FREE(bytes) (ThreadStats.live -= (long long)(bytes))
+
+void allocateStatBytes(long long);
+
+#else
+
+#define STAT_COUNT(counter) ((void)0)
+#define STAT_COUNT_TYPE(counter, type) ((void)0)
+#define STAT_COMPARE(num) ((void)0)
+#define STAT_ALLOCATE(bytes) ((void)0)
+#define STAT_FREE(bytes) ((void)0)
+
+#endif /* COLLECT_STATS */
+
+/**
+ * \name Statistics reporting
+ *
+ * Functions for reporting the counts of a thread.
+ */
+/**@{*/
+void printStats(FILE *);
+/**@}*/
+
+#endif /* __STATS_H__ */
@@ -0,0 +1,145 @@
+#!/usr/bin/python
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+# Phases timed by lcibench, in the order they run
+PHASES = ["lexer", "tokenizer", "parser", "interpreter"]
+
+# Phases faster than this, in seconds, are too noisy to compare
+MINTIME = 0.002
+
+parser = argparse.ArgumentParser(description="Driver for lci benchmarks")
+parser.add_argument('pathToBench', help="The absolute path to the lcibench executable")
+parser.add_argument('benchDir', help="The absolute path to the directory of benchmarks, one per subdirectory")
+parser.add_argument('-w', '--workDir', default=".", help="The directory to generate sources and write results in")
+parser.add_argument('-n', '--runs', type=int, default=5, help="The number of times to run each phase")
+parser.add_argument('-e', '--engine', default="tree", help="The engine to execute with: tree or vm")
+parser.add_argument('-b', '--baseline', default=None, help="The results to compare against")
+parser.add_argument('-s', '--save', action='store_true', help="Save the results as the baseline instead of comparing against it")
+parser.add_argument('-t', '--threshold', type=float, default=0.25, help="The fraction of throughput a phase may lose before it is a regression")
+parser.add_argument('-l', '--largeSize', type=int, default=4, help="The size of the generated large source, in megabytes")
+
+args = parser.parse_args()
+
+def generateLarge(path, size):
+  """Writes a program of many small functions, about size megabytes long."""
+  out = open(path, "w")
+  out.write("HAI 1.3\n\tI HAS A total ITZ 0\n")
+  length = 0
+  k = 0
+  while length < size * 1024 * 1024:
+    block = ("\tBTW function %d of the large source, which is mostly parsed\n"
+      "\tHOW IZ I f%d YR a AN YR b\n"
+      "\t\tI HAS A t ITZ SUM OF PRODUKT OF a AN %d AN b\n"
+      "\t\tI HAS A s ITZ SMOOSH \"f%d gives :{t}\" AN \" for \" AN a MKAY\n"
+      "\t\tBOTH SAEM t AN BIGGR OF t AN 100, O RLY?\n"
+      "\t\t\tYA RLY, t R MOD OF t AN 100\n"
+      "\t\t\tNO WAI, t R SUM OF t AN 1\n"
+      "\t\tOIC\n"
+      "\t\tFOUND YR t\n"
+      "\tIF U SAY SO\n"
+      "\ttotal R SUM OF total AN I IZ f%d YR %d AN YR 3 MKAY\n") % (k, k, k % 97, k, k, k)
+    out.write(block)
+    length += len(block)
+    k += 1
+  out.write("\tVISIBLE total\nKTHXBYE\n")
+  out.close()
+
+def runBench(name, path, inputPath):
+  """Runs lcibench on a source, returning its timings."""
+  command = [args.pathToBench, "-n", str(args.runs), "--engine=" + args.engine]
+  if inputPath:
+    command += ["-i", inputPath]
+  command.append(path)
+  proc = subprocess.Popen(command, stdout=subprocess.PIPE)
+  output = proc.communicate()[0]
+  if proc.returncode != 0:
+    print("Error: benchmark " + name + " failed with exit code " + str(proc.returncode))
+    sys.exit(1)
+  return json.loads(output.decode("utf-8"))
+
+def getThroughput(result, phase):
+  """Gets the throughput of a phase: megabytes per second for the front end and runs per second for the interpreter."""
+  time = result[phase]
+  if time <= 0:
+    return None
+  if phase == "interpreter":
+    return 1.0 / time
+  return result["bytes"] / (1024.0 * 1024.0) / time
+
+benchmarks = []
+for entry in sorted(os.listdir(args.benchDir)):
+  path = os.path.join(args.benchDir, entry, "test.lol")
+  if os.path.isfile(path):
+    inputPath = os.path.join(args.benchDir, entry, "test.in")
+    benchmarks.append((entry, path, inputPath if os.path.isfile(inputPath) else None))
+large = os.path.join(args.workDir, "bench-large.lol")
+generateLarge(large, args.largeSize)
+benchmarks.append(("LargeSource", large, None))
+
+results = {"engine": args.engine, "runs": args.runs, "benchmarks": {}}
+print("%-24s %10s %10s %10s %10s" % ("benchmark", "lex MB/s", "tok MB/s", "parse MB/s", "runs/s"))
+for (name, path, inputPath) in benchmarks:
+  result = runBench(name, path, inputPath)
+  entry = {"bytes": result["bytes"], "times": {}, "throughput": {}}
+  cells = []
+  for phase in PHASES:
+    entry["times"][phase] = result[phase]
+    entry["throughput"][phase] = getThroughput(result, phase)
+    value = entry["throughput"][phase]
+    cells.append("%10.2f" % value if value is not None else "%10s" % "-")
+  results["benchmarks"][name] = entry
+  print("%-24s %s" % (name, " ".join(cells)))
+
+resultsPath = os.path.join(args.workDir, "bench-results.json")
+out = open(resultsPath, "w")
+json.dump(results, out, indent=2, sort_keys=True)
+out.write("\n")
+out.close()
+print("Results written to " + resultsPath)
+
+if not args.baseline:
+  sys.exit(0)
+
+if args.save:
+  out = open(args.baseline, "w")
+  json.dump(results, out, indent=2, sort_keys=True)
+  out.write("\n")
+  out.close()
+  print("Baseline saved to " + args.baseline)
+  sys.exit(0)
+
+if not os.path.isfile(args.baseline):
+  print("No baseline at " + args.baseline + " to compare against")
+  sys.exit(0)
+
+baseline = json.load(open(args.baseline))
+if baseline.get("engine") != args.engine:
+  print("Warning: the baseline was measured with the " + str(baseline.get("engine")) + " engine")
+
+regressions = 0
+print("")
+print("%-24s %-12s %10s" % ("benchmark", "phase", "change"))
+for (name, path, inputPath) in benchmarks:
+  if name not in baseline["benchmarks"]:
+    continue
+  base = baseline["benchmarks"][name]
+  entry = results["benchmarks"][name]
+  for phase in PHASES:
+    if base["times"][phase] < MINTIME or entry["times"][phase] < MINTIME:
+      continue
+    # Sources may change, so compare throughput rather than time
+    change = entry["throughput"][phase] / base["throughput"][phase] - 1.0
+    flag = ""
+    if change < -args.threshold:
+      flag = " REGRESSION"
+      regressions += 1
+    print("%-24s %-12s %+9.1f%%%s" % (name, phase, change * 100.0, flag))
+
+if regressions:
+  print(str(regressions) + " phase(s) lost more than " + str(int(args.threshold * 100)) + "% of their throughput")
+  sys.exit(1)
+print("No phase lost more than " + str(int(args.threshold * 100)) + "% of its throughput")
@@ -3,6 +3,7 @@ import subprocess
 import sys
 import tempfile
 import argparse
+import os
 
 MEMERR = 127
   
@@ -10,9 +11,11 @@ parser = argparse.ArgumentParser(description="Driver for lci tests")
 parser.add_argument('pathToLCI', help="The absolute path the the lci executable")
 parser.add_argument('lolcodeFile', help="The absolute path to the lolcode file to test")
 parser.add_argument('-o', '--outputFile', type=argparse.FileType('r'), default=None, help="The expected output")
+parser.add_argument('-r', '--errorFile', type=argparse.FileType('r'), default=None, help="The expected error output, with file names relative to the lolcode file")
 parser.add_argument('-i', '--inputFile', type=argparse.FileType('r'), default=None, help="File to be used as input")
 parser.add_argument('-e', '--expectError', action="store_true", help="Specify that an error should occur")
 parser.add_argument('-m', '--memCheck', action='store_true', help="Do a memory check")
+parser.add_argument('-a', '--lciArgument', action='append', default=[], help="An additional argument to pass to lci")
 
 args = parser.parse_args()
 
@@ -32,6 +35,11 @@ if args.outputFile == None:
 else:
   print("Using output file: " + args.outputFile.name) 
 
+if args.errorFile == None:
+  print("Not using an error output file")
+else:
+  print("Using error output file: " + args.errorFile.name)
+
 if args.memCheck:
   print("Doing memory check.")
 else:
@@ -42,6 +50,11 @@ if args.outputFile != None:
   expectedOutput = args.outputFile.read()
   args.outputFile.close()
 
+expectedError = None
+if args.errorFile != None:
+  expectedError = args.errorFile.read()
+  args.errorFile.close()
+
 command = []
 if args.memCheck:
   command.append("valgrind")
@@ -49,6 +62,7 @@ if args.memCheck:
   command.append("--leak-check=full")
   command.append("--error-exitcode=" + str(MEMERR))
 command.append(args.pathToLCI)
+command.extend(args.lciArgument)
 command.append(args.lolcodeFile)
 
 print("Command: " + " ".join(command))
@@ -60,6 +74,11 @@ if p.returncode == MEMERR:
   print("Failure!\n Memory leak detected, check output for more information.)")
   sys.exit(1)
 
+if p.returncode < 0:
+  print("Failure! Terminated by signal " + str(-p.returncode))
+  print(results[1])
+  sys.exit(1)
+
 if args.expectError:
   if p.returncode == 0:
     print("Failure! Expected an error but did not recieve one")
@@ -68,7 +87,18 @@ if args.expectError:
     print("Success!")
     print("Error:")
     print(results[1])
- 
+
+if expectedError != None:
+  # Errors name the file they occurred in by the path it was run with
+  actualError = results[1].replace(os.path.dirname(args.lolcodeFile) + os.sep, "")
+  if expectedError != actualError:
+    print("Expected error output didn't match!")
+    print("Expected error output:")
+    print(expectedError)
+    print("Actual error output:")
+    print(actualError)
+    sys.exit(1)
+
 if args.outputFile:
   if p.returncode != 0:
     print("Failure! Return error code: " + str(p.returncode))
@@ -113,17 +113,13 @@ Token *createToken(TokenType type,
 		return NULL;
 	}
 	ret->type = type;
-	ret->image = malloc(sizeof(char) * (strlen(image) + 1));
-	if (!(ret->image)) {
-		free(ret);
-		perror("malloc");
-		return NULL;
-	}
-	strcpy(ret->image, image);
 	/**
-	 * \note fname is not copied because only one copy is stored for all
-	 * Token structures that share it.
+	 * \note Neither image nor fname are copied.  image refers either to
+	 * the lexeme the token was created from or to a string constant and
+	 * only one copy of fname is stored for all Token structures that share
+	 * it.
 	 */
+	ret->image = image;
 	ret->fname = fname;
 	ret->line = line;
 	return ret;
@@ -139,90 +135,81 @@ Token *createToken(TokenType type,
 void deleteToken(Token *token)
 {
 	if (!token) return;
-	free(token->image);
 	free(token);
 }
 
 /**
- * Adds a token to a list.
+ * Looks ahead at a lexeme in a token stream, scanning lexemes as needed.
  *
- * \param [in,out] list The list of tokens to add \a token to.
+ * \param [in,out] stream The token stream to look ahead in.
  *
- * \param [in,out] num The number of tokens in \a list.
+ * \param [in] offset The number of lexemes after the next one to look at.
  *
- * \param [in] token The token to add to \a list.
+ * \pre \a offset is less than \a LEXEME_LOOKAHEAD minus one.
  *
- * \post \a token will be added to the end of \a list and the size of \a list
- * will be updated.
+ * \note The lexeme after the one looked at is also scanned so that its image is
+ * null-terminated.
  *
- * \retval 0 Memory allocation failed.
+ * \return A pointer to the lexeme \a offset lexemes after the next one.
  *
- * \retval 1 \a token was added to \a list.
+ * \retval NULL There are not enough lexemes left.
  */
-int addToken(Token ***list,
-             unsigned int *num,
-             Token *token)
+static Lexeme *peekLexeme(TokenStream *stream,
+                          unsigned int offset)
 {
-	unsigned int newsize = *num + 1;
-	void *mem = realloc(*list, sizeof(Token *) * newsize);
-	if (!mem) {
-		perror("realloc");
-		return 0;
+	while (stream->num < offset + 2) {
+		unsigned int pos = (stream->head + stream->num) % LEXEME_LOOKAHEAD;
+		if (!scanLexeme(&stream->lexer, &stream->lexemes[pos])) break;
+		stream->num++;
 	}
-	*list = mem;
-	(*list)[*num] = token;
-	*num = newsize;
-#ifdef DEBUG
-	fprintf(stderr, "Adding token type %d [%s]\n", token->type, token->image);
-#endif
-	return 1;
+	if (offset >= stream->num) return NULL;
+	return &stream->lexemes[(stream->head + offset) % LEXEME_LOOKAHEAD];
 }
 
 /**
- * Deletes a list of tokens.
+ * Discards lexemes from the front of a token stream.
  *
- * \param list [in,out] The list of tokens to delete.
+ * \param [in,out] stream The token stream to discard lexemes from.
  *
- * \post The memory at \a list and all of its members will be freed.
+ * \param [in] num The number of lexemes to discard.
  */
-void deleteTokens(Token **list)
+static void consumeLexemes(TokenStream *stream,
+                           unsigned int num)
 {
-	Token **tok = list;
-	while (*tok) {
-		deleteToken(*tok);
-		tok++;
-	}
-	free(list);
+	stream->head = (stream->head + num) % LEXEME_LOOKAHEAD;
+	stream->num -= num;
 }
 
 /**
- * Matches lexemes against a string.  Traverses \a lexemes starting at \a start
- * and compares lexeme images to space-delimited substrings from \a match.
+ * Matches lexemes against a string.  Traverses the lexemes at the front of
+ * \a stream and compares their images to space-delimited substrings from
+ * \a match.
  *
- * \param lexemes [in] The list of lexemes to match from.
- *
- * \param start [in] The index within \a lexemes to start matching at.
+ * \param stream [in,out] The token stream to match lexemes from.
  * 
  * \param match [in] A string of space-delimited substrings to match.
  *
  * \return The number of lexemes matched.
  */
-unsigned int acceptLexemes(LexemeList *lexemes,
-                           unsigned int start,
+unsigned int acceptLexemes(TokenStream *stream,
                            const char *match)
 {
 	unsigned int offset = 0;
 	unsigned int n;
 	unsigned int i;
+	Lexeme *lexeme = peekLexeme(stream, 0);
+	if (!lexeme) return 0;
 	for (n = 0, i = 0;
-			match[n] || lexemes->lexemes[start + offset]->image[i];
+			match[n] || lexeme->image[i];
 			n++) {
 		if (match[n] == ' ') {
 			offset++;
 			i = 0;
+			lexeme = peekLexeme(stream, offset);
+			if (!lexeme) return 0;
 			continue;
 		}
-		if (lexemes->lexemes[start + offset]->image[i] != match[n])
+		if (lexeme->image[i] != match[n])
 			return 0;
 		i++;
 	}
@@ -230,69 +217,166 @@ unsigned int acceptLexemes(LexemeList *lexemes,
 }
 
 /**
- * Checks if the next lexemes in a list comprise a keyword and, if so, generates
- * a new token representing that keyword.  Specifically, \a lexemes is searched,
- * starting at \a start for keywords.  If one is found, an appropriate token is
- * created and returned and \a start is incremented by the number of lexemes
- * matched minus one.
+ * The number of buckets in the keyword table.  This must be a power of two
+ * larger than the number of distinct first words of keywords.
+ */
+#define KEYWORD_BUCKETS 256
+
+/**
+ * The largest number of keywords sharing the same first word.
+ */
+#define KEYWORD_CANDIDATES 4
+
+/**
+ * Stores the keywords beginning with a particular word.
+ */
+typedef struct {
+	const char *word;                       /**< The first word of the keywords. */
+	unsigned int length;                    /**< The length of \a word. */
+	unsigned int num;                       /**< The number of keywords. */
+	TokenType types[KEYWORD_CANDIDATES];    /**< The keywords, in the order they are matched. */
+} KeywordBucket;
+
+/**
+ * A hash table of keywords keyed on their first word, built on first use by
+ * each thread.
+ */
+static THREAD_LOCAL KeywordBucket KeywordTable[KEYWORD_BUCKETS];
+
+/**
+ * Whether \a KeywordTable has been built.
+ */
+static THREAD_LOCAL int KeywordTableBuilt = 0;
+
+/**
+ * Hashes a word.
  *
- * \param lexemes [in] A list of lexemes to search for keywords in.
+ * \param [in] word The characters of the word.
  *
- * \param start [in,out] The position within \a lexemes to begin searching for
- * keywords.
+ * \param [in] length The number of characters in \a word.
  *
- * \post If a keyword is not found, \a start will not be modified.  Otherwise,
- * \a start will be incremented by the number of lexemes matched minus one.
+ * \return The index of the bucket for \a word in \a KeywordTable.
+ */
+static unsigned int hashKeyword(const char *word,
+                                unsigned int length)
+{
+	/* FNV-1a */
+	unsigned long hash = 2166136261UL;
+	unsigned int n;
+	for (n = 0; n < length; n++) {
+		hash ^= (unsigned char)word[n];
+		hash = (hash * 16777619UL) & 0xffffffffUL;
+	}
+	return (unsigned int)(hash & (KEYWORD_BUCKETS - 1));
+}
+
+/**
+ * Finds the bucket for a word in the keyword table.
  *
- * \return A pointer to the token containing the matched keyword.
+ * \param [in] word The characters of the word.
  *
- * \retval NULL No keywords were found or there was an error allocating memory.
+ * \param [in] length The number of characters in \a word.
+ *
+ * \return A pointer to the bucket holding the keywords beginning with \a word
+ * or, if there are none, the empty bucket where they would be stored.
  */
-Token *isKeyword(LexemeList *lexemes,
-                 unsigned int *start)
+static KeywordBucket *findKeywordBucket(const char *word,
+                                        unsigned int length)
+{
+	unsigned int index = hashKeyword(word, length);
+	/* Probe linearly */
+	while (KeywordTable[index].word
+			&& (KeywordTable[index].length != length
+			|| strncmp(KeywordTable[index].word, word, length)))
+		index = (index + 1) & (KEYWORD_BUCKETS - 1);
+	return &KeywordTable[index];
+}
+
+/**
+ * Builds the keyword table from the keywords array.  Keywords sharing a first
+ * word are kept in the order of their token types so they are matched in the
+ * same order as before the table was built.
+ */
+static void buildKeywordTable(void)
 {
-	Token *token = NULL;
 	TokenType type;
-	const char *fname = lexemes->lexemes[*start]->fname;
-	unsigned int line = lexemes->lexemes[*start]->line;
-	/* For each keyword, */
 	for (type = 0; type != TT_ENDOFTOKENS; type++) {
-		/* Check if the start of lexemes match */
-		unsigned int num = acceptLexemes(lexemes,
-				*start, keywords[type]);
-		if (!num) continue;
+		const char *word = keywords[type];
+		const char *end = strchr(word, ' ');
+		unsigned int length = end ? (unsigned int)(end - word) : (unsigned int)strlen(word);
+		KeywordBucket *bucket = NULL;
+		if (length == 0) continue;
+		bucket = findKeywordBucket(word, length);
+		bucket->word = word;
+		bucket->length = length;
+		bucket->types[bucket->num++] = type;
+	}
+	KeywordTableBuilt = 1;
+}
+
+/**
+ * Checks if the next lexemes in a token stream comprise a keyword and, if so,
+ * generates a new token representing that keyword.  Specifically, the keywords
+ * beginning with the next lexeme are looked up and the lexemes following it
+ * are matched against each of them.  If one is found, an appropriate token is
+ * created and returned and \a num is set to the number of lexemes matched.
+ *
+ * \param stream [in,out] A token stream to search for keywords in.
+ *
+ * \param num [out] The number of lexemes making up the keyword.
+ *
+ * \post If a keyword is not found, \a num will not be modified.  Otherwise,
+ * \a num will be set to the number of lexemes matched.
+ *
+ * \return A pointer to the token containing the matched keyword.
+ *
+ * \retval NULL No keywords were found or there was an error allocating memory.
+ */
+Token *isKeyword(TokenStream *stream,
+                 unsigned int *num)
+{
+	Lexeme *lexeme = peekLexeme(stream, 0);
+	KeywordBucket *bucket = NULL;
+	unsigned int n;
+	if (!KeywordTableBuilt) buildKeywordTable();
+	bucket = findKeywordBucket(lexeme->image, lexeme->length);
+	/* For each keyword beginning with the lexeme, */
+	for (n = 0; n < bucket->num; n++) {
+		TokenType type = bucket->types[n];
+		/* Check if the rest of the lexemes match */
+		unsigned int matched = acceptLexemes(stream, keywords[type]);
+		if (!matched) continue;
+		*num = matched;
 		/* If so, create a new token for the keyword */
-		token = createToken(type, keywords[type], fname, line);
-		/* And advance the start */
-		*start += (num - 1);
-		break;
+		lexeme = peekLexeme(stream, 0);
+		return createToken(type, keywords[type], lexeme->fname, lexeme->line);
 	}
-	return token;
+	return NULL;
 }
 
 /**
- * Converts a list of lexemes into tokens.  Also parses integers, floats, and
+ * Scans the next token from a token stream.  Also parses integers, floats, and
  * strings into tokens with semantic meaning.
  *
- * \param list [in] A list of lexemes to tokenize.
+ * \param stream [in,out] The token stream to scan from.
+ *
+ * \post The lexemes making up the token will be discarded.
  *
- * \return A list of tokens generated from \a list.
+ * \return The next token in \a stream.
  *
- * \retval NULL An unrecognized token was encounteres or memory allocation
- * failed.
+ * \retval NULL There are no more lexemes, an unrecognized token was
+ * encountered, or memory allocation failed.
  */
-Token **tokenizeLexemes(LexemeList *list)
+static Token *scanToken(TokenStream *stream)
 {
-	void *mem = NULL;
-	Token **ret = NULL;
-	unsigned int retsize = 0;
-	unsigned int n;
-	for (n = 0; n < list->num; n++) {
-		Lexeme *lexeme = list->lexemes[n];
+	Lexeme *lexeme = NULL;
+	while ((lexeme = peekLexeme(stream, 0))) {
 		const char *image = lexeme->image;
 		const char *fname = lexeme->fname;
 		unsigned int line = lexeme->line;
+		unsigned int num = 1;
 		Token *token = NULL;
+		Lexeme *next = NULL;
 		/* String */
 		if (isString(image)) {
 			token = createToken(TT_STRING, image, fname, line);
@@ -300,14 +384,20 @@ Token **tokenizeLexemes(LexemeList *list)
 		/* Float */
 		else if (isFloat(image)) {
 			token = createToken(TT_FLOAT, image, fname, line);
-			if (sscanf(lexeme->image, "%f", &(token->data.f)) != 1)
+			if (token && sscanf(lexeme->image, "%f", &(token->data.f)) != 1) {
 				error(TK_EXPECTED_FLOATING_POINT, fname, line);
+				deleteToken(token);
+				return NULL;
+			}
 		}
 		/* Integer */
 		else if (isInteger(image)) {
 			token = createToken(TT_INTEGER, image, fname, line);
-			if (sscanf(lexeme->image, "%lli", &(token->data.i)) != 1)
+			if (token && sscanf(lexeme->image, "%lli", &(token->data.i)) != 1) {
 				error(TK_EXPECTED_INTEGER, fname, line);
+				deleteToken(token);
+				return NULL;
+			}
 		}
 		/* FAIL */
 		else if (!strcmp(image, "FAIL")) {
@@ -320,11 +410,12 @@ Token **tokenizeLexemes(LexemeList *list)
 			token->data.i = 1;
 		}
 		/* CAN HAS STDIO? */
-		else if (n < list->num - 2
-				&& !strcmp(lexeme->image, "CAN")
-				&& !strcmp(list->lexemes[n + 1]->image, "HAS")
-				&& !strcmp(list->lexemes[n + 2]->image, "STDIO?")) {
-			n += 2;
+		else if (!strcmp(image, "CAN")
+				&& (next = peekLexeme(stream, 1))
+				&& !strcmp(next->image, "HAS")
+				&& (next = peekLexeme(stream, 2))
+				&& !strcmp(next->image, "STDIO?")) {
+			consumeLexemes(stream, 3);
 			/* Just for fun; not actually in spec */
 			continue;
 		}
@@ -333,16 +424,18 @@ Token **tokenizeLexemes(LexemeList *list)
 		 * follow a comma.  For now, we let commas end a line. */
 		else if (!strcmp(image, "\n")) {
 			/* Note that we ignore any initial newlines */
-			if (retsize < 1) {
+			if (stream->end < 1) {
 #ifdef DEBUG
 				fprintf(stderr, "Skipping initial newline.\n");
 #endif
+				consumeLexemes(stream, 1);
 				continue;
 			}
-			else if (ret[retsize - 1]->type == TT_NEWLINE) {
+			else if (stream->last == TT_NEWLINE) {
 #ifdef DEBUG
 				fprintf(stderr, "Skipping duplicate newline.\n");
 #endif
+				consumeLexemes(stream, 1);
 				continue;
 			}
 			else {
@@ -350,7 +443,7 @@ Token **tokenizeLexemes(LexemeList *list)
 			}
 		}
 		/* Keyword */
-		else if ((token = isKeyword(list, &n))) {
+		else if ((token = isKeyword(stream, &num))) {
 		}
 		/* Identifier */
 		/* This must be placed after keyword parsing or else most
@@ -364,31 +457,148 @@ Token **tokenizeLexemes(LexemeList *list)
 		}
 		else {
 			error(TK_UNKNOWN_TOKEN, fname, line, image);
-			/* Clean up */
-			deleteToken(ret[retsize - 1]);
-			ret[retsize - 1] = NULL;
-			deleteTokens(ret);
 			return NULL;
 		}
+		if (!token) return NULL;
+		consumeLexemes(stream, num);
+#ifdef DEBUG
+		fprintf(stderr, "Adding token type %d [%s]\n", token->type, token->image);
+#endif
+		return token;
+	}
+	return NULL;
+}
 
-		/* Add the token to the token array */
-		if (!addToken(&ret, &retsize, token)) {
-			/* Clean up */
-			if (token) deleteToken(token);
-			deleteToken(ret[retsize - 1]);
-			ret[retsize - 1] = NULL;
-			deleteTokens(ret);
+/**
+ * Creates a token stream.
+ *
+ * \param [in,out] buffer The characters to generate tokens from.
+ *
+ * \param [in] size The number of characters in \a buffer.
+ *
+ * \param [in] fname The name of the file \a buffer was read from.
+ *
+ * \pre \a buffer is followed by a null character at \a buffer[\a size].
+ *
+ * \note Tokens refer to the characters of \a buffer, which must not be freed
+ * until the token stream is deleted.
+ *
+ * \return A token stream positioned at the start of \a buffer.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+TokenStream *createTokenStream(char *buffer,
+                               unsigned int size,
+                               const char *fname)
+{
+	TokenStream *p = malloc(sizeof(TokenStream));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->tokens = malloc(sizeof(Token *) * TOKEN_WINDOW);
+	if (!p->tokens) {
+		perror("malloc");
+		free(p);
+		return NULL;
+	}
+	initLexer(&p->lexer, buffer, size, fname);
+	p->head = 0;
+	p->num = 0;
+	p->size = TOKEN_WINDOW;
+	p->base = 0;
+	p->end = 0;
+	p->last = TT_ENDOFTOKENS;
+	p->done = 0;
+	p->failed = 0;
+	p->failure.type = TT_ENDOFTOKENS;
+	p->failure.data.i = 0;
+	p->failure.image = "end of tokens";
+	p->failure.fname = fname;
+	p->failure.line = 0;
+	return p;
+}
+
+/**
+ * Deletes a token stream.
+ *
+ * \param [in,out] stream The token stream to delete.
+ *
+ * \post The memory at \a stream and all of the tokens in its window will be
+ * freed.
+ */
+void deleteTokenStream(TokenStream *stream)
+{
+	if (!stream) return;
+	releaseStreamTokens(stream, stream->end);
+	free(stream->tokens);
+	free(stream);
+}
+
+/**
+ * Gets a token from a token stream, generating tokens up to it as needed.
+ *
+ * \param [in,out] stream The token stream to get the token from.
+ *
+ * \param [in] index The position of the token within the stream, counting
+ * from the first token generated.
+ *
+ * \return A pointer to the token at \a index.
+ *
+ * \retval NULL The stream ends before \a index, the token at \a index has
+ * been released, or memory allocation failed.
+ */
+Token *getStreamToken(TokenStream *stream,
+                      unsigned long index)
+{
+	while (index >= stream->end) {
+		Token *token = NULL;
+		if (stream->done) return NULL;
+		/* Make sure there is space for another token */
+		if (stream->end - stream->base == stream->size) {
+			unsigned int newsize = stream->size * 2;
+			Token **mem = malloc(sizeof(Token *) * newsize);
+			unsigned long n;
+			if (!mem) {
+				perror("malloc");
+				return NULL;
+			}
+			for (n = stream->base; n < stream->end; n++)
+				mem[n & (newsize - 1)] = stream->tokens[n & (stream->size - 1)];
+			free(stream->tokens);
+			stream->tokens = mem;
+			stream->size = newsize;
+		}
+		token = scanToken(stream);
+		if (!token) {
+			stream->done = 1;
+			stream->failed = 1;
 			return NULL;
 		}
+		if (token->type == TT_EOF) stream->done = 1;
+		stream->tokens[stream->end & (stream->size - 1)] = token;
+		stream->last = token->type;
+		stream->end++;
 	}
-	mem = realloc(ret, sizeof(Token *) * ++retsize);
-	if (!mem) {
-		deleteToken(ret[retsize - 2]);
-		ret[retsize - 2] = NULL;
-		deleteTokens(ret);
-		return NULL;
+	if (index < stream->base) return NULL;
+	return stream->tokens[index & (stream->size - 1)];
+}
+
+/**
+ * Releases the tokens at the front of a token stream once they are no longer
+ * needed.
+ *
+ * \param [in,out] stream The token stream to release tokens from.
+ *
+ * \param [in] index The position of the first token to keep.
+ *
+ * \post The tokens before \a index will be freed.
+ */
+void releaseStreamTokens(TokenStream *stream,
+                         unsigned long index)
+{
+	while (stream->base < index && stream->base < stream->end) {
+		deleteToken(stream->tokens[stream->base & (stream->size - 1)]);
+		stream->base++;
 	}
-	ret = mem;
-	ret[retsize - 1] = NULL;
-	return ret;
 }
@@ -1,9 +1,9 @@
 /**
  * Structures and functions for grouping lexemes into tokens.  The tokenizer
- * reads through an array of lexemes (generated by the lexer) and groups them
- * into tokens based on their structure.  In addition, some lexemes with
- * semantic meaning (such as integers, floats, strings, and booleans) will have
- * their values extracted and stored.
+ * pulls lexemes from the lexer as they are needed and groups them into tokens
+ * based on their structure.  In addition, some lexemes with semantic meaning
+ * (such as integers, floats, strings, and booleans) will have their values
+ * extracted and stored.
  *
  * \file   tokenizer.h
  *
@@ -202,11 +202,44 @@ typedef union {
 typedef struct {
 	TokenType type;    /**< The type of token. */
 	TokenData data;    /**< The stored data of type \a type. */
-	char *image;       /**< The characters that comprise the token. */
+	const char *image; /**< The characters that comprise the token. */
 	const char *fname; /**< The name of the file containing the token. */
 	unsigned int line; /**< The line number the token was on. */
 } Token;
 
+/**
+ * The number of lexemes a token stream may look ahead by.  This must be
+ * larger than the number of words in the longest keyword.
+ */
+#define LEXEME_LOOKAHEAD 8
+
+/**
+ * The number of tokens a token stream initially has space for.  This must be a
+ * power of two.
+ */
+#define TOKEN_WINDOW 64
+
+/**
+ * Stores a stream of tokens which are generated from a character buffer as
+ * they are requested.  Lexemes are scanned only as far ahead as needed to
+ * recognize the next token and tokens are kept in a window from the oldest
+ * token which has not been released to the newest token requested.
+ */
+typedef struct {
+	Lexer lexer;                        /**< The lexer scanning the buffer. */
+	Lexeme lexemes[LEXEME_LOOKAHEAD];   /**< The ring of lexemes scanned ahead. */
+	unsigned int head;                  /**< The position of the next lexeme in \a lexemes. */
+	unsigned int num;                   /**< The number of lexemes in \a lexemes. */
+	Token **tokens;                     /**< The ring of tokens in the window. */
+	unsigned int size;                  /**< The number of tokens there is space for in \a tokens. */
+	unsigned long base;                 /**< The index of the oldest token in the window. */
+	unsigned long end;                  /**< The index after the newest token in the window. */
+	TokenType last;                     /**< The type of the newest token. */
+	int done;                           /**< Whether no more tokens will be generated. */
+	int failed;                         /**< Whether generating a token failed. */
+	Token failure;                      /**< The token read in place of the tokens after a failure or the end of the file. */
+} TokenStream;
+
 /**
  * \name Utilities
  *
@@ -217,7 +250,7 @@ int isInteger(const char *);
 int isFloat(const char *);
 int isString(const char *);
 int isIdentifier(const char *);
-Token *isKeyword(LexemeList *, unsigned int *);
+Token *isKeyword(TokenStream *, unsigned int *);
 /**@}*/
 
 /**
@@ -228,18 +261,19 @@ Token *isKeyword(LexemeList *, unsigned int *);
 /**@{*/
 Token *createToken(TokenType, const char *, const char *, unsigned int);
 void deleteToken(Token *);
-int addToken(Token ***, unsigned int *, Token*);
-void deleteTokens(Token **);
-unsigned int acceptLexemes(LexemeList *, unsigned int, const char *);
+unsigned int acceptLexemes(TokenStream *, const char *);
 /**@}*/
 
 /**
- * \name Lexeme tokenizer
+ * \name Token streams
  *
- * Generates tokens from lexemes.
+ * Functions for generating tokens from a character buffer on demand.
  */
 /**@{*/
-Token **tokenizeLexemes(LexemeList *);
+TokenStream *createTokenStream(char *, unsigned int, const char *);
+void deleteTokenStream(TokenStream *);
+Token *getStreamToken(TokenStream *, unsigned long);
+void releaseStreamTokens(TokenStream *, unsigned long);
 /**@}*/
 
 #endif /* __TOKENIZER_H__ */
@@ -15,7 +15,9 @@
 #include <stdio.h>
 #include <string.h>
 
-int binarySearch(const char **, int, int, const char *);
+#include "error.h"
+
+long lookupNormativeName(const char *);
 long convertNormativeNameToCodePoint(const char *);
 size_t convertCodePointToUTF8(unsigned long, char *);
 
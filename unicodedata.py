@@ -0,0 +1,187 @@
+#!/usr/bin/python
+import argparse
+import sys
+
+# Generates unicodedata.h, the tables lookupNormativeName() in unicode.c uses
+# to find the code points of Unicode normative names, from a file in the
+# format of UnicodeData.txt: one character per line, given by its code point in
+# hexadecimal and its name, separated by semicolons.
+#
+# Names are split into words, and each name is stored as the sequence of its
+# words' positions in a list of distinct words, the most frequent of which take
+# one byte and the rest two.  Names are found with a minimal perfect hash:
+# hashing a name picks one of a number of buckets, and the bucket's
+# displacement picks the position of the name, which is then compared with the
+# name being looked up.  Buckets holding a single name store its position
+# directly.
+
+parser = argparse.ArgumentParser(description="Generator of the Unicode normative name tables of lci")
+parser.add_argument('data', help="The file of code points and names, such as UnicodeData.txt")
+parser.add_argument('-o', '--output', default="unicodedata.h", help="The header to write")
+parser.add_argument('-b', '--bucketSize', type=int, default=4, help="The average number of names per bucket")
+
+args = parser.parse_args()
+
+MASK = 0xFFFFFFFF
+
+# This must match hashNormativeName() in unicode.c
+def hashName(name, seed):
+  """Hashes a name with 32-bit FNV-1a, starting from a seeded offset basis."""
+  h = (2166136261 ^ (seed * 16777619)) & MASK
+  for c in bytearray(name.encode("ascii")):
+    h = ((h ^ c) * 16777619) & MASK
+  return h
+
+def readNames(path):
+  """Reads the characters with normative names, returning (name, code point) pairs."""
+  entries = []
+  seen = set()
+  for line in open(path):
+    fields = line.strip().split(";")
+    if len(fields) < 2 or not fields[1] or fields[1].startswith("<"):
+      continue
+    if fields[1] in seen:
+      continue
+    seen.add(fields[1])
+    entries.append((fields[1], int(fields[0], 16)))
+  return entries
+
+def buildHash(names, buckets):
+  """Assigns each name a distinct position, returning the positions and the displacement of each bucket."""
+  num = len(names)
+  members = [[] for b in range(buckets)]
+  for name in names:
+    members[hashName(name, 0) % buckets].append(name)
+  order = sorted(range(buckets), key=lambda b: -len(members[b]))
+  displacements = [0] * buckets
+  slots = [None] * num
+  free = []
+  for b in order:
+    keys = members[b]
+    if not keys:
+      break
+    if len(keys) == 1:
+      # Single names take the next free position directly
+      if not free:
+        free = [n for n in range(num) if slots[n] is None]
+        free.reverse()
+      slot = free.pop()
+      while slots[slot] is not None:
+        slot = free.pop()
+      slots[slot] = keys[0]
+      displacements[b] = 0x8000 | slot
+      continue
+    seed = 1
+    while True:
+      if seed >= 0x8000:
+        sys.exit("Error: could not place the names of bucket " + str(b) + "; try a smaller bucket size")
+      taken = [hashName(k, seed) % num for k in keys]
+      if len(set(taken)) == len(keys) and all(slots[t] is None for t in taken):
+        break
+      seed += 1
+    for (k, t) in zip(keys, taken):
+      slots[t] = k
+    displacements[b] = seed
+  return (slots, displacements)
+
+def encodeNames(names):
+  """Splits names into words, returning the distinct words, the number of one-byte codes, and the encoding of each name."""
+  counts = {}
+  for name in names:
+    for word in name.split(" "):
+      counts[word] = counts.get(word, 0) + 1
+  words = sorted(counts, key=lambda w: (-counts[w], w))
+  # Use as many one-byte codes as leave enough two-byte codes for the rest
+  short = 256
+  while (256 - short) * 256 < len(words) - short:
+    short -= 1
+  index = dict((w, n) for (n, w) in enumerate(words))
+  phrases = {}
+  for name in names:
+    code = []
+    for word in name.split(" "):
+      n = index[word]
+      if n < short:
+        code.append(n)
+      else:
+        n -= short
+        code += [short + (n >> 8), n & 0xFF]
+    phrases[name] = code
+  return (words, short, phrases)
+
+def writeArray(out, decl, values, fmt):
+  """Writes a C array of values, several to a line."""
+  out.write("static const " + decl + " = {\n")
+  for n in range(0, len(values), 12):
+    line = ", ".join(fmt % v for v in values[n:n + 12])
+    out.write("\t" + line + ("," if n + 12 < len(values) else "") + "\n")
+  out.write("};\n\n")
+
+entries = readNames(args.data)
+codepoints = dict(entries)
+names = [name for (name, codepoint) in entries]
+if len(names) >= 0x8000:
+  sys.exit("Error: too many names for positions to fit in a displacement")
+buckets = max(1, len(names) // args.bucketSize)
+(slots, displacements) = buildHash(names, buckets)
+(words, short, phrases) = encodeNames(names)
+
+wordoffsets = []
+wordbytes = 0
+for word in words:
+  wordoffsets.append(wordbytes)
+  wordbytes += len(word) + 1
+if wordbytes > 0x10000:
+  sys.exit("Error: too many word characters for their offsets to fit")
+
+phrasebook = []
+phraseoffsets = []
+for name in slots:
+  phraseoffsets.append(len(phrasebook))
+  phrasebook += phrases[name]
+phraseoffsets.append(len(phrasebook))
+
+out = open(args.output, "w")
+out.write("""/**
+ * Tables of the Unicode normative names and their code points, generated by
+ * unicodedata.py.  Do not edit this file; regenerate it instead.
+ *
+ * \\file   unicodedata.h
+ *
+ * \\author Justin J. Meza
+ *
+ * \\date   2014
+ */
+
+#ifndef __UNICODEDATA_H__
+#define __UNICODEDATA_H__
+
+""")
+out.write("#define UNICODE_NAMES %d\n" % len(names))
+out.write("#define UNICODE_BUCKETS %d\n" % buckets)
+out.write("#define UNICODE_SHORT_WORDS %d\n\n" % short)
+
+out.write("/* The distinct words of the names, each followed by a null character */\n")
+out.write("static const char unicodeWords[] =\n")
+line = ""
+for word in words:
+  piece = word + "\\000"
+  if len(line) + len(piece) > 70:
+    out.write("\t\"" + line + "\"\n")
+    line = ""
+  line += piece
+out.write("\t\"" + line + "\";\n\n")
+
+out.write("/* The position of each word in unicodeWords */\n")
+writeArray(out, "unsigned short unicodeWordOffsets[%d]" % len(words), wordoffsets, "%d")
+out.write("/* The codes of the words of each name */\n")
+writeArray(out, "unsigned char unicodePhrases[%d]" % len(phrasebook), phrasebook, "%d")
+out.write("/* The position of the codes of each name in unicodePhrases */\n")
+writeArray(out, "unsigned int unicodePhraseOffsets[UNICODE_NAMES + 1]", phraseoffsets, "%d")
+out.write("/* The code point of each name */\n")
+writeArray(out, "unsigned int unicodeCodePoints[UNICODE_NAMES]", [codepoints[name] for name in slots], "0x%04X")
+out.write("/* The hash seed of each bucket, or the position of its only name with 0x8000 set */\n")
+writeArray(out, "unsigned short unicodeDisplacements[UNICODE_BUCKETS]", displacements, "0x%04X")
+out.write("#endif /* __UNICODEDATA_H__ */\n")
+out.close()
+print("Wrote " + str(len(names)) + " names to " + args.output)
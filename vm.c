@@ -0,0 +1,1671 @@
+#include "vm.h"
+
+/**
+ * Represents the kind of construct a break or return statement is nested in.
+ */
+typedef enum {
+	CX_MAIN,   /**< The main block (breaks and returns end the program). */
+	CX_FUNC,   /**< A function body. */
+	CX_LOOP,   /**< A loop body. */
+	CX_SWITCH, /**< A switch statement. */
+	CX_ARRAY   /**< An alternate array definition body. */
+} ContextType;
+
+/**
+ * Stores a construct that break or return statements may exit from.
+ */
+typedef struct context {
+	ContextType type;       /**< The kind of construct. */
+	unsigned int depth;     /**< The scope depth inside the construct. */
+	int exits;              /**< The chain of jumps to patch to its end. */
+	struct context *parent; /**< The enclosing construct. */
+} Context;
+
+/**
+ * Stores the state of the compiler while it compiles a code object.
+ */
+typedef struct {
+	CodeObject *code;   /**< The code object being compiled. */
+	unsigned int depth; /**< The current depth of the scope stack. */
+	Context *context;   /**< The innermost construct being compiled. */
+} Compiler;
+
+static int compileExprNode(Compiler *, ExprNode *);
+static int compileStmtNodeList(Compiler *, StmtNodeList *);
+
+/**
+ * Creates a code object.
+ *
+ * \param [in] func The function whose body the code is for (NULL for main).
+ *
+ * \return An empty code object.
+ *
+ * \retval NULL Memory allocation failed.
+ */
+static CodeObject *createCodeObject(FuncDefStmtNode *func)
+{
+	CodeObject *p = malloc(sizeof(CodeObject));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->func = func;
+	p->num = 0;
+	p->max = 0;
+	p->code = NULL;
+	p->next = NULL;
+	return p;
+}
+
+/**
+ * Deletes a code object.
+ *
+ * \param [in,out] code The code object to delete.
+ *
+ * \post The memory at \a code and any of its members will be freed.
+ */
+static void deleteCodeObject(CodeObject *code)
+{
+	if (!code) return;
+	free(code->code);
+	free(code);
+}
+
+/**
+ * Appends an instruction to the code being compiled.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] op The operation to perform.
+ *
+ * \param [in] arg The integer argument of the operation.
+ *
+ * \param [in] node The parse tree node the operation refers to.
+ *
+ * \return The index of the new instruction.
+ *
+ * \retval -1 Memory allocation failed.
+ */
+static int emit(Compiler *c,
+                Opcode op,
+                int arg,
+                void *node)
+{
+	CodeObject *code = c->code;
+	Instruction *ins = NULL;
+	if (code->num == code->max) {
+		unsigned int max = code->max ? code->max * 2 : 64;
+		void *mem = realloc(code->code, sizeof(Instruction) * max);
+		if (!mem) {
+			perror("realloc");
+			return -1;
+		}
+		code->code = mem;
+		code->max = max;
+	}
+	ins = code->code + code->num;
+	ins->op = op;
+	ins->arg = arg;
+	ins->jump = 0;
+	ins->node = node;
+	ins->cache = NULL;
+	return (int)code->num++;
+}
+
+/**
+ * Sets the target of a jump instruction to the next instruction emitted.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] index The index of the jump instruction.
+ */
+static void patch(Compiler *c,
+                  int index)
+{
+	c->code->code[index].jump = c->code->num;
+}
+
+/**
+ * Emits a jump which exits a break or return context, adding it to the context's
+ * chain of jumps to patch once the context's end is known.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in,out] context The context to exit.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The jump was emitted.
+ */
+static int emitExit(Compiler *c,
+                    Context *context)
+{
+	int index = emit(c, BC_JUMP, context->exits, NULL);
+	if (index < 0) return 0;
+	context->exits = index;
+	return 1;
+}
+
+/**
+ * Patches a context's chain of exit jumps to the next instruction emitted.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] context The context whose exits to patch.
+ */
+static void patchExits(Compiler *c,
+                       Context *context)
+{
+	int index = context->exits;
+	while (index >= 0) {
+		int next = c->code->code[index].arg;
+		patch(c, index);
+		c->code->code[index].arg = 0;
+		index = next;
+	}
+}
+
+/**
+ * Emits instructions leaving nested scopes down to a given depth.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] depth The scope depth to leave to.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The instructions were emitted.
+ */
+static int emitUnwind(Compiler *c,
+                      unsigned int depth)
+{
+	unsigned int n;
+	for (n = depth; n < c->depth; n++)
+		if (emit(c, BC_LEAVE, 0, NULL) < 0) return 0;
+	return 1;
+}
+
+/**
+ * Compiles a list of expressions, each followed by an instruction.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] list The expressions to compile.
+ *
+ * \param [in] op The operation to emit after each expression.
+ *
+ * \param [in] node The node argument to emit with \a op.
+ *
+ * \param [in] index Whether to pass each expression's index as \a op's
+ * integer argument.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileExprNodeList(Compiler *c,
+                               ExprNodeList *list,
+                               Opcode op,
+                               void *node,
+                               int index)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++) {
+		if (!compileExprNode(c, list->exprs[n])) return 0;
+		if (emit(c, op, index ? (int)n : 0, node) < 0) return 0;
+	}
+	return 1;
+}
+
+/**
+ * Compiles a boolean operation.  The truth values of the operands are combined
+ * on the stack, jumping past the remaining operands once the result of the
+ * operation is known.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] expr The operation to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileBoolOpExprNode(Compiler *c,
+                                 OpExprNode *expr)
+{
+	unsigned int n;
+	int exits = -1;
+	for (n = 0; n < expr->args->num; n++) {
+		if (!compileExprNode(c, expr->args->exprs[n])) return 0;
+		if (emit(c, BC_TROOF, 0, NULL) < 0) return 0;
+		if (n > 0 && emit(c, BC_BOOL, expr->type, NULL) < 0) return 0;
+		/**
+		 * \note The short circuiting here matches
+		 * interpretBoolOpExprNode().
+		 */
+		if (expr->type == OP_AND || expr->type == OP_OR) {
+			int index = emit(c, BC_SHORT, expr->type, NULL);
+			if (index < 0) return 0;
+			/* Chain the jumps together until their target is known */
+			c->code->code[index].jump = (unsigned int)(exits + 1);
+			exits = index;
+		}
+	}
+	/* Patch the short circuit jumps to the conversion to a boolean */
+	while (exits >= 0) {
+		int next = (int)c->code->code[exits].jump - 1;
+		patch(c, exits);
+		exits = next;
+	}
+	return emit(c, BC_BOOLEAN, 0, NULL) >= 0;
+}
+
+/**
+ * Compiles an operation.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] expr The operation to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileOpExprNode(Compiler *c,
+                             OpExprNode *expr)
+{
+	switch (expr->type) {
+		case OP_ADD:
+		case OP_SUB:
+		case OP_MULT:
+		case OP_DIV:
+		case OP_MOD:
+		case OP_MAX:
+		case OP_MIN:
+			if (!compileExprNode(c, expr->args->exprs[0])) return 0;
+			if (!compileExprNode(c, expr->args->exprs[1])) return 0;
+			return emit(c, BC_ARITH, expr->type, NULL) >= 0;
+		case OP_AND:
+		case OP_OR:
+		case OP_XOR:
+			return compileBoolOpExprNode(c, expr);
+		case OP_NOT:
+			if (!compileExprNode(c, expr->args->exprs[0])) return 0;
+			return emit(c, BC_NOT, 0, NULL) >= 0;
+		case OP_EQ:
+		case OP_NEQ:
+			if (!compileExprNode(c, expr->args->exprs[0])) return 0;
+			if (!compileExprNode(c, expr->args->exprs[1])) return 0;
+			return emit(c, BC_EQUALITY, expr->type, NULL) >= 0;
+		case OP_CAT:
+			/* Each operand is cast before the next is evaluated */
+			if (!compileExprNodeList(c, expr->args, BC_YARN, NULL, 0))
+				return 0;
+			return emit(c, BC_CONCAT, (int)expr->args->num, NULL) >= 0;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Compiles an expression.  The code emitted pushes the value of the expression
+ * onto the stack.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] node The expression to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileExprNode(Compiler *c,
+                           ExprNode *node)
+{
+	switch (node->type) {
+		case ET_CAST: {
+			CastExprNode *expr = (CastExprNode *)node->expr;
+			if (!compileExprNode(c, expr->target)) return 0;
+			return emit(c, BC_CAST, expr->newtype->type, NULL) >= 0;
+		}
+		case ET_CONSTANT:
+			return emit(c, BC_CONST, 0, node) >= 0;
+		case ET_IDENTIFIER:
+			return emit(c, BC_LOAD, 0, node) >= 0;
+		case ET_FUNCCALL: {
+			FuncCallExprNode *expr = (FuncCallExprNode *)node->expr;
+			/* The function is resolved before its arguments */
+			if (emit(c, BC_CALL_BEGIN, 0, expr) < 0) return 0;
+			if (!compileExprNodeList(c, expr->args, BC_ARG, NULL, 1))
+				return 0;
+			return emit(c, BC_CALL, 0, expr) >= 0;
+		}
+		case ET_OP:
+			return compileOpExprNode(c, (OpExprNode *)node->expr);
+		case ET_IMPVAR:
+			return emit(c, BC_IT, 0, NULL) >= 0;
+		case ET_INVARIANT:
+			return emit(c, BC_INVARIANT, 0, node) >= 0;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Compiles a block of code, which executes in its own nested scope.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] node The block of code to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileBlockNode(Compiler *c,
+                            BlockNode *node)
+{
+	if (emit(c, BC_ENTER, 0, NULL) < 0) return 0;
+	c->depth++;
+	if (!compileStmtNodeList(c, node->stmts)) return 0;
+	if (emit(c, BC_LEAVE, 0, NULL) < 0) return 0;
+	c->depth--;
+	return 1;
+}
+
+/**
+ * Compiles an if/then/else statement.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] stmt The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileIfThenElseStmtNode(Compiler *c,
+                                     IfThenElseStmtNode *stmt)
+{
+	unsigned int n;
+	int skip;
+	Context done;
+	done.type = CX_SWITCH;
+	done.depth = c->depth;
+	done.exits = -1;
+	done.parent = NULL;
+
+	skip = emit(c, BC_JUMP_IF_NOT_IT, 0, NULL);
+	if (skip < 0) return 0;
+	if (!compileBlockNode(c, stmt->yes)) return 0;
+	if (!emitExit(c, &done)) return 0;
+	patch(c, skip);
+
+	for (n = 0; n < stmt->guards->num; n++) {
+		if (!compileExprNode(c, stmt->guards->exprs[n])) return 0;
+		skip = emit(c, BC_JUMP_IF_FALSE, 0, NULL);
+		if (skip < 0) return 0;
+		if (!compileBlockNode(c, stmt->blocks->blocks[n])) return 0;
+		if (!emitExit(c, &done)) return 0;
+		patch(c, skip);
+	}
+
+	if (stmt->no && !compileBlockNode(c, stmt->no)) return 0;
+
+	patchExits(c, &done);
+	return 1;
+}
+
+/**
+ * Compiles a switch statement.  The matching guard is found with the jump
+ * table of the statement, followed by one jump per guard to its block and a
+ * final jump to the default block; the blocks are then laid out in order so
+ * that control falls through them until a break is reached.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] stmt The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileSwitchStmtNode(Compiler *c,
+                                 SwitchStmtNode *stmt)
+{
+	unsigned int n;
+	int *cases = NULL;
+	int skip;
+	Context context;
+	context.type = CX_SWITCH;
+	context.depth = c->depth;
+	context.exits = -1;
+	context.parent = c->context;
+
+	cases = malloc(sizeof(int) * (stmt->guards->num + 1));
+	if (!cases) {
+		perror("malloc");
+		return 0;
+	}
+
+	if (emit(c, BC_SWITCH, 0, stmt) < 0) goto compileSwitchStmtNodeAbort;
+	for (n = 0; n < stmt->guards->num; n++) {
+		cases[n] = emit(c, BC_JUMP, 0, NULL);
+		if (cases[n] < 0) goto compileSwitchStmtNodeAbort;
+	}
+	skip = emit(c, BC_JUMP, 0, NULL);
+	if (skip < 0) goto compileSwitchStmtNodeAbort;
+
+	c->context = &context;
+	for (n = 0; n < stmt->blocks->num; n++) {
+		patch(c, cases[n]);
+		if (!compileBlockNode(c, stmt->blocks->blocks[n])) goto compileSwitchStmtNodeAbort;
+	}
+	if (!emitExit(c, &context)) goto compileSwitchStmtNodeAbort;
+
+	/* The default block is only reached when no guard matches */
+	patch(c, skip);
+	if (stmt->def && !compileBlockNode(c, stmt->def)) goto compileSwitchStmtNodeAbort;
+	c->context = context.parent;
+
+	patchExits(c, &context);
+	free(cases);
+	return 1;
+
+compileSwitchStmtNodeAbort: /* Exception handling */
+
+	/* Clean up any allocated structures */
+	c->context = context.parent;
+	free(cases);
+
+	return 0;
+}
+
+/**
+ * Compiles a loop statement.  The loop executes in a scope holding its
+ * temporary variable and the hidden variables of its loop invariants, and its
+ * body in a nested scope for each iteration.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] stmt The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileLoopStmtNode(Compiler *c,
+                               LoopStmtNode *stmt)
+{
+	unsigned int top;
+	unsigned int n;
+	Context context;
+
+	if (emit(c, BC_ENTER, 0, NULL) < 0) return 0;
+	c->depth++;
+
+	context.type = CX_LOOP;
+	context.depth = c->depth;
+	context.exits = -1;
+	context.parent = c->context;
+
+	if (stmt->var && emit(c, BC_LOOP_VAR, 0, stmt->var) < 0) return 0;
+	for (n = 0; stmt->invariants && n < stmt->invariants->num; n++) {
+		if (emit(c, BC_INVARIANT_VAR, 0, stmt->invariants->ids[n]) < 0)
+			return 0;
+	}
+
+	top = c->code->num;
+	if (stmt->guard) {
+		int index;
+		/* Counting loops compare their variables without the stack */
+		if (stmt->cmp != LC_NONE)
+			index = emit(c, BC_LOOP_TEST, 0, stmt);
+		else {
+			if (!compileExprNode(c, stmt->guard)) return 0;
+			index = emit(c, BC_LOOP_GUARD, 0, NULL);
+		}
+		if (index < 0) return 0;
+		/* A failed guard exits the loop like a break */
+		c->code->code[index].arg = context.exits;
+		context.exits = index;
+	}
+
+	c->context = &context;
+	if (stmt->body && !compileBlockNode(c, stmt->body)) {
+		c->context = context.parent;
+		return 0;
+	}
+	c->context = context.parent;
+
+	if (stmt->update) {
+		if (stmt->step) {
+			if (emit(c, BC_LOOP_STEP, 0, stmt) < 0) return 0;
+		}
+		else {
+			if (!compileExprNode(c, stmt->update)) return 0;
+			if (emit(c, BC_LOOP_STORE, 0, stmt->var) < 0) return 0;
+		}
+	}
+	if (emit(c, BC_JUMP, 0, NULL) < 0) return 0;
+	c->code->code[c->code->num - 1].jump = top;
+
+	patchExits(c, &context);
+	if (emit(c, BC_LEAVE, 0, NULL) < 0) return 0;
+	c->depth--;
+	return 1;
+}
+
+/**
+ * Compiles an alternate array definition statement.  The body executes
+ * directly in the new array's scope.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] stmt The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileAltArrayDefStmtNode(Compiler *c,
+                                      AltArrayDefStmtNode *stmt)
+{
+	Context context;
+
+	if (emit(c, BC_ARRAY_BEGIN, 0, stmt) < 0) return 0;
+	c->depth++;
+
+	/* Breaks and returns only end the array body */
+	context.type = CX_ARRAY;
+	context.depth = c->depth;
+	context.exits = -1;
+	context.parent = c->context;
+
+	c->context = &context;
+	if (!compileStmtNodeList(c, stmt->body->stmts)) {
+		c->context = context.parent;
+		return 0;
+	}
+	c->context = context.parent;
+
+	patchExits(c, &context);
+	if (emit(c, BC_ARRAY_END, 0, stmt) < 0) return 0;
+	c->depth--;
+	return 1;
+}
+
+/**
+ * Compiles a break statement, which exits the innermost loop or switch
+ * statement.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileBreakStmtNode(Compiler *c)
+{
+	Context *context = c->context;
+	switch (context->type) {
+		case CX_LOOP:
+		case CX_SWITCH:
+		case CX_ARRAY:
+			if (!emitUnwind(c, context->depth)) return 0;
+			return emitExit(c, context);
+		default:
+			/* Ends the main block or returns nil from a function */
+			return emit(c, BC_RETURN_NIL, 0, NULL) >= 0;
+	}
+}
+
+/**
+ * Compiles a return statement, which exits the enclosing function.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] stmt The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileReturnStmtNode(Compiler *c,
+                                 ReturnStmtNode *stmt)
+{
+	Context *context = c->context;
+	if (stmt->func) {
+		/* A call in tail position replaces the executing function */
+		FuncCallExprNode *expr = (FuncCallExprNode *)stmt->value->expr;
+		if (emit(c, BC_CALL_BEGIN, 0, expr) < 0) return 0;
+		if (!compileExprNodeList(c, expr->args, BC_ARG, NULL, 1))
+			return 0;
+		return emit(c, BC_TAIL_CALL, 0, stmt) >= 0;
+	}
+	if (!compileExprNode(c, stmt->value)) return 0;
+	while (context->type == CX_LOOP || context->type == CX_SWITCH)
+		context = context->parent;
+	if (context->type == CX_ARRAY) {
+		/* The returned value is discarded */
+		if (emit(c, BC_POP, 0, NULL) < 0) return 0;
+		if (!emitUnwind(c, context->depth)) return 0;
+		return emitExit(c, context);
+	}
+	return emit(c, BC_RETURN, 0, NULL) >= 0;
+}
+
+/**
+ * Compiles a statement.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] node The statement to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileStmtNode(Compiler *c,
+                           StmtNode *node)
+{
+	switch (node->type) {
+		case ST_CAST:
+		case ST_INPUT:
+		case ST_DEALLOCATION:
+		case ST_FUNCDEF:
+			/* These statements contain no nested code */
+			return emit(c, BC_STMT, 0, node) >= 0;
+		case ST_PRINT: {
+			PrintStmtNode *stmt = (PrintStmtNode *)node->stmt;
+			/* Each argument is printed before the next is evaluated */
+			if (!compileExprNodeList(c, stmt->args, BC_PRINT, stmt, 0))
+				return 0;
+			return emit(c, BC_PRINT_END, 0, stmt) >= 0;
+		}
+		case ST_ASSIGNMENT: {
+			AssignmentStmtNode *stmt = (AssignmentStmtNode *)node->stmt;
+			if (isAppendAssignment(stmt)) {
+				/* Let the concatenation append to its target */
+				OpExprNode *op = (OpExprNode *)stmt->expr->expr;
+				if (!compileExprNodeList(c, op->args, BC_YARN, NULL, 0))
+					return 0;
+				if (emit(c, BC_CONCAT, (int)op->args->num, stmt->target) < 0)
+					return 0;
+			}
+			else if (!compileExprNode(c, stmt->expr)) return 0;
+			return emit(c, BC_ASSIGN, 0, stmt->target) >= 0;
+		}
+		case ST_DECLARATION: {
+			DeclarationStmtNode *stmt = (DeclarationStmtNode *)node->stmt;
+			if (emit(c, BC_DECL_BEGIN, 0, stmt) < 0) return 0;
+			if (stmt->expr) {
+				if (!compileExprNode(c, stmt->expr)) return 0;
+			}
+			else if (emit(c, BC_DECL_INIT, 0, stmt) < 0) return 0;
+			return emit(c, BC_DECL_END, 0, stmt) >= 0;
+		}
+		case ST_IFTHENELSE:
+			return compileIfThenElseStmtNode(c, (IfThenElseStmtNode *)node->stmt);
+		case ST_SWITCH:
+			return compileSwitchStmtNode(c, (SwitchStmtNode *)node->stmt);
+		case ST_BREAK:
+			return compileBreakStmtNode(c);
+		case ST_RETURN:
+			return compileReturnStmtNode(c, (ReturnStmtNode *)node->stmt);
+		case ST_LOOP:
+			return compileLoopStmtNode(c, (LoopStmtNode *)node->stmt);
+		case ST_EXPR:
+			if (!compileExprNode(c, (ExprNode *)node->stmt)) return 0;
+			return emit(c, BC_SET_IT, 0, NULL) >= 0;
+		case ST_ALTARRAYDEF:
+			return compileAltArrayDefStmtNode(c, (AltArrayDefStmtNode *)node->stmt);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Compiles a list of statements.
+ *
+ * \param [in,out] c The compiler state.
+ *
+ * \param [in] list The statements to compile.
+ *
+ * \retval 0 Compilation failed.
+ *
+ * \retval 1 Compilation succeeded.
+ */
+static int compileStmtNodeList(Compiler *c,
+                               StmtNodeList *list)
+{
+	unsigned int n;
+	for (n = 0; n < list->num; n++)
+		if (!compileStmtNode(c, list->stmts[n])) return 0;
+	return 1;
+}
+
+/**
+ * Compiles a list of statements into a new code object.
+ *
+ * \param [in] list The statements to compile.
+ *
+ * \param [in] func The function whose body \a list is (NULL for main).
+ *
+ * \return The compiled code.
+ *
+ * \retval NULL Compilation failed.
+ */
+static CodeObject *compileCode(StmtNodeList *list,
+                               FuncDefStmtNode *func)
+{
+	Compiler c;
+	Context context;
+	context.type = func ? CX_FUNC : CX_MAIN;
+	context.depth = 0;
+	context.exits = -1;
+	context.parent = NULL;
+	c.code = createCodeObject(func);
+	if (!c.code) return NULL;
+	c.depth = 0;
+	c.context = &context;
+	if (!compileStmtNodeList(&c, list) || emit(&c, BC_END, 0, NULL) < 0) {
+		deleteCodeObject(c.code);
+		return NULL;
+	}
+	return c.code;
+}
+
+/**
+ * Compiles the body of a function and adds it to a program.
+ *
+ * \param [in,out] prog The program to add the function to.
+ *
+ * \param [in] func The function to compile.
+ *
+ * \return The compiled function body.
+ *
+ * \retval NULL Compilation failed.
+ */
+CodeObject *compileFunction(Program *prog,
+                            FuncDefStmtNode *func)
+{
+	CodeObject *code = compileCode(func->body->stmts, func);
+	if (!code) return NULL;
+	code->next = prog->funcs;
+	prog->funcs = code;
+	return code;
+}
+
+/**
+ * Compiles the main block of code into a program.  Function bodies are
+ * compiled the first time they are called.
+ *
+ * \param [in] main The main block of code to compile.
+ *
+ * \return A program ready for execution.
+ *
+ * \retval NULL Compilation failed.
+ */
+Program *compileMainNode(MainNode *main)
+{
+	Program *p = NULL;
+	if (!main) return NULL;
+	p = malloc(sizeof(Program));
+	if (!p) {
+		perror("malloc");
+		return NULL;
+	}
+	p->funcs = NULL;
+	p->stack = NULL;
+	p->sp = p->stacksize = 0;
+	p->scopes = NULL;
+	p->ssp = p->scopesize = 0;
+	p->pending = NULL;
+	p->psp = p->pendsize = 0;
+	p->main = compileCode(main->block->stmts, NULL);
+	if (!p->main) {
+		free(p);
+		return NULL;
+	}
+	return p;
+}
+
+/**
+ * Deletes a program.
+ *
+ * \param [in,out] prog The program to delete.
+ *
+ * \post The memory at \a prog and any of its members will be freed.
+ */
+void deleteProgram(Program *prog)
+{
+	CodeObject *code = NULL;
+	if (!prog) return;
+	deleteCodeObject(prog->main);
+	code = prog->funcs;
+	while (code) {
+		CodeObject *next = code->next;
+		deleteCodeObject(code);
+		code = next;
+	}
+	free(prog->stack);
+	free(prog->scopes);
+	free(prog->pending);
+	free(prog);
+}
+
+/**
+ * Grows one of the stacks of a program.
+ *
+ * \param [in,out] stack The stack to grow.
+ *
+ * \param [in,out] size The number of entries \a stack can hold.
+ *
+ * \param [in] width The size of each entry of \a stack.
+ *
+ * \retval 0 Memory allocation failed.
+ *
+ * \retval 1 The stack was grown.
+ */
+static int growStack(void **stack,
+                     unsigned int *size,
+                     size_t width)
+{
+	unsigned int max = *size ? *size * 2 : 64;
+	void *mem = realloc(*stack, width * max);
+	if (!mem) {
+		perror("realloc");
+		return 0;
+	}
+	*stack = mem;
+	*size = max;
+	return 1;
+}
+
+/**
+ * Finds the compiled body of a function, compiling it if necessary.
+ *
+ * \param [in,out] prog The program the function belongs to.
+ *
+ * \param [in] func The function to find.
+ *
+ * \return The compiled function body.
+ *
+ * \retval NULL Compilation failed.
+ */
+static CodeObject *getFunctionCode(Program *prog,
+                                   FuncDefStmtNode *func)
+{
+	CodeObject *code = NULL;
+	for (code = prog->funcs; code; code = code->next)
+		if (code->func == func) return code;
+	return compileFunction(prog, func);
+}
+
+/**
+ * Creates the initial value of a declaration without an initializing
+ * expression, the same way interpretDeclarationStmtNode() does.
+ *
+ * \param [in] stmt The declaration.
+ *
+ * \param [in] scope The scope the declaration is evaluated under.
+ *
+ * \return The initial value of the declared variable.
+ *
+ * \retval NULL An error occurred.
+ */
+static ValueObject *createDeclarationValue(DeclarationStmtNode *stmt,
+                                           ScopeObject *scope)
+{
+	if (stmt->type) {
+		switch (stmt->type->type) {
+			case CT_NIL:
+				return createNilValueObject();
+			case CT_BOOLEAN:
+				return createBooleanValueObject(0);
+			case CT_INTEGER:
+				return createIntegerValueObject(0);
+			case CT_FLOAT:
+				return createFloatValueObject(0.0);
+			case CT_STRING:
+				return createStringValueObject(copyString(""));
+			case CT_ARRAY:
+				return createArrayValueObject(scope);
+			default:
+				error(IN_INVALID_DECLARATION_TYPE);
+				return NULL;
+		}
+	}
+	else if (stmt->parent) {
+		ScopeObject *parent = getScopeObject(scope, scope, stmt->parent);
+		if (!parent) return NULL;
+		return createArrayValueObject(parent);
+	}
+	return createNilValueObject();
+}
+
+/**
+ * Reports an error involving an identifier, resolving its name under a scope.
+ *
+ * \param [in] type The type of error.
+ *
+ * \param [in] id The identifier the error involves.
+ *
+ * \param [in] scope The scope to resolve \a id under.
+ */
+static void identifierError(ErrorType type,
+                            IdentifierNode *id,
+                            ScopeObject *scope)
+{
+	char *name = resolveIdentifierName(id, scope);
+	if (name) {
+		error(type, id->fname, id->line, name);
+		free(name);
+	}
+}
+
+/**
+ * Pushes a value onto the stack, growing it if necessary.
+ */
+#define PUSH(value) \
+	do { \
+		if (prog->sp == prog->stacksize \
+				&& !growStack((void **)&prog->stack, &prog->stacksize, sizeof(ValueObject *))) \
+			goto executeAbort; \
+		prog->stack[prog->sp++] = (value); \
+	} while (0)
+
+/**
+ * Pops a value off of the stack.
+ */
+#define POP() (prog->stack[--prog->sp])
+
+/**
+ * Accesses the value at the top of the stack.
+ */
+#define TOP() (prog->stack[prog->sp - 1])
+
+#ifdef VM_COMPUTED_GOTO
+#define TARGET(op) L_##op:
+#define DISPATCH() goto *dispatch[ip->op]
+#else
+#define TARGET(op) case op:
+#define DISPATCH() goto dispatch
+#endif
+
+/**
+ * Moves to the next instruction.
+ */
+#define NEXT() do { ip++; DISPATCH(); } while (0)
+
+/**
+ * Jumps to the target of the current instruction.
+ */
+#define JUMP() do { ip = start + ip->jump; DISPATCH(); } while (0)
+
+/**
+ * Executes compiled code.
+ *
+ * \param [in,out] prog The program the code belongs to.
+ *
+ * \param [in] code The code to execute.
+ *
+ * \param [in,out] scope The scope to execute \a code under.
+ *
+ * \return The value returned by \a code.  For function bodies without a
+ * return statement, this is the implicit variable of \a scope, which is removed
+ * from \a scope.
+ *
+ * \retval NULL An error occurred during execution.
+ */
+static ValueObject *execute(Program *prog,
+                            CodeObject *code,
+                            ScopeObject *scope)
+{
+#ifdef VM_COMPUTED_GOTO
+	static void *dispatch[] = {
+		&&L_BC_END,
+		&&L_BC_CONST,
+		&&L_BC_IT,
+		&&L_BC_LOAD,
+		&&L_BC_CAST,
+		&&L_BC_ARITH,
+		&&L_BC_TROOF,
+		&&L_BC_SHORT,
+		&&L_BC_BOOL,
+		&&L_BC_BOOLEAN,
+		&&L_BC_NOT,
+		&&L_BC_EQUALITY,
+		&&L_BC_YARN,
+		&&L_BC_CONCAT,
+		&&L_BC_CALL_BEGIN,
+		&&L_BC_ARG,
+		&&L_BC_CALL,
+		&&L_BC_TAIL_CALL,
+		&&L_BC_POP,
+		&&L_BC_JUMP,
+		&&L_BC_JUMP_IF_FALSE,
+		&&L_BC_JUMP_IF_NOT_IT,
+		&&L_BC_SWITCH,
+		&&L_BC_ENTER,
+		&&L_BC_LEAVE,
+		&&L_BC_STMT,
+		&&L_BC_PRINT,
+		&&L_BC_PRINT_END,
+		&&L_BC_ASSIGN,
+		&&L_BC_DECL_BEGIN,
+		&&L_BC_DECL_INIT,
+		&&L_BC_DECL_END,
+		&&L_BC_SET_IT,
+		&&L_BC_LOOP_VAR,
+		&&L_BC_LOOP_GUARD,
+		&&L_BC_LOOP_TEST,
+		&&L_BC_LOOP_STEP,
+		&&L_BC_LOOP_STORE,
+		&&L_BC_INVARIANT_VAR,
+		&&L_BC_INVARIANT,
+		&&L_BC_ARRAY_BEGIN,
+		&&L_BC_ARRAY_END,
+		&&L_BC_RETURN,
+		&&L_BC_RETURN_NIL };
+#endif
+	Instruction *start = code->code;
+	Instruction *ip = start;
+	unsigned int spbase = prog->sp;
+	unsigned int sspbase = prog->ssp;
+	unsigned int pspbase = prog->psp;
+	ValueObject *ret = NULL;
+
+#ifdef VM_COMPUTED_GOTO
+	DISPATCH();
+#else
+dispatch:
+	switch (ip->op) {
+#endif
+
+	TARGET(BC_END) {
+		if (code->func) {
+			/* Extract the default return value */
+			ret = scope->impvar;
+			scope->impvar = NULL;
+		}
+		else
+			ret = createNilValueObject();
+		return ret;
+	}
+
+	TARGET(BC_CONST) {
+		ValueObject *val = interpretConstantExprNode(ip->node, scope);
+		if (!val) goto executeAbort;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_IT) {
+		PUSH(copyValueObject(scope->impvar));
+		NEXT();
+	}
+
+	TARGET(BC_LOAD) {
+		ValueObject *val = interpretIdentifierExprNode(ip->node, scope);
+		if (!val) goto executeAbort;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_CAST) {
+		ValueObject *val = TOP();
+		ValueObject *cast = NULL;
+		switch (ip->arg) {
+			case CT_NIL:
+				cast = createNilValueObject();
+				break;
+			case CT_BOOLEAN:
+				cast = castBooleanExplicit(val, scope);
+				break;
+			case CT_INTEGER:
+				cast = castIntegerExplicit(val, scope);
+				break;
+			case CT_FLOAT:
+				cast = castFloatExplicit(val, scope);
+				break;
+			case CT_STRING:
+				cast = castStringExplicit(val, scope);
+				break;
+			default:
+				error(IN_UNKNOWN_CAST_TYPE);
+				break;
+		}
+		if (!cast) goto executeAbort;
+		deleteValueObject(val);
+		TOP() = cast;
+		NEXT();
+	}
+
+	TARGET(BC_ARITH) {
+		ValueObject *val1 = prog->stack[prog->sp - 2];
+		ValueObject *val2 = TOP();
+		ValueObject *val = interpretArithOpValues(ip->arg, val1, val2, scope);
+		if (!val) goto executeAbort;
+		deleteValueObject(val1);
+		deleteValueObject(val2);
+		prog->sp--;
+		TOP() = val;
+		NEXT();
+	}
+
+	TARGET(BC_TROOF) {
+		ValueObject *val = TOP();
+		ValueObject *truth = NULL;
+		int temp;
+		if (!getBooleanValue(val, scope, &temp)) goto executeAbort;
+		/* Truth values are kept as integers, as in interpretBoolOpExprNode() */
+		truth = createIntegerValueObject(temp);
+		if (!truth) goto executeAbort;
+		deleteValueObject(val);
+		TOP() = truth;
+		NEXT();
+	}
+
+	TARGET(BC_SHORT) {
+		int acc = (int)getInteger(TOP());
+		if ((ip->arg == OP_AND && acc == 0)
+				|| (ip->arg == OP_OR && acc == 1))
+			JUMP();
+		NEXT();
+	}
+
+	TARGET(BC_BOOL) {
+		ValueObject *val1 = prog->stack[prog->sp - 2];
+		ValueObject *val2 = TOP();
+		int acc = (int)getInteger(val1);
+		int temp = (int)getInteger(val2);
+		ValueObject *val = NULL;
+		switch (ip->arg) {
+			case OP_AND:
+				acc &= temp;
+				break;
+			case OP_OR:
+				acc |= temp;
+				break;
+			case OP_XOR:
+				acc ^= temp;
+				break;
+			default:
+				error(IN_INVALID_BOOLEAN_OPERATION_TYPE);
+				goto executeAbort;
+		}
+		val = createIntegerValueObject(acc);
+		if (!val) goto executeAbort;
+		deleteValueObject(val1);
+		deleteValueObject(val2);
+		prog->sp--;
+		TOP() = val;
+		NEXT();
+	}
+
+	TARGET(BC_BOOLEAN) {
+		ValueObject *val = TOP();
+		ValueObject *truth = createBooleanValueObject((int)getInteger(val));
+		if (!truth) goto executeAbort;
+		deleteValueObject(val);
+		TOP() = truth;
+		NEXT();
+	}
+
+	TARGET(BC_NOT) {
+		ValueObject *val = TOP();
+		ValueObject *truth = NULL;
+		int temp;
+		if (!getBooleanValue(val, scope, &temp)) goto executeAbort;
+		truth = createBooleanValueObject(!temp);
+		if (!truth) goto executeAbort;
+		deleteValueObject(val);
+		TOP() = truth;
+		NEXT();
+	}
+
+	TARGET(BC_EQUALITY) {
+		ValueObject *val1 = prog->stack[prog->sp - 2];
+		ValueObject *val2 = TOP();
+		ValueObject *val = interpretEqualityOpValues(ip->arg, val1, val2);
+		if (!val) goto executeAbort;
+		deleteValueObject(val1);
+		deleteValueObject(val2);
+		prog->sp--;
+		TOP() = val;
+		NEXT();
+	}
+
+	TARGET(BC_YARN) {
+		ValueObject *val = TOP();
+		ValueObject *use = castStringImplicit(val, scope);
+		if (!use) goto executeAbort;
+		deleteValueObject(val);
+		TOP() = use;
+		NEXT();
+	}
+
+	TARGET(BC_CONCAT) {
+		unsigned int num = (unsigned int)ip->arg;
+		ValueObject **vals = prog->stack + prog->sp - num;
+		ValueObject *val = concatStringValues(vals, num, scope, ip->node);
+		unsigned int n;
+		if (!val) goto executeAbort;
+		for (n = 0; n < num; n++)
+			deleteValueObject(vals[n]);
+		prog->sp -= num;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_CALL_BEGIN) {
+		ScopeObject *target = NULL;
+		ScopeObject *outer = NULL;
+		FuncDefStmtNode *func = getFuncCallTarget(ip->node, scope, &target);
+		if (!func) goto executeAbort;
+		outer = createScopeObjectCaller(scope, target);
+		if (!outer) goto executeAbort;
+		if (!reserveScopeValues(outer, func->locals)
+				|| (prog->psp == prog->pendsize
+				&& !growStack((void **)&prog->pending, &prog->pendsize, sizeof(PendingEntry)))) {
+			deleteScopeObject(outer);
+			goto executeAbort;
+		}
+		prog->pending[prog->psp].scope = outer;
+		prog->pending[prog->psp].def = func;
+		prog->pending[prog->psp].target = NULL;
+		prog->psp++;
+		NEXT();
+	}
+
+	TARGET(BC_ARG) {
+		PendingEntry *call = prog->pending + prog->psp - 1;
+		IdentifierNode *id = call->def->args->ids[ip->arg];
+		ValueObject *val = TOP();
+		if (!createScopeValue(scope, call->scope, id)) goto executeAbort;
+		if (!updateScopeValue(scope, call->scope, id, val)) goto executeAbort;
+		prog->sp--;
+		NEXT();
+	}
+
+	TARGET(BC_CALL) {
+		PendingEntry call = prog->pending[--prog->psp];
+		CodeObject *body = ip->cache;
+		ValueObject *val = NULL;
+		/* Cache the compiled body of the last function called here */
+		if (!body || body->func != call.def) {
+			body = getFunctionCode(prog, call.def);
+			if (!body) {
+				deleteScopeObject(call.scope);
+				goto executeAbort;
+			}
+			ip->cache = body;
+		}
+		val = execute(prog, body, call.scope);
+		deleteScopeObject(call.scope);
+		if (!val) goto executeAbort;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_TAIL_CALL) {
+		ReturnStmtNode *stmt = ip->node;
+		PendingEntry call = prog->pending[--prog->psp];
+		CodeObject *body = ip->cache;
+		if (!body || body->func != call.def) {
+			body = getFunctionCode(prog, call.def);
+			if (!body) {
+				deleteScopeObject(call.scope);
+				goto executeAbort;
+			}
+			ip->cache = body;
+		}
+		if (!canReuseFuncScope(stmt->func, call.def, call.scope)) {
+			ret = execute(prog, body, call.scope);
+			deleteScopeObject(call.scope);
+			if (!ret) goto executeAbort;
+			goto executeReturn;
+		}
+		/* Leave any nested scopes and continue with the call in this one */
+		while (prog->ssp > sspbase) {
+			deleteScopeObject(scope);
+			scope = prog->scopes[--prog->ssp].scope;
+		}
+		replaceScopeValues(scope, call.scope);
+		code = body;
+		start = ip = code->code;
+		DISPATCH();
+	}
+
+	TARGET(BC_POP) {
+		deleteValueObject(POP());
+		NEXT();
+	}
+
+	TARGET(BC_JUMP) {
+		JUMP();
+	}
+
+	TARGET(BC_JUMP_IF_FALSE) {
+		ValueObject *val = TOP();
+		int truth;
+		if (!getBooleanValue(val, scope, &truth)) goto executeAbort;
+		deleteValueObject(val);
+		prog->sp--;
+		if (!truth) JUMP();
+		NEXT();
+	}
+
+	TARGET(BC_JUMP_IF_NOT_IT) {
+		int truth;
+		if (!getBooleanValue(scope->impvar, scope, &truth)) goto executeAbort;
+		if (!truth) JUMP();
+		NEXT();
+	}
+
+	TARGET(BC_SWITCH) {
+		unsigned int n;
+		if (!findSwitchCase(ip->node, scope, &n)) goto executeAbort;
+		/* Take the jump to the block of guard n, or to the default block */
+		ip += 1 + n;
+		DISPATCH();
+	}
+
+	TARGET(BC_ENTER) {
+		ScopeObject *inner = NULL;
+		if (prog->ssp == prog->scopesize
+				&& !growStack((void **)&prog->scopes, &prog->scopesize, sizeof(ScopeEntry)))
+			goto executeAbort;
+		inner = createScopeObject(scope);
+		if (!inner) goto executeAbort;
+		prog->scopes[prog->ssp].scope = scope;
+		prog->scopes[prog->ssp].owned = 1;
+		prog->ssp++;
+		scope = inner;
+		NEXT();
+	}
+
+	TARGET(BC_LEAVE) {
+		deleteScopeObject(scope);
+		scope = prog->scopes[--prog->ssp].scope;
+		NEXT();
+	}
+
+	TARGET(BC_STMT) {
+		ReturnObject *r = interpretStmtNode(ip->node, scope);
+		if (!r) goto executeAbort;
+		deleteReturnObject(r);
+		NEXT();
+	}
+
+	TARGET(BC_PRINT) {
+		PrintStmtNode *stmt = ip->node;
+		ValueObject *val = TOP();
+		if (!printValueObject(val, scope, stmt->file)) goto executeAbort;
+		deleteValueObject(val);
+		prog->sp--;
+		NEXT();
+	}
+
+	TARGET(BC_PRINT_END) {
+		PrintStmtNode *stmt = ip->node;
+		if (!stmt->nonl)
+			writeFile(stmt->file, "\n", 1);
+		NEXT();
+	}
+
+	TARGET(BC_ASSIGN) {
+		ValueObject *val = TOP();
+		/* Interpolate assigned strings */
+		if (getType(val) == VT_STRING) {
+			ValueObject *use = castStringImplicit(val, scope);
+			if (!use) goto executeAbort;
+			deleteValueObject(val);
+			TOP() = val = use;
+		}
+		if (!updateScopeValue(scope, scope, ip->node, val)) goto executeAbort;
+		prog->sp--;
+		NEXT();
+	}
+
+	TARGET(BC_DECL_BEGIN) {
+		DeclarationStmtNode *stmt = ip->node;
+		IdentifierNode *target = NULL;
+		ScopeObject *dest = getScopeObject(scope, scope, stmt->scope);
+		if (!dest) goto executeAbort;
+		/* Evaluate the name being declared only once */
+		target = evaluateIdentifierNode(stmt->target, scope);
+		if (!target) goto executeAbort;
+		if (getScopeValueLocal(scope, dest, target)) {
+			identifierError(IN_REDEFINITION_OF_VARIABLE, target, scope);
+			deleteEvaluatedIdentifierNode(target, stmt->target);
+			goto executeAbort;
+		}
+		if (getErrorCode()
+				|| (prog->psp == prog->pendsize
+				&& !growStack((void **)&prog->pending, &prog->pendsize, sizeof(PendingEntry)))) {
+			deleteEvaluatedIdentifierNode(target, stmt->target);
+			goto executeAbort;
+		}
+		prog->pending[prog->psp].scope = dest;
+		prog->pending[prog->psp].def = NULL;
+		prog->pending[prog->psp].target = target != stmt->target ? target : NULL;
+		prog->psp++;
+		NEXT();
+	}
+
+	TARGET(BC_DECL_INIT) {
+		ValueObject *val = createDeclarationValue(ip->node, scope);
+		if (!val) goto executeAbort;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_DECL_END) {
+		DeclarationStmtNode *stmt = ip->node;
+		PendingEntry *decl = prog->pending + prog->psp - 1;
+		IdentifierNode *target = decl->target ? decl->target : stmt->target;
+		ValueObject *val = TOP();
+		if (!createScopeValue(scope, decl->scope, target)) goto executeAbort;
+		if (!updateScopeValue(scope, decl->scope, target, val)) goto executeAbort;
+		deleteEvaluatedIdentifierNode(decl->target, NULL);
+		prog->sp--;
+		prog->psp--;
+		NEXT();
+	}
+
+	TARGET(BC_SET_IT) {
+		deleteValueObject(scope->impvar);
+		scope->impvar = POP();
+		NEXT();
+	}
+
+	TARGET(BC_LOOP_VAR) {
+		ValueObject *val = NULL;
+		/* The loop variable is named under the enclosing scope */
+		if (!createScopeValue(scope->parent, scope, ip->node)) goto executeAbort;
+		val = createIntegerValueObject(0);
+		if (!val) goto executeAbort;
+		if (!updateScopeValue(scope->parent, scope, ip->node, val)) {
+			deleteValueObject(val);
+			goto executeAbort;
+		}
+		NEXT();
+	}
+
+	TARGET(BC_LOOP_GUARD) {
+		ValueObject *val = TOP();
+		int truth;
+		if (!getBooleanValue(val, scope->parent, &truth)) goto executeAbort;
+		deleteValueObject(val);
+		prog->sp--;
+		if (!truth) JUMP();
+		NEXT();
+	}
+
+	TARGET(BC_LOOP_TEST) {
+		int truth;
+		if (!getLoopGuardValue(ip->node, scope, &truth)) goto executeAbort;
+		if (!truth) JUMP();
+		NEXT();
+	}
+
+	TARGET(BC_LOOP_STEP) {
+		if (!stepLoopVariable(ip->node, scope)) goto executeAbort;
+		NEXT();
+	}
+
+	TARGET(BC_LOOP_STORE) {
+		ValueObject *val = TOP();
+		if (!updateScopeValue(scope->parent, scope, ip->node, val)) goto executeAbort;
+		prog->sp--;
+		NEXT();
+	}
+
+	TARGET(BC_INVARIANT_VAR) {
+		/* The variable holds nil until the invariant is evaluated */
+		if (!createScopeValue(scope->parent, scope, ip->node)) goto executeAbort;
+		NEXT();
+	}
+
+	TARGET(BC_INVARIANT) {
+		/* Invariants are evaluated at most once per loop, so need no code */
+		ValueObject *val = interpretInvariantExprNode(ip->node, scope);
+		if (!val) goto executeAbort;
+		PUSH(val);
+		NEXT();
+	}
+
+	TARGET(BC_ARRAY_BEGIN) {
+		AltArrayDefStmtNode *stmt = ip->node;
+		IdentifierNode *target = NULL;
+		ValueObject *init = NULL;
+		/* Evaluate the name being declared only once */
+		target = evaluateIdentifierNode(stmt->name, scope);
+		if (!target) goto executeAbort;
+		if (getScopeValueLocal(scope, scope, target)) {
+			identifierError(IN_REDEFINITION_OF_VARIABLE, target, scope);
+			deleteEvaluatedIdentifierNode(target, stmt->name);
+			goto executeAbort;
+		}
+		if (getErrorCode()
+				|| (prog->psp == prog->pendsize
+				&& !growStack((void **)&prog->pending, &prog->pendsize, sizeof(PendingEntry)))) {
+			deleteEvaluatedIdentifierNode(target, stmt->name);
+			goto executeAbort;
+		}
+		prog->pending[prog->psp].scope = scope;
+		prog->pending[prog->psp].def = NULL;
+		prog->pending[prog->psp].target = target != stmt->name ? target : NULL;
+		prog->psp++;
+		if (stmt->parent) {
+			ScopeObject *parent = getScopeObject(scope, scope, stmt->parent);
+			if (!parent) goto executeAbort;
+			init = createArrayValueObject(parent);
+		}
+		else
+			init = createArrayValueObject(scope);
+		if (!init) goto executeAbort;
+		if (prog->ssp == prog->scopesize
+				&& !growStack((void **)&prog->scopes, &prog->scopesize, sizeof(ScopeEntry))) {
+			deleteValueObject(init);
+			goto executeAbort;
+		}
+		PUSH(init);
+		/* Populate the array body in the array's own scope */
+		prog->scopes[prog->ssp].scope = scope;
+		prog->scopes[prog->ssp].owned = 0;
+		prog->ssp++;
+		scope = getArray(init);
+		NEXT();
+	}
+
+	TARGET(BC_ARRAY_END) {
+		AltArrayDefStmtNode *stmt = ip->node;
+		PendingEntry *decl = prog->pending + prog->psp - 1;
+		IdentifierNode *target = decl->target ? decl->target : stmt->name;
+		ValueObject *init = TOP();
+		scope = prog->scopes[--prog->ssp].scope;
+		if (!createScopeValue(scope, scope, target)) goto executeAbort;
+		if (!updateScopeValue(scope, scope, target, init)) goto executeAbort;
+		deleteEvaluatedIdentifierNode(decl->target, NULL);
+		prog->sp--;
+		prog->psp--;
+		NEXT();
+	}
+
+	TARGET(BC_RETURN) {
+		ret = POP();
+		goto executeReturn;
+	}
+
+	TARGET(BC_RETURN_NIL) {
+		ret = createNilValueObject();
+		if (!ret) goto executeAbort;
+		goto executeReturn;
+	}
+
+#ifndef VM_COMPUTED_GOTO
+	default:
+		goto executeAbort;
+	}
+#endif
+
+executeReturn: /* Leave any nested scopes */
+
+	while (prog->ssp > sspbase) {
+		deleteScopeObject(scope);
+		scope = prog->scopes[--prog->ssp].scope;
+	}
+
+	return ret;
+
+executeAbort: /* In case something goes wrong... */
+
+	/* Clean up any allocated structures */
+	while (prog->psp > pspbase) {
+		PendingEntry *entry = prog->pending + --prog->psp;
+		if (entry->def) deleteScopeObject(entry->scope);
+		deleteEvaluatedIdentifierNode(entry->target, NULL);
+	}
+	while (prog->ssp > sspbase) {
+		ScopeEntry *entry = prog->scopes + --prog->ssp;
+		if (entry->owned) deleteScopeObject(scope);
+		scope = entry->scope;
+	}
+	while (prog->sp > spbase)
+		deleteValueObject(POP());
+
+	return NULL;
+}
+
+/**
+ * Executes a program.
+ *
+ * \param [in,out] prog The program to execute.
+ *
+ * \pre \a prog was created by compileMainNode().
+ *
+ * \return The final status of the program.
+ *
+ * \retval 0 \a prog was executed without any errors.
+ *
+ * \retval 1 An error occurred while executing \a prog.
+ */
+int executeProgram(Program *prog)
+{
+	ScopeObject *scope = NULL;
+	ValueObject *ret = NULL;
+	if (!prog) return 1;
+	scope = createScopeObject(NULL);
+	if (!scope) return 1;
+	ret = execute(prog, prog->main, scope);
+	/* The values cast may be freed once the program is done with them */
+	clearCastCache();
+	deleteScopeObject(scope);
+	if (!ret) return 1;
+	deleteValueObject(ret);
+	return 0;
+}
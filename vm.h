@@ -0,0 +1,151 @@
+/**
+ * Structures and functions for compiling a parse tree to bytecode and
+ * executing it on a virtual machine.  The compiler flattens the statements and
+ * expressions of a parse tree into a linear sequence of instructions which the
+ * virtual machine then executes in a single dispatch loop, using the value,
+ * scope, and casting functions of the interpreter to retain exactly the same
+ * semantics.  The tree-walking interpreter remains the reference engine.
+ *
+ * \file   vm.h
+ *
+ * \author Justin J. Meza
+ *
+ * \date   2014
+ */
+
+#ifndef __VM_H__
+#define __VM_H__
+
+#include "interpreter.h"
+
+/**
+ * Use threaded ("computed goto") dispatch where the compiler supports it and
+ * fall back to a portable switch-based dispatch loop otherwise.
+ */
+#if defined(__GNUC__) && !defined(VM_NO_COMPUTED_GOTO)
+#define VM_COMPUTED_GOTO
+#endif
+
+/**
+ * Represents a bytecode operation.
+ *
+ * \note Remember to update the dispatch table in vm.c if these change.
+ */
+typedef enum {
+	BC_END,            /**< Completes the code without a break or return. */
+	BC_CONST,          /**< Pushes a constant. */
+	BC_IT,             /**< Pushes the implicit variable. */
+	BC_LOAD,           /**< Pushes the value of an identifier. */
+	BC_CAST,           /**< Casts the top of the stack. */
+	BC_ARITH,          /**< Applies an arithmetic operation to the top two values. */
+	BC_TROOF,          /**< Replaces the top of the stack with its truth value. */
+	BC_SHORT,          /**< Jumps if a boolean operation is decided. */
+	BC_BOOL,           /**< Combines the top two truth values. */
+	BC_BOOLEAN,        /**< Converts the top truth value to a boolean. */
+	BC_NOT,            /**< Negates the top of the stack. */
+	BC_EQUALITY,       /**< Compares the top two values. */
+	BC_YARN,           /**< Implicitly casts the top of the stack to a string. */
+	BC_CONCAT,         /**< Concatenates the top strings on the stack, appending to an assigned variable if given. */
+	BC_CALL_BEGIN,     /**< Resolves a function and prepares its scope. */
+	BC_ARG,            /**< Binds the top of the stack to a function argument. */
+	BC_CALL,           /**< Calls the prepared function. */
+	BC_TAIL_CALL,      /**< Returns the prepared function in place of the executing one. */
+	BC_POP,            /**< Discards the top of the stack. */
+	BC_JUMP,           /**< Jumps unconditionally. */
+	BC_JUMP_IF_FALSE,  /**< Pops a condition and jumps if it is false. */
+	BC_JUMP_IF_NOT_IT, /**< Jumps if the implicit variable is false. */
+	BC_SWITCH,         /**< Skips to the jump following it for the guard matching the implicit variable. */
+	BC_ENTER,          /**< Enters a new nested scope. */
+	BC_LEAVE,          /**< Leaves and deletes a nested scope. */
+	BC_STMT,           /**< Interprets a statement with no nested code. */
+	BC_PRINT,          /**< Pops a value and prints it. */
+	BC_PRINT_END,      /**< Completes a print statement. */
+	BC_ASSIGN,         /**< Pops a value and assigns it to a variable. */
+	BC_DECL_BEGIN,     /**< Checks a declaration and finds its scope. */
+	BC_DECL_INIT,      /**< Pushes the default value of a declaration. */
+	BC_DECL_END,       /**< Pops a value and declares a variable with it. */
+	BC_SET_IT,         /**< Pops a value and stores it in the implicit variable. */
+	BC_LOOP_VAR,       /**< Creates a temporary loop variable. */
+	BC_LOOP_GUARD,     /**< Pops a loop guard and jumps if it is false. */
+	BC_LOOP_TEST,      /**< Compares a counting loop variable to its limit and jumps if the loop ends. */
+	BC_LOOP_STEP,      /**< Increments or decrements a counting loop variable. */
+	BC_LOOP_STORE,     /**< Pops a value and stores it in a loop variable. */
+	BC_INVARIANT_VAR,  /**< Creates a hidden variable holding the value of a loop invariant. */
+	BC_INVARIANT,      /**< Pushes the value of a loop invariant, evaluating it if it is not yet known. */
+	BC_ARRAY_BEGIN,    /**< Creates an array and enters its scope. */
+	BC_ARRAY_END,      /**< Leaves an array's scope and declares it. */
+	BC_RETURN,         /**< Pops a value and returns it from a function. */
+	BC_RETURN_NIL      /**< Returns nil from a function. */
+} Opcode;
+
+/**
+ * Stores a single bytecode instruction.
+ */
+typedef struct {
+	Opcode op;         /**< The operation to perform. */
+	int arg;           /**< An integer argument (a type or a count). */
+	unsigned int jump; /**< The instruction to jump to, if any. */
+	void *node;        /**< The parse tree node the operation refers to. */
+	void *cache;       /**< Cached data for the instruction. */
+} Instruction;
+
+/**
+ * Stores the compiled code of the main block or a function body.
+ */
+typedef struct codeobject {
+	FuncDefStmtNode *func;   /**< The function compiled (NULL for main). */
+	unsigned int num;        /**< The number of instructions. */
+	unsigned int max;        /**< The number of instructions allocated. */
+	Instruction *code;       /**< The instructions. */
+	struct codeobject *next; /**< The next compiled function. */
+} CodeObject;
+
+/**
+ * Stores an entry of the virtual machine's scope stack.
+ */
+typedef struct {
+	ScopeObject *scope; /**< The scope to restore. */
+	int owned;          /**< Whether to delete the current scope on exit. */
+} ScopeEntry;
+
+/**
+ * Stores the target of a function call or declaration whose operands are still
+ * being evaluated.
+ */
+typedef struct {
+	ScopeObject *scope;     /**< The scope to call the function in or declare in. */
+	FuncDefStmtNode *def;   /**< The function to call (NULL for declarations). */
+	IdentifierNode *target; /**< The evaluated name to declare, if it differs from the statement's (or NULL). */
+} PendingEntry;
+
+/**
+ * Stores a compiled program and the state of the virtual machine executing
+ * it.
+ */
+typedef struct {
+	CodeObject *main;       /**< The compiled main block. */
+	CodeObject *funcs;      /**< The compiled function bodies. */
+	ValueObject **stack;    /**< The value stack. */
+	unsigned int sp;        /**< The number of values on the stack. */
+	unsigned int stacksize; /**< The size of the value stack. */
+	ScopeEntry *scopes;     /**< The scope stack. */
+	unsigned int ssp;       /**< The number of entries on the scope stack. */
+	unsigned int scopesize; /**< The size of the scope stack. */
+	PendingEntry *pending;  /**< The pending call and declaration stack. */
+	unsigned int psp;       /**< The number of pending entries. */
+	unsigned int pendsize;  /**< The size of the pending stack. */
+} Program;
+
+/**
+ * \name Program modifiers
+ *
+ * Functions for compiling, executing, and deleting programs.
+ */
+/**@{*/
+CodeObject *compileFunction(Program *, FuncDefStmtNode *);
+Program *compileMainNode(MainNode *);
+int executeProgram(Program *);
+void deleteProgram(Program *);
+/**@}*/
+
+#endif /* __VM_H__ */